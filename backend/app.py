@@ -16,6 +16,8 @@ import requests
 from collections import deque
 from vision_service import VisionService
 from face_recognition_service import FaceRecognitionService
+from eye_scripts import compact_eye_scripts
+from display_config import compact_display_config, update_display_config, DEFAULTS as DISPLAY_CONFIG_DEFAULTS
 
 # Paths
 BASE_DIR = Path(__file__).parent.parent
@@ -45,15 +47,30 @@ AUDIO_DEVICE = "plughw:3,0"  # card 3, device 0 (UACDemoV1.0)
 OUTPUT_DIR.mkdir(exist_ok=True)
 
 def play_audio_local(audio_file):
-    """Play audio through the local USB speaker"""
+    """Play audio through the local USB speaker
+
+    Playback is announced to the ESP32 displays as a scheduled "speaking"
+    state and started at the announced server time, so the eye changes in
+    step with the audio.
+    """
+    def _play():
+        try:
+            subprocess.Popen(
+                ['aplay', '-D', AUDIO_DEVICE, str(audio_file)],
+                stdout=subprocess.DEVNULL,
+                stderr=subprocess.DEVNULL
+            )
+        except Exception as e:
+            print(f"Error playing audio locally: {e}")
+
     try:
-        subprocess.Popen(
-            ['aplay', '-D', AUDIO_DEVICE, str(audio_file)],
-            stdout=subprocess.DEVNULL,
-            stderr=subprocess.DEVNULL
-        )
+        from hal_controller import get_controller, server_time_ms, wav_duration_s, speech_envelope
+        start_ms = get_controller().schedule_display_state("speaking", wav_duration_s(audio_file),
+                                                           envelope=speech_envelope(audio_file))
+        threading.Timer(max(0.0, (start_ms - server_time_ms()) / 1000.0), _play).start()
     except Exception as e:
-        print(f"Error playing audio locally: {e}")
+        print(f"Error scheduling display state: {e}")
+        _play()
 
 # Initialize vision service (disabled - HAL controller handles camera now)
 vision_service = VisionService()
@@ -433,8 +450,14 @@ def apply_red_filter(jpeg_bytes):
 
 @app.route('/api/hal/face_frame', methods=['GET'])
 def hal_face_frame():
-    """Face frame with optional red filter for ESP32 display"""
-    from hal_controller import get_controller
+    """Face frame with optional red filter for ESP32 display
+
+    Stamped for camera-to-glass latency tracing: X-Frame-Seq and X-Capture-Time
+    identify the camera frame, X-Server-Rx-Time and X-Server-Tx-Time bracket the
+    request. All times are server_time_ms(), the clock displays sync to.
+    """
+    from hal_controller import get_controller, server_time_ms
+    server_rx_ms = server_time_ms()
     controller = get_controller()
 
     red_filter = request.args.get('red', 'false').lower() == 'true'
@@ -442,19 +465,25 @@ def hal_face_frame():
     size = min(max(size, 64), 480)  # Clamp between 64 and 480
 
     # Get frame from HAL controller's camera
-    frame = controller.get_camera_frame(size=size)
+    frame, seq, capture_ms = controller.get_stamped_camera_frame(size=size)
     if frame and red_filter:
         frame = apply_red_filter(frame)
 
     if frame:
-        return Response(frame, mimetype='image/jpeg')
+        headers = {"X-Server-Rx-Time": str(server_rx_ms)}
+        if seq is not None:
+            headers["X-Frame-Seq"] = str(seq)
+            headers["X-Capture-Time"] = str(capture_ms)
+        headers["X-Server-Tx-Time"] = str(server_time_ms())
+        return Response(frame, mimetype='image/jpeg', headers=headers)
     else:
         return jsonify({"error": "No camera frame available"}), 500
 
 @app.route('/api/hal/display', methods=['GET'])
 def hal_display():
     """Display state for ESP32 - what to show"""
-    from hal_controller import get_controller
+    from hal_controller import get_controller, server_time_ms
+    server_rx_ms = server_time_ms()
     controller = get_controller()
 
     tracker_info = controller.person_tracker.get_debug_info() if controller.person_tracker else {}
@@ -471,9 +500,39 @@ def hal_display():
     return jsonify({
         "mode": "face" if has_face else "eye",
         "state": controller.current_state,
-        "person": person_name
+        "person": person_name,
+        "events": controller.get_display_events(request.args.get('known', 0, type=int)),
+        "script_version": compact_eye_scripts()["version"],
+        "config_version": compact_display_config()["version"],
+        # NTP-style timestamps so displays can sync their animation clock
+        "server_rx_ms": server_rx_ms,
+        "server_tx_ms": server_time_ms()
     })
 
+@app.route('/api/hal/eye_script', methods=['GET'])
+def hal_eye_script():
+    """Keyframe animation scripts for the ESP32 eye, one per state"""
+    return jsonify(compact_eye_scripts())
+
+@app.route('/api/hal/config', methods=['GET'])
+def hal_config():
+    """Runtime tunables for the ESP32 displays (overrides of the firmware defaults)"""
+    config = compact_display_config()
+    if request.args.get('defaults'):
+        config["defaults"] = DISPLAY_CONFIG_DEFAULTS
+    return jsonify(config)
+
+@app.route('/api/hal/config', methods=['POST'])
+def hal_config_update():
+    """Change display tunables: {"name": value, ...}; null resets a setting to the firmware default"""
+    data = request.get_json(silent=True)
+    if not isinstance(data, dict):
+        return jsonify({"error": "JSON body required"}), 400
+    try:
+        return jsonify(update_display_config(data))
+    except ValueError as e:
+        return jsonify({"error": str(e)}), 400
+
 @app.route('/api/vision/analyze', methods=['POST'])
 def vision_analyze():
     """Analyze current camera view using Claude Vision API"""
@@ -653,6 +712,26 @@ def hal_status():
 
     return jsonify(controller.get_status())
 
+@app.route('/api/hal/ping', methods=['GET'])
+def hal_ping():
+    """Cheap liveness probe displays use to validate and rank discovered backends"""
+    from hal_controller import server_time_ms
+    return jsonify({"service": "hal9000", "server_tx_ms": server_time_ms()})
+
+@app.route('/api/hal/metrics', methods=['POST'])
+def hal_metrics():
+    """Receive a performance metrics window from the ESP32 display"""
+    data = request.get_json(silent=True)
+    if not isinstance(data, dict):
+        return jsonify({"error": "JSON body required"}), 400
+
+    client_ip = request.remote_addr
+    if client_ip and client_ip != '127.0.0.1':
+        set_esp32_seen(client_ip)
+    set_esp32_metrics(data)
+
+    return jsonify({"success": True})
+
 @app.route('/api/hal/register', methods=['POST'])
 def hal_register_name():
     """Register a name for the pending unknown face"""
@@ -698,7 +777,9 @@ debug_state = {
     'face_status': '',
     'esp32_connected': False,
     'esp32_ip': None,
-    'esp32_last_seen': None
+    'esp32_last_seen': None,
+    'esp32_metrics': None,
+    'esp32_metrics_time': None
 }
 debug_lock = threading.Lock()
 
@@ -744,6 +825,12 @@ def set_esp32_seen(ip_address):
         # Log to help debugging
         print(f"[ESP32] Seen at {ip_address} at {debug_state['esp32_last_seen']}", flush=True)
 
+def set_esp32_metrics(metrics):
+    """Record the latest ESP32 performance metrics window for debug"""
+    with debug_lock:
+        debug_state['esp32_metrics'] = metrics
+        debug_state['esp32_metrics_time'] = datetime.now().strftime('%H:%M:%S')
+
 @app.route('/debug')
 def debug_dashboard():
     """Serve debug dashboard HTML"""
@@ -788,6 +875,8 @@ def debug_status():
             'esp32_connected': esp32_connected,
             'esp32_ip': debug_state['esp32_ip'],
             'esp32_last_seen': debug_state['esp32_last_seen'],
+            'esp32_metrics': debug_state['esp32_metrics'],
+            'esp32_metrics_time': debug_state['esp32_metrics_time'],
             'conversation': conv_info,
             'tracker': tracker_info
         })
@@ -1102,6 +1191,13 @@ if __name__ == '__main__':
     controller = get_controller()
     controller.start()
 
+    # Let displays find this backend without a compiled-in address
+    # (HAL_ADVERTISE_PORT when a proxy fronts Flask on another port)
+    import atexit
+    import discovery
+    if discovery.start_advertising(int(os.getenv("HAL_ADVERTISE_PORT", "8080"))):
+        atexit.register(discovery.stop_advertising)
+
     print("HAL 9000 TTS Server starting...")
     print(f"Model loaded from: {MODEL_PATH}")
     app.run(host='0.0.0.0', port=8080, debug=False, threaded=True)
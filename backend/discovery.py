@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+"""
+mDNS / DNS-SD advertisement of the HAL backend
+
+Displays browse for _hal9000._tcp on the LAN instead of relying on the
+address compiled into their firmware, so the Pi can move (or a second
+backend can be added) without reflashing. Each display probes every
+advertised backend's /api/hal/ping and uses the one with the lowest RTT.
+
+Advertising is best effort: without the zeroconf package, or without a
+routable address, the backend runs as before and displays fall back to
+their cached or compiled-in address.
+"""
+
+import os
+import socket
+import threading
+
+SERVICE_TYPE = "_hal9000._tcp.local."
+PING_PATH = "/api/hal/ping"
+
+_lock = threading.Lock()
+_zeroconf = None
+_infos = []
+
+
+def local_ip():
+    """Address of the interface that routes to the LAN (no packets are sent)"""
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    try:
+        sock.connect(("10.255.255.255", 1))
+        return sock.getsockname()[0]
+    except OSError:
+        return None
+    finally:
+        sock.close()
+
+
+def start_advertising(port, name=None, ip=None, properties=None):
+    """Register one _hal9000._tcp instance; returns True if it is being advertised"""
+    global _zeroconf
+    try:
+        from zeroconf import ServiceInfo, Zeroconf
+    except ImportError:
+        print("[mDNS] zeroconf not installed, not advertising the backend", flush=True)
+        return False
+
+    ip = ip or os.getenv("HAL_ADVERTISE_IP") or local_ip()
+    if not ip:
+        print("[mDNS] No LAN address, not advertising the backend", flush=True)
+        return False
+
+    hostname = socket.gethostname().split(".")[0]
+    name = name or f"HAL 9000 on {hostname}"
+    props = {"api": "/api/hal", "ping": PING_PATH}
+    props.update(properties or {})
+    info = ServiceInfo(
+        SERVICE_TYPE,
+        f"{name}.{SERVICE_TYPE}",
+        addresses=[socket.inet_aton(ip)],
+        port=port,
+        properties=props,
+        server=f"{hostname}.local.",
+    )
+
+    with _lock:
+        if _zeroconf is None:
+            _zeroconf = Zeroconf()
+        _zeroconf.register_service(info, allow_name_change=True)
+        _infos.append(info)
+    print(f"[mDNS] Advertising '{info.name}' at {ip}:{port}", flush=True)
+    return True
+
+
+def stop_advertising():
+    """Withdraw every registered instance so displays fail over straight away"""
+    global _zeroconf
+    with _lock:
+        if _zeroconf is None:
+            return
+        for info in _infos:
+            _zeroconf.unregister_service(info)
+        _infos.clear()
+        _zeroconf.close()
+        _zeroconf = None
@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""
+HAL 9000 Display Configuration
+
+Per-installation overrides for the display firmware's runtime tunables
+(esp32_display/src/config.cpp). Only values that differ from the firmware
+defaults are stored, in display_config.json next to this file (or
+$HAL_DISPLAY_CONFIG). Displays see the version in every /api/hal/display
+poll and fetch /api/hal/config when it changes; the firmware validates the
+ranges and reports rejected values in its log.
+
+Every display poll asks for the version, so the file is read and hashed
+again only when its modification time changes or an update is written.
+"""
+
+import hashlib
+import json
+import os
+import threading
+from pathlib import Path
+
+CONFIG_PATH = Path(os.getenv("HAL_DISPLAY_CONFIG", Path(__file__).parent / "display_config.json"))
+
+# Names the firmware understands (CONFIG_DEFS), with their defaults for reference
+DEFAULTS = {
+    "poll_ms": 1000,
+    "face_ms": 200,
+    "http_timeout": 2000,
+    "face_timeout": 3000,
+    "face_max_bytes": 200000,
+    "report_ms": 5000,
+    "eye_divisor": 2,
+    "eye_period_ms": 33,
+    "lvgl_min_ms": 2,
+    "lvgl_max_ms": 500,
+    "idle_after_ms": 300000,
+    "idle_divisor": 6,
+    "idle_period_ms": 100,
+    "idle_cpu_mhz": 80,
+    "cpu_min_mhz": 80,
+    "backlight": 100,
+    "idle_backlight": 30,
+    "fade_ms": 400,
+    "fade_divisor": 3,
+    "face_interp": 1,
+    "face_divisor": 2,
+}
+
+_lock = threading.Lock()
+# (modification time, compact_display_config()) of the file as last read; None to read it again
+_cache = None
+
+
+def _read_config_file() -> dict:
+    try:
+        with open(CONFIG_PATH) as f:
+            values = json.load(f)
+        return values if isinstance(values, dict) else {}
+    except (OSError, ValueError):
+        return {}
+
+
+def _cached_config() -> dict:
+    global _cache
+    try:
+        mtime = os.stat(CONFIG_PATH).st_mtime_ns
+    except OSError:
+        mtime = None
+    cache = _cache
+    if cache is not None and cache[0] == mtime:
+        return cache[1]
+    values = _read_config_file()
+    payload = json.dumps(values, sort_keys=True, separators=(",", ":"))
+    compact = {
+        "version": hashlib.md5(payload.encode()).hexdigest()[:8],
+        "values": values,
+    }
+    _cache = (mtime, compact)
+    return compact
+
+
+def load_display_config() -> dict:
+    return dict(_cached_config()["values"])
+
+
+def display_setting(name: str) -> int:
+    """Value the displays run with: the override if there is one, else the firmware default"""
+    return _cached_config()["values"].get(name, DEFAULTS[name])
+
+
+def update_display_config(changes: dict) -> dict:
+    """Apply {name: value}; None or the default removes an override. Raises ValueError on unknown names"""
+    global _cache
+    unknown = [name for name in changes if name not in DEFAULTS]
+    if unknown:
+        raise ValueError(f"Unknown display settings: {', '.join(unknown)}")
+    with _lock:
+        values = load_display_config()
+        for name, value in changes.items():
+            if value is None or value == DEFAULTS[name]:
+                values.pop(name, None)
+            elif isinstance(value, bool) or not isinstance(value, int) or value < 0:
+                raise ValueError(f"{name} must be a non-negative integer")
+            else:
+                values[name] = value
+        tmp = CONFIG_PATH.with_suffix(".tmp")
+        with open(tmp, "w") as f:
+            json.dump(values, f, indent=2, sort_keys=True)
+        os.replace(tmp, CONFIG_PATH)
+        # The new file can carry the same timestamp as the old one on coarse-grained filesystems
+        _cache = None
+    return compact_display_config()
+
+
+def compact_display_config() -> dict:
+    """Wire format for the firmware: {"version": "...", "values": {name: value}}"""
+    compact = _cached_config()
+    return {"version": compact["version"], "values": dict(compact["values"])}
@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+"""
+HAL 9000 Eye Animation Scripts
+
+Keyframe scripts for the ESP32 display's on-device timeline engine:
+- One script per eye state (idle, listening, speaking)
+- Each keyframe sets colour, glow growth, brightness and easing
+- The display interpolates locally, so editing a script here changes
+  the eye after a single small download
+"""
+
+import hashlib
+import json
+
+# Easing names understood by the firmware (index = EyeEase enum value)
+EASES = ["linear", "in", "out", "in_out", "step"]
+
+
+def _pulse(color, period_ms, dim=179, bright=255, glow=20):
+    """Sinusoidal pulse between dim and bright, the classic HAL eye"""
+    half = period_ms // 2
+    return {
+        "loop_start_ms": 0,
+        "loop_end_ms": period_ms,
+        "keyframes": [
+            {"t": 0, "color": color, "glow": 0, "brightness": dim, "ease": "in_out"},
+            {"t": half, "color": color, "glow": glow, "brightness": bright, "ease": "in_out"},
+            {"t": period_ms, "color": color, "glow": 0, "brightness": dim, "ease": "in_out"},
+        ],
+    }
+
+
+EYE_SCRIPTS = {
+    # Deep red (#CC0000), slow pulse
+    "idle": _pulse([204, 0, 0], 3142),
+    # Bright red, fast pulse
+    "listening": _pulse([255, 0, 0], 1047),
+    # Orange-red (#FF3300), medium pulse
+    "speaking": _pulse([255, 51, 0], 1571),
+}
+
+
+# compact_eye_scripts() of EYE_SCRIPTS, which never change while running; every display poll asks for its version
+_compact_cache = None
+
+
+def compact_eye_scripts(scripts=EYE_SCRIPTS) -> dict:
+    """Compact wire format for the firmware
+
+    {"version": "...", "states": {"idle": {"loop": [start, end],
+     "kf": [[t, r, g, b, glow, brightness, ease], ...]}, ...}}
+    """
+    global _compact_cache
+    if scripts is EYE_SCRIPTS and _compact_cache is not None:
+        return _compact_cache
+    states = {}
+    for name, script in scripts.items():
+        states[name] = {
+            "loop": [script["loop_start_ms"], script["loop_end_ms"]],
+            "kf": [
+                [kf["t"], *kf["color"], kf["glow"], kf["brightness"], EASES.index(kf.get("ease", "linear"))]
+                for kf in script["keyframes"]
+            ],
+        }
+    payload = json.dumps(states, sort_keys=True, separators=(",", ":"))
+    compact = {
+        "version": hashlib.md5(payload.encode()).hexdigest()[:8],
+        "states": states,
+    }
+    if scripts is EYE_SCRIPTS:
+        _compact_cache = compact
+    return compact
@@ -17,6 +17,7 @@ import subprocess
 import json
 import requests
 import wave
+from collections import deque
 from pathlib import Path
 from datetime import datetime
 import numpy as np
@@ -53,6 +54,7 @@ from face_recognition_service import FaceRecognitionService
 from memory_store import get_memory_store
 from conversation_manager import ConversationManager, ConversationState
 from person_tracker import PersonTracker
+from display_config import display_setting
 
 # Debug reporting - all run in separate threads to avoid blocking/deadlocks from circular imports
 import threading as _debug_threading
@@ -103,6 +105,92 @@ def report_debug_face(name, status):
     _debug_threading.Thread(target=_report, daemon=True).start()
 
 
+def server_time_ms():
+    """Display timebase in milliseconds (system-wide monotonic clock shared by all ESP32 displays)"""
+    return int(time.monotonic() * 1000)
+
+
+# ESP32 displays poll /api/hal/display every poll_ms (display_config.py), so
+# scheduled state changes must be announced at least one poll (plus network
+# slack) ahead. The lead is capped because speech waits for it: a display
+# tuned to poll more slowly than that picks the event up late and joins it
+# part way through.
+DISPLAY_EVENT_MARGIN_S = 0.2
+DISPLAY_EVENT_MAX_LEAD_S = 3.0
+
+
+def display_event_lead_s():
+    """How far ahead to announce a display state change for the configured poll interval"""
+    return min(display_setting("poll_ms") / 1000.0 + DISPLAY_EVENT_MARGIN_S, DISPLAY_EVENT_MAX_LEAD_S)
+
+
+# Speech envelope sent to the displays: one 8-bit amplitude value per 20 ms
+ENVELOPE_RATE_HZ = 50
+# Longest envelope a display holds (MAX_ENVELOPE_SAMPLES in esp32_display/src/main.cpp), ~30 s at 50 Hz
+DISPLAY_MAX_ENVELOPE_SAMPLES = 1536
+
+
+def speech_envelope(audio_file):
+    """8-bit RMS amplitude envelope of a WAV file, cached next to it as .env
+
+    Values are normalised to the loudest window so quiet and loud voices
+    both use the full brightness range on the display.
+    """
+    env_file = Path(audio_file).with_suffix('.env')
+    try:
+        if env_file.exists() and env_file.stat().st_mtime >= Path(audio_file).stat().st_mtime:
+            return env_file.read_bytes()
+
+        with wave.open(str(audio_file), 'rb') as wf:
+            rate = wf.getframerate()
+            channels = wf.getnchannels()
+            samples = np.frombuffer(wf.readframes(wf.getnframes()), dtype=np.int16)
+        if channels > 1:
+            samples = samples.reshape(-1, channels).mean(axis=1)
+
+        window = max(1, rate // ENVELOPE_RATE_HZ)
+        count = len(samples) // window
+        if count == 0:
+            return b''
+        windows = samples[:count * window].astype(np.float32).reshape(count, window)
+        rms = np.sqrt(np.mean(windows * windows, axis=1))
+        peak = float(rms.max())
+        if peak > 0:
+            rms = rms * (255.0 / peak)
+        envelope = np.clip(rms, 0, 255).astype(np.uint8).tobytes()
+
+        env_file.write_bytes(envelope)
+        return envelope
+    except Exception as e:
+        print(f"Could not compute speech envelope for {audio_file}: {e}")
+        return b''
+
+
+def fit_envelope(envelope, rate_hz=ENVELOPE_RATE_HZ, max_samples=DISPLAY_MAX_ENVELOPE_SAMPLES):
+    """Decimate an envelope to the highest whole-Hz rate that fits the display
+
+    Returns (envelope, rate_hz). Each output value is the peak of the input
+    values it covers, so syllables stay visible at the lower rate.
+    """
+    if len(envelope) <= max_samples:
+        return envelope, rate_hz
+    out_hz = max(1, (max_samples * rate_hz) // len(envelope))
+    count = min(max_samples, (len(envelope) * out_hz) // rate_hz)
+    values = np.frombuffer(envelope, dtype=np.uint8)
+    starts = (np.arange(count) * rate_hz) // out_hz
+    return np.maximum.reduceat(values, starts).astype(np.uint8).tobytes(), out_hz
+
+
+def wav_duration_s(audio_file):
+    """Playback length of a WAV file in seconds"""
+    try:
+        with wave.open(str(audio_file), 'rb') as wf:
+            return wf.getnframes() / float(wf.getframerate())
+    except Exception as e:
+        print(f"Could not read WAV duration for {audio_file}: {e}")
+        return 0.0
+
+
 class HALController:
     def __init__(self):
         # Paths
@@ -187,6 +275,9 @@ class HALController:
         # Pending registration
         self.pending_face_encoding = None
         self.pending_snapshot = None
+        # (frame, seq, capture_ms) for the latest camera frame, stamped for display latency tracing
+        self.pending_snapshot_stamp = None
+        self.camera_frame_seq = 0
         self.conversation_lock = threading.Lock()
 
         # Detection thread
@@ -213,6 +304,13 @@ class HALController:
         self.current_transcription = ""
         self.mic_monitor_paused = False  # Pause during active listening
 
+        # Scheduled display state changes ("state X from server time T1 to T2"). Ids are seeded from the
+        # wall clock so they keep increasing across restarts: displays only take envelopes newer than
+        # the last id they acknowledged (uint32 on the display, good until 2106)
+        self.display_events = deque(maxlen=8)
+        self.display_event_id = int(time.time()) % (1 << 32)
+        self.display_events_lock = threading.Lock()
+
     def _precache_common_phrases(self):
         """Pre-generate TTS for common phrases"""
         common_phrases = [
@@ -229,6 +327,8 @@ class HALController:
             cache_file = self._get_tts_cache_path(phrase)
             if not cache_file.exists():
                 self._generate_tts(phrase, cache_file)
+            if cache_file.exists():
+                speech_envelope(cache_file)
         print("TTS cache ready")
 
     def _get_tts_cache_path(self, text):
@@ -384,6 +484,7 @@ class HALController:
 
                 try:
                     frame = self.picam.capture_array()
+                    capture_ms = server_time_ms()
                 except Exception as e:
                     print(f"Failed to capture frame: {e}")
                     sys.stdout.flush()
@@ -401,7 +502,10 @@ class HALController:
                     frame = cv2.rotate(frame, cv2.ROTATE_180)
 
                 # Store the latest frame for debug display
-                self.pending_snapshot = frame.copy()
+                snapshot = frame.copy()
+                self.camera_frame_seq += 1
+                self.pending_snapshot_stamp = (snapshot, self.camera_frame_seq, capture_ms)
+                self.pending_snapshot = snapshot
 
                 # Sync current_state with conversation manager
                 try:
@@ -624,9 +728,19 @@ class HALController:
         Args:
             size: Optional size to resize the image (square output)
         """
-        if self.pending_snapshot is not None:
-            frame = self.pending_snapshot
+        return self.get_stamped_camera_frame(size)[0]
 
+    def get_stamped_camera_frame(self, size=None):
+        """Get the current camera frame as JPEG with its sequence number and capture time
+
+        Returns (jpeg, seq, capture_ms); seq and capture_ms (server_time_ms timebase) are
+        None for snapshots that did not come straight from the capture loop.
+        """
+        frame = self.pending_snapshot
+        stamp = self.pending_snapshot_stamp
+        seq, capture_ms = (stamp[1], stamp[2]) if stamp is not None and stamp[0] is frame else (None, None)
+
+        if frame is not None:
             # Resize if size specified
             if size is not None:
                 h, w = frame.shape[:2]
@@ -642,8 +756,8 @@ class HALController:
 
             ret, buffer = cv2.imencode('.jpg', frame, [cv2.IMWRITE_JPEG_QUALITY, 70])
             if ret:
-                return buffer.tobytes()
-        return None
+                return buffer.tobytes(), seq, capture_ms
+        return None, None, None
 
     def _recognize_face(self, frame):
         """Run face recognition on a frame"""
@@ -1150,6 +1264,11 @@ class HALController:
                     print(f"TTS generation failed for: {text}")
                     return
 
+            # Announce playback to the displays, then start exactly at the announced time
+            start_ms = self.schedule_display_state("speaking", wav_duration_s(audio_file),
+                                                   envelope=speech_envelope(audio_file))
+            time.sleep(max(0.0, (start_ms - server_time_ms()) / 1000.0))
+
             # Play audio
             subprocess.run(
                 ['aplay', '-D', self.audio_output_device, str(audio_file)],
@@ -1162,6 +1281,52 @@ class HALController:
         except Exception as e:
             print(f"Speech error: {e}")
 
+    def schedule_display_state(self, state, duration_s, lead_s=None, envelope=None):
+        """Schedule a display state for duration_s seconds, starting lead_s from now
+
+        lead_s defaults to display_event_lead_s(), one display poll ahead.
+
+        envelope is an optional speech_envelope() the display plays back in
+        step with the audio. Returns the start time on the server_time_ms()
+        timebase; the caller should begin playback at exactly that time.
+        """
+        import base64
+        if lead_s is None:
+            lead_s = display_event_lead_s()
+        start_ms = server_time_ms() + int(lead_s * 1000)
+        event = {
+            "id": 0,
+            "state": state,
+            "start_ms": start_ms,
+            "end_ms": start_ms + int(duration_s * 1000)
+        }
+        if envelope:
+            envelope, rate_hz = fit_envelope(envelope)
+            event["env"] = base64.b64encode(envelope).decode('ascii')
+            event["env_hz"] = rate_hz
+        with self.display_events_lock:
+            self.display_event_id += 1
+            event["id"] = self.display_event_id
+            self.display_events.append(event)
+        return start_ms
+
+    def get_display_events(self, known_id=0):
+        """Scheduled display state changes that are still pending or active
+
+        Envelopes are only included for events newer than known_id, so a
+        display downloads each one once.
+        """
+        now_ms = server_time_ms()
+        events = []
+        with self.display_events_lock:
+            for event in self.display_events:
+                if event["end_ms"] <= now_ms:
+                    continue
+                if event["id"] <= known_id and "env" in event:
+                    event = {k: v for k, v in event.items() if k not in ("env", "env_hz")}
+                events.append(event)
+        return events
+
     def get_status(self):
         """Get current status for ESP32"""
         conv_info = {}
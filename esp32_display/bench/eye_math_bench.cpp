@@ -0,0 +1,112 @@
+/**
+ * HAL eye animation maths microbenchmark (host)
+ *
+ * Compares the original float update_hal_eye() colour maths with the
+ * fixed-point table path from eye_math.h, and checks the two agree.
+ *
+ * Build and run from esp32_display/:
+ *   g++ -O2 -std=c++14 -I src bench/eye_math_bench.cpp -o eye_math_bench && ./eye_math_bench
+ *
+ * Host CPUs have fast hardware double precision, so the speedup here
+ * understates the gain on the ESP32-S3, where sin() runs in soft-float.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include "eye_math.h"
+
+#define FRAMES          2000000
+#define PERIOD_IDLE_MS  3142
+
+// The nine colours and one size update_hal_eye() produces per frame
+typedef struct {
+    uint16_t ring[EYE_RING_COUNT];
+    uint16_t glow;
+    uint16_t border;
+    uint16_t center;
+    int glow_size;
+} EyeColors;
+
+static const float ring_scale[EYE_RING_COUNT] = { 0.35f, 0.50f, 0.70f, 0.85f, 1.0f };
+
+// Original float path (PULSE_PERIOD_* form)
+static void eye_float(uint32_t now, uint32_t period, uint8_t base_r, uint8_t base_g, EyeColors *out)
+{
+    uint32_t phase_ms = now % period;
+    float pulse = (sin(phase_ms * (2 * M_PI / period)) * 0.5f) + 0.5f;
+    float brightness = 0.7f + (pulse * 0.3f);
+    out->glow_size = 310 + (int)(pulse * 20);
+    out->glow = eye_rgb565((uint8_t)(40 * brightness), 0, 0);
+    for (int r = 0; r < EYE_RING_COUNT; r++) {
+        out->ring[r] = eye_rgb565((uint8_t)(base_r * ring_scale[r] * brightness),
+                                  (uint8_t)(base_g * ring_scale[r] * brightness), 0);
+    }
+    out->border = eye_rgb565(255, (uint8_t)(50 + pulse * 30), 0);
+    out->center = eye_rgb565(255, 180 + (uint8_t)(pulse * 40), 0);
+}
+
+// Fixed-point table path
+static void eye_fixed(uint32_t now, uint32_t period, int palette, EyeColors *out)
+{
+    uint8_t pulse = eye_pulse_at(now % period, period);
+    uint8_t level = eye_level(EYE_PULSE_BRIGHTNESS[pulse]);
+    out->glow_size = 310 + ((pulse * 20) >> 8);
+    out->glow = EYE_GLOW_COLOR[level];
+    for (int r = 0; r < EYE_RING_COUNT; r++) {
+        out->ring[r] = EYE_PALETTE[palette][r][level];
+    }
+    out->border = EYE_BORDER_COLOR[pulse >> 2];
+    out->center = EYE_CENTER_COLOR[pulse >> 2];
+}
+
+static int channel_error(uint16_t a, uint16_t b)
+{
+    int dr = abs((a >> 11) - (b >> 11));
+    int dg = abs(((a >> 5) & 0x3F) - ((b >> 5) & 0x3F));
+    int db = abs((a & 0x1F) - (b & 0x1F));
+    return dr > dg ? (dr > db ? dr : db) : (dg > db ? dg : db);
+}
+
+int main(void)
+{
+    EyeColors f, x;
+    volatile uint32_t sink = 0;
+
+    // Agreement over one full period, in RGB565 steps
+    int worst = 0;
+    for (uint32_t t = 0; t < PERIOD_IDLE_MS; t++) {
+        eye_float(t, PERIOD_IDLE_MS, 204, 0, &f);
+        eye_fixed(t, PERIOD_IDLE_MS, EYE_PALETTE_IDLE, &x);
+        for (int r = 0; r < EYE_RING_COUNT; r++) {
+            int e = channel_error(f.ring[r], x.ring[r]);
+            worst = e > worst ? e : worst;
+        }
+        int e = channel_error(f.glow, x.glow);
+        worst = e > worst ? e : worst;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < FRAMES; i++) {
+        eye_float(i * 33, PERIOD_IDLE_MS, 204, 0, &f);
+        sink = sink + f.ring[2] + f.glow_size;
+    }
+    auto mid = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < FRAMES; i++) {
+        eye_fixed(i * 33, PERIOD_IDLE_MS, EYE_PALETTE_IDLE, &x);
+        sink = sink + x.ring[2] + x.glow_size;
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double float_ns = std::chrono::duration<double, std::nano>(mid - start).count() / FRAMES;
+    double fixed_ns = std::chrono::duration<double, std::nano>(end - mid).count() / FRAMES;
+
+    printf("eye maths per frame: float %.1f ns, fixed %.1f ns (%.1fx)\n", float_ns, fixed_ns, float_ns / fixed_ns);
+    printf("max colour difference: %d RGB565 step(s)\n", worst);
+    printf("table footprint: %u bytes\n", (unsigned)(sizeof(EYE_SINE_PULSE) + sizeof(EYE_EASE) + sizeof(EYE_PULSE_BRIGHTNESS) +
+           sizeof(EYE_ENVELOPE_BRIGHTNESS) + sizeof(EYE_PALETTE) + sizeof(EYE_GLOW_COLOR) +
+           sizeof(EYE_BORDER_COLOR) + sizeof(EYE_CENTER_COLOR)));
+    (void)sink;
+    return 0;
+}
@@ -0,0 +1,353 @@
+/**
+ * Pixel kernel benchmarks (host and device)
+ *
+ * Times the display's pixel-moving kernels on a 480x480 frame:
+ *  - rotate_copy_pixel at 0/90/180/270 degrees, per pixel format, and the
+ *    optimized RGB565 transpose at several block sizes
+ *  - flush_dirty_copy with the dirty-area sets the eye and face modes produce
+ *  - face_blit, the block copy behind tft_output(), at JPEG MCU block sizes
+ *  - pixel_blend, the cross-fade of mode transitions, over the visible disc
+ *    and the whole frame
+ * and prints time per run, cycles per pixel and MB/s written.
+ *
+ * Host, from esp32_display/:
+ *   g++ -O2 -std=c++14 -I src bench/pixel_bench.cpp -o pixel_bench && ./pixel_bench
+ *
+ * Device (buffers in PSRAM, like the panel frame buffers):
+ *   pio run -e bench -t upload -t monitor
+ *
+ * "0 deg" is a plain row copy, the baseline every rotation is compared to.
+ * Cycles come from the CPU cycle counter on the ESP32-S3 and from the TSC
+ * on x86 hosts (shown as "-" elsewhere).
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "lvgl_port_pixel.h"
+#include "face_blit.h"
+#include "pixel_blend.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#else
+#include <stdlib.h>
+#include <chrono>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_CYCLES 1
+#endif
+#endif
+
+#define FRAME_W         480
+#define FRAME_H         480
+#define BENCH_RUNS      5
+#define BENCH_MIN_NS    2000000ULL     // Repeat short kernels until a run takes at least this long
+
+using namespace lvgl_port_pixel;
+
+/* Platform */
+
+static uint64_t now_ns(void)
+{
+#ifdef ARDUINO
+    return (uint64_t)esp_timer_get_time() * 1000ULL;
+#else
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+static uint64_t now_cycles(void)
+{
+#if defined(ARDUINO)
+    return ESP.getCycleCount();
+#elif defined(BENCH_HAVE_CYCLES)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static bool have_cycles(void)
+{
+#if defined(ARDUINO) || defined(BENCH_HAVE_CYCLES)
+    return true;
+#else
+    return false;
+#endif
+}
+
+static void *bench_alloc(size_t size)
+{
+#ifdef ARDUINO
+    return heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+#else
+    return malloc(size);
+#endif
+}
+
+/* Harness */
+
+// Source and destination frames, 4 bytes per pixel so every format fits
+static uint8_t *src_frame = NULL;
+static uint8_t *dst_frame = NULL;
+
+template <typename Kernel>
+static void bench(const char *name, uint32_t pixels, uint32_t bytes_per_pixel, Kernel kernel)
+{
+    // Warm up caches and size the repeat count from one call
+    uint64_t t0 = now_ns();
+    kernel();
+    uint64_t single = now_ns() - t0;
+    uint32_t reps = (single >= BENCH_MIN_NS) ? 1 : (uint32_t)(BENCH_MIN_NS / (single + 1)) + 1;
+
+    uint64_t best_ns = UINT64_MAX;
+    uint64_t best_cycles = 0;
+    for (int run = 0; run < BENCH_RUNS; run++) {
+        uint64_t c = now_cycles();
+        uint64_t t = now_ns();
+        for (uint32_t i = 0; i < reps; i++) {
+            kernel();
+        }
+        uint64_t ns = now_ns() - t;
+        uint64_t cycles = (uint32_t)(now_cycles() - c);     // The S3 counter is 32 bits
+        if (ns < best_ns) {
+            best_ns = ns;
+            best_cycles = cycles;
+        }
+    }
+
+    double ns_per_run = (double)best_ns / reps;
+    double mb_per_s = (double)pixels * bytes_per_pixel / (ns_per_run / 1e9) / 1e6;
+    if (have_cycles()) {
+        printf("%-44s %8u %10.1f %8.2f %9.1f\n", name, (unsigned)pixels, ns_per_run / 1000.0,
+               (double)best_cycles / reps / pixels, mb_per_s);
+    } else {
+        printf("%-44s %8u %10.1f %8s %9.1f\n", name, (unsigned)pixels, ns_per_run / 1000.0, "-", mb_per_s);
+    }
+}
+
+static void print_header(const char *section)
+{
+    printf("\n%s\n", section);
+    printf("%-44s %8s %10s %8s %9s\n", "kernel", "pixels", "us/run", "cyc/px", "MB/s");
+}
+
+/* rotate_copy_pixel */
+
+// Row copy of the whole frame: what a 0 degree flush costs
+template <int BPP, int FROM_BYTES>
+static void copy_0_deg(void)
+{
+    const int to_bytes = BPP >> 3;
+    for (int y = 0; y < FRAME_H; y++) {
+        const uint8_t *from = src_frame + y * FRAME_W * FROM_BYTES;
+        uint8_t *to = dst_frame + y * FRAME_W * to_bytes;
+        if (FROM_BYTES == to_bytes) {
+            memcpy(to, from, FRAME_W * to_bytes);
+        } else {
+            for (int x = 0; x < FRAME_W; x++) {
+                copy_pixel<BPP>(to + x * to_bytes, from + x * FROM_BYTES);
+            }
+        }
+    }
+}
+
+template <int BPP, int FROM_BYTES, bool OPTIMIZED, int BLOCK_W = 32, int BLOCK_H = 256>
+static void bench_rotate(const char *format)
+{
+    char name[64];
+    const uint32_t pixels = FRAME_W * FRAME_H;
+
+    // The optimized path only changes 90/270, so its baseline is the generic one
+    if (!OPTIMIZED) {
+        snprintf(name, sizeof(name), "rotate %s 0 deg (row copy)", format);
+        bench(name, pixels, BPP >> 3, copy_0_deg<BPP, FROM_BYTES>);
+    }
+
+    static const uint16_t angles[] = { 90, 180, 270 };
+    for (uint16_t angle : angles) {
+        snprintf(name, sizeof(name), "rotate %s %u deg", format, (unsigned)angle);
+        bench(name, pixels, BPP >> 3, [angle]() {
+            rotate_copy_pixel<BPP, FROM_BYTES, OPTIMIZED, BLOCK_W, BLOCK_H>(
+                src_frame, dst_frame, 0, 0, FRAME_W - 1, FRAME_H - 1, FRAME_W, FRAME_H, angle);
+        });
+    }
+}
+
+template <int BLOCK_W, int BLOCK_H>
+static void bench_transpose_block(void)
+{
+    char name[64];
+    snprintf(name, sizeof(name), "rotate 16bpp opt 90 deg, block %dx%d", BLOCK_W, BLOCK_H);
+    bench(name, FRAME_W * FRAME_H, 2, []() {
+        rotate_copy_pixel<16, 2, true, BLOCK_W, BLOCK_H>(
+            src_frame, dst_frame, 0, 0, FRAME_W - 1, FRAME_H - 1, FRAME_W, FRAME_H, 90);
+    });
+}
+
+/* flush_dirty_copy */
+
+typedef struct {
+    int16_t x1, y1, x2, y2;
+} BenchArea;
+
+#define BENCH_MAX_AREAS 4
+
+typedef struct {
+    const char *name;
+    uint16_t inv_p;
+    uint8_t inv_area_joined[BENCH_MAX_AREAS];
+    BenchArea inv_areas[BENCH_MAX_AREAS];
+} BenchDirtySet;
+
+// Centre of the screen is (240, 240); the eye's outer glow peaks at 330 px across
+static const BenchDirtySet DIRTY_SETS[] = {
+    { "eye frame (glow + rings)", 1, { 0 }, { { 75, 75, 404, 404 } } },
+    { "eye frame + status label", 2, { 0, 0 }, { { 75, 75, 404, 404 }, { 160, 420, 319, 439 } } },
+    { "status label only", 1, { 0 }, { { 160, 420, 319, 439 } } },
+    { "label joined into eye", 2, { 0, 1 }, { { 75, 75, 404, 439 }, { 160, 420, 319, 439 } } },
+    { "face frame (full screen)", 1, { 0 }, { { 0, 0, FRAME_W - 1, FRAME_H - 1 } } },
+};
+
+static uint32_t dirty_pixels(const BenchDirtySet *set)
+{
+    uint32_t pixels = 0;
+    for (int i = 0; i < set->inv_p; i++) {
+        if (set->inv_area_joined[i] == 0) {
+            const BenchArea *a = &set->inv_areas[i];
+            pixels += (a->x2 - a->x1 + 1) * (a->y2 - a->y1 + 1);
+        }
+    }
+    return pixels;
+}
+
+template <bool OPTIMIZED>
+static void bench_dirty_copy(const char *variant)
+{
+    char name[64];
+    for (const BenchDirtySet &set : DIRTY_SETS) {
+        snprintf(name, sizeof(name), "dirty %s: %s", variant, set.name);
+        const BenchDirtySet *s = &set;
+        bench(name, dirty_pixels(s), 2, [s]() {
+            flush_dirty_copy<16, 2, OPTIMIZED>(dst_frame, src_frame, s, FRAME_W, FRAME_H, 90);
+        });
+    }
+}
+
+/* tft_output */
+
+static void bench_face_blit(int block, int16_t x_offset)
+{
+    char name[64];
+    static uint16_t bitmap[16 * 16];
+    for (int i = 0; i < 16 * 16; i++) {
+        bitmap[i] = (uint16_t)(i * 2654435761u >> 16);
+    }
+
+    snprintf(name, sizeof(name), "face_blit %dx%d blocks%s", block, block, x_offset ? ", clipped" : "");
+    bench(name, FRAME_W * FRAME_H, 2, [block, x_offset]() {
+        for (int y = 0; y < FRAME_H; y += block) {
+            for (int x = 0; x < FRAME_W; x += block) {
+                face_blit((uint16_t *)dst_frame, FRAME_W, FRAME_H, x + x_offset, y, block, block, bitmap);
+            }
+        }
+    });
+}
+
+/* Mode transitions */
+
+static void bench_blend(const char *name, uint32_t alpha, bool disc)
+{
+    static PixelSpan disc_spans[FRAME_H];
+    static PixelSpan full_spans[FRAME_H];
+    pixel_disc_spans(disc_spans, FRAME_W, FRAME_H);
+    for (int y = 0; y < FRAME_H; y++) {
+        full_spans[y].x0 = 0;
+        full_spans[y].x1 = FRAME_W;
+    }
+
+    const PixelSpan *spans = disc ? disc_spans : full_spans;
+    uint32_t pixels = 0;
+    for (int y = 0; y < FRAME_H; y++) {
+        pixels += spans[y].x1 - spans[y].x0;
+    }
+    // Both inputs come from the source frame, which has room for two RGB565 frames
+    const uint16_t *a = (const uint16_t *)src_frame;
+    const uint16_t *b = a + FRAME_W * FRAME_H;
+    bench(name, pixels, 2, [a, b, spans, alpha]() {
+        pixel_blend_disc((uint16_t *)dst_frame, a, b, FRAME_W, FRAME_H, spans, alpha);
+    });
+}
+
+/* Entry points */
+
+static void pixel_bench_run(void)
+{
+    src_frame = (uint8_t *)bench_alloc(FRAME_W * FRAME_H * 4);
+    dst_frame = (uint8_t *)bench_alloc(FRAME_W * FRAME_H * 4);
+    if (src_frame == NULL || dst_frame == NULL) {
+        printf("Cannot allocate %d x %d frames\n", FRAME_W, FRAME_H);
+        return;
+    }
+    for (int i = 0; i < FRAME_W * FRAME_H * 4; i++) {
+        src_frame[i] = (uint8_t)(i * 31 + 7);
+    }
+
+    printf("Pixel kernel benchmarks, %dx%d frame, best of %d runs\n", FRAME_W, FRAME_H, BENCH_RUNS);
+
+    print_header("rotate_copy_pixel, full frame");
+    bench_rotate<8, 1, false>("8bpp");
+    bench_rotate<16, 2, false>("16bpp generic");
+    bench_rotate<16, 2, true>("16bpp opt");
+    bench_rotate<24, 4, false>("24bpp");
+
+    print_header("Optimized RGB565 transpose block sizes");
+    bench_transpose_block<16, 16>();
+    bench_transpose_block<32, 32>();
+    bench_transpose_block<32, 256>();
+    bench_transpose_block<64, 64>();
+    bench_transpose_block<128, 32>();
+    bench_transpose_block<480, 8>();
+
+    print_header("flush_dirty_copy, 16bpp, 90 deg (cyc/px and MB/s per dirty pixel)");
+    bench_dirty_copy<false>("generic");
+    bench_dirty_copy<true>("opt");
+
+    print_header("tft_output block copy (face_blit)");
+    bench_face_blit(8, 0);
+    bench_face_blit(16, 0);
+    bench_face_blit(16, 8);
+
+    print_header("Mode transition cross-fade (pixel_blend_disc, RGB565)");
+    bench_blend("blend full frame, alpha 13/32", 13, false);
+    bench_blend("blend disc, alpha 13/32", 13, true);
+    bench_blend("blend disc, alpha 32/32 (copy)", PIXEL_BLEND_ALPHA_MAX, true);
+}
+
+#ifdef ARDUINO
+
+void setup()
+{
+    Serial.begin(115200);
+    delay(2000);
+    pixel_bench_run();
+}
+
+void loop()
+{
+    delay(1000);
+}
+
+#else
+
+int main()
+{
+    pixel_bench_run();
+    return 0;
+}
+
+#endif
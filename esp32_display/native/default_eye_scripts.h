@@ -0,0 +1,32 @@
+/**
+ * The backend's default eye scripts for the host (native) build
+ *
+ * EYE_SCRIPTS from backend/eye_scripts.py as timelines: what every display
+ * draws once it has fetched /api/hal/eye_script, in place of the built-in
+ * pulse. The host renderer and the golden tests use them so the keyframe
+ * path that runs in production is covered. Keep in step with the backend.
+ */
+
+#ifndef DEFAULT_EYE_SCRIPTS_H
+#define DEFAULT_EYE_SCRIPTS_H
+
+#include "eye_timeline.h"
+
+// _pulse() in eye_scripts.py: dim 179 to bright 255 and back, glow growing by 20 px at the peak
+#define DEFAULT_EYE_PULSE(r, g, b, period_ms)                                       \
+    {                                                                               \
+        3, 0, (period_ms),                                                          \
+        {                                                                           \
+            { 0, (r), (g), (b), 0, 179, EYE_EASE_IN_OUT },                          \
+            { (period_ms) / 2, (r), (g), (b), 20, 255, EYE_EASE_IN_OUT },           \
+            { (period_ms), (r), (g), (b), 0, 179, EYE_EASE_IN_OUT },                \
+        },                                                                          \
+    }
+
+static const EyeTimeline DEFAULT_EYE_SCRIPTS[EYE_STATE_COUNT] = {
+    DEFAULT_EYE_PULSE(204, 0, 0, 3142),     // idle
+    DEFAULT_EYE_PULSE(255, 0, 0, 1047),     // listening
+    DEFAULT_EYE_PULSE(255, 51, 0, 1571),    // speaking
+};
+
+#endif // DEFAULT_EYE_SCRIPTS_H
@@ -0,0 +1,80 @@
+/**
+ * Headless LVGL display for the host (native) build - see headless_display.h
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "headless_display.h"
+
+#define HEADLESS_BUFFER_LINES   48
+
+static uint16_t framebuffer[HEADLESS_WIDTH * HEADLESS_HEIGHT];
+static lv_color_t draw_buffer[HEADLESS_WIDTH * HEADLESS_BUFFER_LINES];
+static lv_disp_draw_buf_t draw_buf;
+static lv_disp_drv_t disp_drv;
+static lv_disp_t *disp = NULL;
+
+static void headless_flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
+{
+    int w = area->x2 - area->x1 + 1;
+    for (int y = area->y1; y <= area->y2; y++) {
+        for (int x = 0; x < w; x++) {
+            framebuffer[y * HEADLESS_WIDTH + area->x1 + x] = color_map[(y - area->y1) * w + x].full;
+        }
+    }
+    lv_disp_flush_ready(drv);
+}
+
+void headless_display_init(void)
+{
+    if (disp != NULL) {
+        return;
+    }
+
+    lv_init();
+
+    // Same partial buffering as the panel, so refresh behaviour matches the device
+    lv_disp_draw_buf_init(&draw_buf, draw_buffer, NULL, HEADLESS_WIDTH * HEADLESS_BUFFER_LINES);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = HEADLESS_WIDTH;
+    disp_drv.ver_res = HEADLESS_HEIGHT;
+    disp_drv.flush_cb = headless_flush;
+    disp_drv.draw_buf = &draw_buf;
+    disp = lv_disp_drv_register(&disp_drv);
+}
+
+void headless_display_refresh(void)
+{
+    lv_refr_now(disp);
+}
+
+const uint16_t *headless_display_framebuffer(void)
+{
+    return framebuffer;
+}
+
+bool headless_display_write_ppm(const char *path)
+{
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) {
+        return false;
+    }
+
+    fprintf(f, "P6\n%d %d\n255\n", HEADLESS_WIDTH, HEADLESS_HEIGHT);
+    uint8_t row[HEADLESS_WIDTH * 3];
+    for (int y = 0; y < HEADLESS_HEIGHT; y++) {
+        for (int x = 0; x < HEADLESS_WIDTH; x++) {
+            uint16_t c = framebuffer[y * HEADLESS_WIDTH + x];
+            // Expand RGB565 to 8 bits per channel, replicating the high bits
+            uint8_t r = (c >> 11) & 0x1F;
+            uint8_t g = (c >> 5) & 0x3F;
+            uint8_t b = c & 0x1F;
+            row[x * 3 + 0] = (r << 3) | (r >> 2);
+            row[x * 3 + 1] = (g << 2) | (g >> 4);
+            row[x * 3 + 2] = (b << 3) | (b >> 2);
+        }
+        fwrite(row, 1, sizeof(row), f);
+    }
+
+    return fclose(f) == 0;
+}
@@ -0,0 +1,30 @@
+/**
+ * Headless LVGL display for the host (native) build
+ *
+ * Registers an LVGL display whose flush callback copies into an in-memory
+ * RGB565 frame buffer, so the firmware's rendering code can be run,
+ * profiled and compared on a workstation.
+ */
+
+#ifndef HEADLESS_DISPLAY_H
+#define HEADLESS_DISPLAY_H
+
+#include <stdint.h>
+#include <lvgl.h>
+
+#define HEADLESS_WIDTH      480
+#define HEADLESS_HEIGHT     480
+
+// Initialise LVGL and register the in-memory display (safe to call more than once)
+void headless_display_init(void);
+
+// Render every pending invalidation into the frame buffer now
+void headless_display_refresh(void);
+
+// HEADLESS_WIDTH x HEADLESS_HEIGHT RGB565 pixels, row major
+const uint16_t *headless_display_framebuffer(void);
+
+// Write the frame buffer as a binary PPM (P6); returns false on I/O errors
+bool headless_display_write_ppm(const char *path);
+
+#endif // HEADLESS_DISPLAY_H
@@ -0,0 +1,129 @@
+/**
+ * HAL 9000 display renderer - host (native) build
+ *
+ * Runs the firmware's eye and face rendering against the headless LVGL
+ * display: writes a PPM per eye state and pulse phase, optionally decodes
+ * a JPEG through tft_output(), then times a run of eye frames. Handy
+ * under perf and valgrind.
+ *
+ *   pio run -e native
+ *   .pio/build/native/program [out_dir] [face.jpg]
+ */
+
+#ifndef PIO_UNIT_TESTING
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <Arduino.h>
+#include <TJpg_Decoder.h>
+#include "headless_display.h"
+#include "hal_eye.h"
+#include "face_view.h"
+#include "default_eye_scripts.h"
+
+#define BENCH_FRAMES    1000
+
+static const char *const STATE_NAMES[EYE_STATE_COUNT] = { "idle", "listening", "speaking" };
+static const uint32_t STATE_PERIODS[EYE_STATE_COUNT] = {
+    PULSE_PERIOD_IDLE_MS, PULSE_PERIOD_LISTENING_MS, PULSE_PERIOD_SPEAKING_MS
+};
+
+// script NULL draws the built-in pulse at now_ms, otherwise the script at now_ms into it
+static void render_eye(EyeTimelineState state, int64_t now_ms, const EyeTimeline *script = NULL)
+{
+    HalEyeInput input;
+    input.state = state;
+    input.now_ms = now_ms;
+    input.script = script;
+    input.script_elapsed_ms = now_ms;
+    input.envelope_level = -1;
+    hal_eye_render(&input);
+    headless_display_refresh();
+}
+
+static bool render_jpeg(const char *path, const char *out_dir)
+{
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return false;
+    }
+    fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *jpeg = (uint8_t *)malloc(len);
+    bool ok = (jpeg != NULL) && (fread(jpeg, 1, len, f) == (size_t)len);
+    fclose(f);
+
+    // Same decoder setup and view switch as the firmware's face mode
+    if (ok) {
+        hal_eye_set_visible(false);
+        face_view_set_visible(true);
+        ok = (TJpgDec.drawJpg(0, 0, jpeg, len) == 1);
+        face_view_invalidate();
+        headless_display_refresh();
+    }
+    free(jpeg);
+
+    char out[512];
+    snprintf(out, sizeof(out), "%s/face.ppm", out_dir);
+    ok = ok && headless_display_write_ppm(out);
+    printf("%s -> %s: %s\n", path, out, ok ? "ok" : "FAILED");
+
+    face_view_set_visible(false);
+    hal_eye_set_visible(true);
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    const char *out_dir = (argc > 1) ? argv[1] : ".";
+    const char *jpeg_path = (argc > 2) ? argv[2] : NULL;
+    char path[512];
+
+    headless_display_init();
+    lv_obj_set_style_bg_color(lv_scr_act(), lv_color_black(), 0);
+    hal_eye_create(lv_scr_act());
+    face_view_create(lv_scr_act());
+
+    TJpgDec.setJpgScale(1);
+    TJpgDec.setSwapBytes(true);
+    TJpgDec.setCallback(tft_output);
+
+    // Every state at four points of its pulse, built in and from the backend's default script
+    for (int state = 0; state < EYE_STATE_COUNT; state++) {
+        for (int quarter = 0; quarter < 4; quarter++) {
+            render_eye((EyeTimelineState)state, STATE_PERIODS[state] * quarter / 4);
+            snprintf(path, sizeof(path), "%s/eye_%s_%d.ppm", out_dir, STATE_NAMES[state], quarter * 25);
+            if (!headless_display_write_ppm(path)) {
+                fprintf(stderr, "Cannot write %s\n", path);
+                return 1;
+            }
+
+            const EyeTimeline *script = &DEFAULT_EYE_SCRIPTS[state];
+            render_eye((EyeTimelineState)state, script->loop_end_ms * quarter / 4, script);
+            snprintf(path, sizeof(path), "%s/eye_script_%s_%d.ppm", out_dir, STATE_NAMES[state], quarter * 25);
+            if (!headless_display_write_ppm(path)) {
+                fprintf(stderr, "Cannot write %s\n", path);
+                return 1;
+            }
+        }
+    }
+    printf("Wrote eye frames to %s\n", out_dir);
+
+    if (jpeg_path != NULL && !render_jpeg(jpeg_path, out_dir)) {
+        return 1;
+    }
+
+    // Eye frames at 30fps spacing, rendered as fast as possible
+    uint64_t start_us = native_monotonic_us();
+    for (int i = 0; i < BENCH_FRAMES; i++) {
+        render_eye(EYE_STATE_IDLE, i * 33);
+    }
+    uint64_t elapsed_us = native_monotonic_us() - start_us;
+    printf("Eye: %d frames, %.3f ms/frame\n", BENCH_FRAMES, elapsed_us / 1000.0 / BENCH_FRAMES);
+
+    return 0;
+}
+
+#endif // PIO_UNIT_TESTING
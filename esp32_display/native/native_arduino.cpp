@@ -0,0 +1,9 @@
+/**
+ * Storage for the native Arduino shim - see shims/Arduino.h
+ */
+
+#include <Arduino.h>
+
+int64_t native_pinned_ms = -1;
+
+NativeSerial Serial;
@@ -0,0 +1,88 @@
+/**
+ * Minimal Arduino core shim for the host (native) build
+ *
+ * Only what the rendering code, LVGL's tick (lv_conf.h) and TJpg_Decoder
+ * use. Time is real monotonic time unless a test pins it with
+ * native_set_millis().
+ */
+
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#define PROGMEM
+#define pgm_read_byte(addr)     (*(const uint8_t *)(addr))
+#define pgm_read_word(addr)     (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr)    (*(const uint32_t *)(addr))
+
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Pinned clock for repeatable renders, < 0 = real time (defined in native_arduino.cpp)
+extern int64_t native_pinned_ms;
+
+#ifdef __cplusplus
+}
+#endif
+
+static inline void native_set_millis(int64_t ms)
+{
+    native_pinned_ms = ms;
+}
+
+static inline uint64_t native_monotonic_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000ULL;
+}
+
+static inline unsigned long millis(void)
+{
+    return (native_pinned_ms >= 0) ? (unsigned long)native_pinned_ms : (unsigned long)(native_monotonic_us() / 1000);
+}
+
+static inline unsigned long micros(void)
+{
+    return (unsigned long)native_monotonic_us();
+}
+
+static inline void delay(unsigned long ms)
+{
+    struct timespec ts = { (time_t)(ms / 1000), (long)(ms % 1000) * 1000000L };
+    nanosleep(&ts, NULL);
+}
+
+static inline void yield(void)
+{
+}
+
+#ifdef __cplusplus
+// Serial prints to stdout
+class NativeSerial {
+public:
+    void begin(unsigned long) {}
+    void print(const char *s) { fputs(s, stdout); }
+    void print(int v) { printf("%d", v); }
+    void println(void) { fputs("\n", stdout); }
+    void println(const char *s) { puts(s); }
+    void println(int v) { printf("%d\n", v); }
+    template <typename... Args>
+    void printf(const char *fmt, Args... args) { ::printf(fmt, args...); }
+};
+
+extern NativeSerial Serial;
+#endif
+
+#endif // NATIVE_ARDUINO_H
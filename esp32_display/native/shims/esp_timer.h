@@ -0,0 +1,15 @@
+/**
+ * ESP-IDF esp_timer shim for the host (native) build
+ */
+
+#ifndef NATIVE_ESP_TIMER_H
+#define NATIVE_ESP_TIMER_H
+
+#include <Arduino.h>
+
+static inline int64_t esp_timer_get_time(void)
+{
+    return (int64_t)native_monotonic_us();
+}
+
+#endif // NATIVE_ESP_TIMER_H
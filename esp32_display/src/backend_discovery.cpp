@@ -0,0 +1,297 @@
+/**
+ * HAL backend discovery over mDNS / DNS-SD - see backend_discovery.h
+ */
+
+#include <WiFi.h>
+#include <ESPmDNS.h>
+#include <HTTPClient.h>
+#include <Preferences.h>
+#include <esp_timer.h>
+#include "backend_discovery.h"
+#include "log_sink.h"
+#include "secrets.h"
+
+#define DISCOVERY_TASK_STACK        6144
+#define DISCOVERY_TASK_PRIORITY     1       // Above idle only, probing is never urgent
+#define BACKEND_HOST_MAX            40
+#define BACKEND_CACHE_NAMESPACE     "backend"
+
+enum BackendSource {
+    BACKEND_SOURCE_COMPILED,
+    BACKEND_SOURCE_CACHE,
+    BACKEND_SOURCE_MDNS
+};
+
+static const char *const SOURCE_NAMES[] = { "compiled", "cache", "mdns" };
+
+typedef struct {
+    char host[BACKEND_HOST_MAX];
+    uint16_t port;
+    uint8_t source;
+    int32_t rtt_us;                     // Median probe round trip, -1 if it did not answer
+} BackendCandidate;
+
+static TaskHandle_t discovery_task = NULL;
+
+// Shared between the discovery task and the loop, under discovery_mux
+static portMUX_TYPE discovery_mux = portMUX_INITIALIZER_UNLOCKED;
+static BackendCandidate selected;
+static bool selection_pending = false;
+static BackendCandidate candidates[BACKEND_MAX_CANDIDATES];
+static int candidate_count = 0;
+static uint32_t runs = 0;
+static uint32_t failovers = 0;
+
+// Loop task only
+static uint8_t consecutive_failures = 0;
+
+static void candidate_set(BackendCandidate *c, const char *host, uint16_t port, uint8_t source)
+{
+    strlcpy(c->host, host, sizeof(c->host));
+    c->port = port;
+    c->source = source;
+    c->rtt_us = -1;
+}
+
+static void add_candidate(BackendCandidate *list, int *count, const char *host, uint16_t port, uint8_t source)
+{
+    if (host[0] == '\0' || port == 0 || *count >= BACKEND_MAX_CANDIDATES) {
+        return;
+    }
+    for (int i = 0; i < *count; i++) {
+        if (list[i].port == port && strcmp(list[i].host, host) == 0) {
+            return;
+        }
+    }
+    candidate_set(&list[(*count)++], host, port, source);
+}
+
+// Median of BACKEND_PROBES /api/hal/ping round trips, -1 if none succeeded
+static int32_t probe(const BackendCandidate *c)
+{
+    int32_t rtts[BACKEND_PROBES];
+    int ok = 0;
+    String url = "http://" + String(c->host) + ":" + String(c->port) + "/api/hal/ping";
+
+    for (int i = 0; i < BACKEND_PROBES; i++) {
+        HTTPClient http;
+        http.setConnectTimeout(BACKEND_PROBE_TIMEOUT_MS);
+        http.setTimeout(BACKEND_PROBE_TIMEOUT_MS);
+        int64_t start_us = esp_timer_get_time();
+        http.begin(url);
+        int code = http.GET();
+        // Anything else listening on that port does not count
+        if (code == 200 && http.getString().indexOf(BACKEND_SERVICE) >= 0) {
+            rtts[ok++] = (int32_t)(esp_timer_get_time() - start_us);
+        }
+        http.end();
+        if (code < 0) {
+            break;                      // Unreachable, no point waiting for more timeouts
+        }
+    }
+
+    if (ok == 0) {
+        return -1;
+    }
+    for (int i = 1; i < ok; i++) {
+        for (int j = i; j > 0 && rtts[j] < rtts[j - 1]; j--) {
+            int32_t t = rtts[j];
+            rtts[j] = rtts[j - 1];
+            rtts[j - 1] = t;
+        }
+    }
+    return rtts[ok / 2];
+}
+
+static void cache_store(const BackendCandidate *c)
+{
+    Preferences prefs;
+    if (!prefs.begin(BACKEND_CACHE_NAMESPACE, false)) {
+        return;
+    }
+    prefs.putString("host", c->host);
+    prefs.putUShort("port", c->port);
+    prefs.end();
+}
+
+static void run_discovery(void)
+{
+    BackendCandidate found[BACKEND_MAX_CANDIDATES];
+    int count = 0;
+
+    portENTER_CRITICAL(&discovery_mux);
+    BackendCandidate current = selected;
+    portEXIT_CRITICAL(&discovery_mux);
+
+    // The current backend first, so it wins ties and is revalidated even when it is not advertised
+    add_candidate(found, &count, current.host, current.port, current.source);
+    int results = MDNS.queryService(BACKEND_SERVICE, "tcp");
+    for (int i = 0; i < results; i++) {
+        add_candidate(found, &count, MDNS.IP(i).toString().c_str(), MDNS.port(i), BACKEND_SOURCE_MDNS);
+    }
+    add_candidate(found, &count, HAL_API_HOST, HAL_API_PORT, BACKEND_SOURCE_COMPILED);
+
+    int best = -1;
+    for (int i = 0; i < count; i++) {
+        found[i].rtt_us = probe(&found[i]);
+        if (found[i].rtt_us >= 0 && (best < 0 || found[i].rtt_us < found[best].rtt_us)) {
+            best = i;
+        }
+    }
+
+    // Stay with the current backend while it answers, unless another one is clearly faster
+    if (best > 0 && found[0].rtt_us >= 0) {
+        int32_t margin_us = found[0].rtt_us * BACKEND_SWITCH_MARGIN_PCT / 100;
+        if (margin_us < BACKEND_SWITCH_MARGIN_US) {
+            margin_us = BACKEND_SWITCH_MARGIN_US;
+        }
+        if (found[best].rtt_us + margin_us > found[0].rtt_us) {
+            best = 0;
+        }
+    }
+
+    bool changed = (best >= 0) && (found[best].port != current.port || strcmp(found[best].host, current.host) != 0);
+    bool current_alive = (found[0].rtt_us >= 0);
+
+    portENTER_CRITICAL(&discovery_mux);
+    memcpy(candidates, found, sizeof(found[0]) * count);
+    candidate_count = count;
+    runs++;
+    if (best >= 0) {
+        selected = found[best];
+        selection_pending = selection_pending || changed;
+    } else {
+        selected.rtt_us = -1;
+    }
+    if (changed && !current_alive) {
+        failovers++;
+    }
+    portEXIT_CRITICAL(&discovery_mux);
+
+    if (changed) {
+        cache_store(&found[best]);
+        LOG("Backend %s:%d (%s, %ld us)%s", found[best].host, found[best].port, SOURCE_NAMES[found[best].source],
+            (long)found[best].rtt_us, current_alive ? "" : ", failed over");
+    } else if (best < 0) {
+        LOG_EVERY_MS(BACKEND_REFRESH_MS, "No backend answering (%d candidates, %d advertised)", count, results);
+    }
+}
+
+static void discovery_task_fn(void *arg)
+{
+    // Announce ourselves too, so the diagnostics server is reachable as hal-display-xxxxxx.local
+    char name[24];
+    snprintf(name, sizeof(name), "hal-display-%06lx", (unsigned long)(ESP.getEfuseMac() & 0xFFFFFF));
+    if (MDNS.begin(name)) {
+        MDNS.addService("http", "tcp", 80);
+    }
+
+    while (true) {
+        uint32_t started = millis();
+        run_discovery();
+
+        // Sleep until the refresh is due, WiFi reconnects or the loop asks for a failover
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(BACKEND_REFRESH_MS));
+        uint32_t elapsed = millis() - started;
+        if (elapsed < BACKEND_MIN_RUN_INTERVAL_MS) {
+            vTaskDelay(pdMS_TO_TICKS(BACKEND_MIN_RUN_INTERVAL_MS - elapsed));
+        }
+    }
+}
+
+void backend_discovery_begin(String &host, int &port)
+{
+    candidate_set(&selected, host.c_str(), (uint16_t)port, BACKEND_SOURCE_COMPILED);
+
+    Preferences prefs;
+    if (!prefs.begin(BACKEND_CACHE_NAMESPACE, true)) {
+        return;
+    }
+    String cached_host = prefs.getString("host", "");
+    uint16_t cached_port = prefs.getUShort("port", 0);
+    prefs.end();
+
+    if (cached_host.length() > 0 && cached_port != 0) {
+        candidate_set(&selected, cached_host.c_str(), cached_port, BACKEND_SOURCE_CACHE);
+        host = cached_host;
+        port = cached_port;
+    }
+}
+
+void backend_discovery_start(void)
+{
+    if (discovery_task != NULL) {
+        xTaskNotifyGive(discovery_task);
+        return;
+    }
+    xTaskCreate(discovery_task_fn, "discovery", DISCOVERY_TASK_STACK, NULL, DISCOVERY_TASK_PRIORITY, &discovery_task);
+}
+
+bool backend_discovery_poll(String &host, int &port)
+{
+    char new_host[BACKEND_HOST_MAX];
+    uint16_t new_port;
+
+    portENTER_CRITICAL(&discovery_mux);
+    bool pending = selection_pending;
+    selection_pending = false;
+    memcpy(new_host, selected.host, sizeof(new_host));
+    new_port = selected.port;
+    portEXIT_CRITICAL(&discovery_mux);
+
+    if (!pending || (host == new_host && port == new_port)) {
+        return false;
+    }
+    host = new_host;
+    port = new_port;
+    consecutive_failures = 0;
+    return true;
+}
+
+void backend_discovery_report(bool ok)
+{
+    if (ok) {
+        consecutive_failures = 0;
+        return;
+    }
+    if (++consecutive_failures < BACKEND_FAILOVER_FAILURES) {
+        return;
+    }
+    consecutive_failures = 0;
+    if (discovery_task != NULL) {
+        LOG_EVERY_MS(BACKEND_MIN_RUN_INTERVAL_MS, "Backend not answering, rediscovering");
+        xTaskNotifyGive(discovery_task);
+    }
+}
+
+void backend_discovery_report_json(JsonDocument &doc)
+{
+    BackendCandidate current;
+    BackendCandidate list[BACKEND_MAX_CANDIDATES];
+    int count;
+    uint32_t run_count, failover_count;
+
+    portENTER_CRITICAL(&discovery_mux);
+    current = selected;
+    count = candidate_count;
+    memcpy(list, candidates, sizeof(list[0]) * count);
+    run_count = runs;
+    failover_count = failovers;
+    portEXIT_CRITICAL(&discovery_mux);
+
+    JsonObject backend = doc["backend"].to<JsonObject>();
+    backend["host"] = current.host;
+    backend["port"] = current.port;
+    backend["source"] = SOURCE_NAMES[current.source];
+    backend["rtt_us"] = current.rtt_us;
+    backend["runs"] = run_count;
+    backend["failovers"] = failover_count;
+    JsonArray out = backend["candidates"].to<JsonArray>();
+    for (int i = 0; i < count; i++) {
+        JsonObject entry = out.add<JsonObject>();
+        entry["host"] = list[i].host;
+        entry["port"] = list[i].port;
+        entry["source"] = SOURCE_NAMES[list[i].source];
+        entry["rtt_us"] = list[i].rtt_us;
+    }
+}
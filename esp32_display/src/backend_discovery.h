@@ -0,0 +1,57 @@
+/**
+ * HAL backend discovery over mDNS / DNS-SD
+ *
+ * The backend advertises _hal9000._tcp (backend/discovery.py). Startup
+ * never waits for the network: the last backend that answered is cached in
+ * NVS and used straight away, falling back to HAL_API_HOST/HAL_API_PORT
+ * from secrets.h on first boot.
+ *
+ * Once WiFi is up a low-priority task browses for _hal9000._tcp and probes
+ * every candidate (the cached backend, each advertised one and the
+ * compiled-in address) with GET /api/hal/ping, keeping the median of a few
+ * round trips. The live candidate with the lowest RTT wins, but only
+ * replaces a live current backend if it is faster by BACKEND_SWITCH_MARGIN
+ * (two backends of similar RTT would otherwise swap on every refresh, and
+ * each swap resets the display's per-backend state). A change is handed to
+ * the loop through backend_discovery_poll() and written to NVS.
+ * Discovery runs again after a reconnect, every BACKEND_REFRESH_MS, and
+ * whenever requests to the current backend keep failing (failover).
+ *
+ * esp32_display/tools/mdns_standin.py advertises stand-in backends with
+ * configurable latency for testing this on a desk.
+ */
+
+#ifndef BACKEND_DISCOVERY_H
+#define BACKEND_DISCOVERY_H
+
+#include <stdint.h>
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#define BACKEND_SERVICE                 "hal9000"   // _hal9000._tcp
+#define BACKEND_MAX_CANDIDATES          6
+#define BACKEND_PROBES                  3           // Round trips per candidate, the median is kept
+#define BACKEND_PROBE_TIMEOUT_MS        1000
+#define BACKEND_FAILOVER_FAILURES       3           // Consecutive failed requests before rediscovering
+#define BACKEND_REFRESH_MS              (10 * 60 * 1000)
+#define BACKEND_MIN_RUN_INTERVAL_MS     10000       // Failures cannot trigger discovery more often than this
+#define BACKEND_SWITCH_MARGIN_US        2000        // A live current backend is only replaced by one faster by
+#define BACKEND_SWITCH_MARGIN_PCT       25          // both this much and this share of its RTT
+
+// Load the cached backend into host/port (left as they are if there is none); returns immediately
+void backend_discovery_begin(String &host, int &port);
+
+// Start the discovery task, or wake it to revalidate; call when WiFi (re)connects
+void backend_discovery_start(void);
+
+// Apply a newly selected backend to host/port; returns true if they changed, in which case everything learned
+// from the old backend (clock offset, event ids, script and config versions) is stale. Call from the loop
+bool backend_discovery_poll(String &host, int &port);
+
+// Outcome of a request to the current backend; repeated failures trigger a failover
+void backend_discovery_report(bool ok);
+
+// Add {"backend": {...}} (selection, candidates and their RTTs, counters) to doc
+void backend_discovery_report_json(JsonDocument &doc);
+
+#endif // BACKEND_DISCOVERY_H
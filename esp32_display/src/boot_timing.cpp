@@ -0,0 +1,78 @@
+/**
+ * Boot-phase timestamps - see boot_timing.h
+ */
+
+#include <esp_timer.h>
+#include "boot_timing.h"
+#include "log_sink.h"
+
+static const char *const PHASE_NAMES[BOOT_PHASE_COUNT] = {
+    "board_ready",
+    "first_pixel",
+    "ui_ready",
+    "first_frame",
+    "wifi_connected",
+    "online",
+};
+
+// ms since app start + 1, so 0 means "not reached"
+static uint32_t phase_ms[BOOT_PHASE_COUNT];
+
+static bool over_budget(BootPhase phase)
+{
+    int32_t ms = boot_timing_get_ms(phase);
+    if (phase == BOOT_PHASE_FIRST_PIXEL) {
+        return ms > BOOT_FIRST_PIXEL_BUDGET_MS;
+    }
+    if (phase == BOOT_PHASE_ONLINE) {
+        return ms > BOOT_ONLINE_BUDGET_MS;
+    }
+    return false;
+}
+
+void boot_timing_mark(BootPhase phase)
+{
+    uint32_t stamp = (uint32_t)(esp_timer_get_time() / 1000) + 1;
+    uint32_t expected = 0;
+    if (!__atomic_compare_exchange_n(&phase_ms[phase], &expected, stamp, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+        return;
+    }
+
+    LOG("Boot: %s at %lu ms%s", PHASE_NAMES[phase], (unsigned long)(stamp - 1),
+        over_budget(phase) ? " (over budget)" : "");
+}
+
+int32_t boot_timing_get_ms(BootPhase phase)
+{
+    uint32_t stamp = __atomic_load_n(&phase_ms[phase], __ATOMIC_RELAXED);
+    return stamp ? (int32_t)(stamp - 1) : -1;
+}
+
+void boot_timing_report(JsonDocument &doc)
+{
+    JsonObject boot = doc["boot"].to<JsonObject>();
+    JsonArray late = boot["over_budget"].to<JsonArray>();
+    for (int i = 0; i < BOOT_PHASE_COUNT; i++) {
+        int32_t ms = boot_timing_get_ms((BootPhase)i);
+        if (ms < 0) {
+            continue;
+        }
+        boot[String(PHASE_NAMES[i]) + "_ms"] = ms;
+        if (over_budget((BootPhase)i)) {
+            late.add(PHASE_NAMES[i]);
+        }
+    }
+}
+
+void boot_timing_write_text(Print &out)
+{
+    out.print("# TYPE hal_boot_ms gauge\n");
+    for (int i = 0; i < BOOT_PHASE_COUNT; i++) {
+        int32_t ms = boot_timing_get_ms((BootPhase)i);
+        if (ms >= 0) {
+            out.printf("hal_boot_ms{phase=\"%s\"} %ld\n", PHASE_NAMES[i], (long)ms);
+        }
+    }
+    out.printf("hal_boot_budget_ms{phase=\"first_pixel\"} %d\n", BOOT_FIRST_PIXEL_BUDGET_MS);
+    out.printf("hal_boot_budget_ms{phase=\"online\"} %d\n", BOOT_ONLINE_BUDGET_MS);
+}
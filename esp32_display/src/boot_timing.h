@@ -0,0 +1,45 @@
+/**
+ * Boot-phase timestamps
+ *
+ * Each phase of startup is stamped once, in milliseconds since the app
+ * started (esp_timer time, so the ROM and second-stage bootloader are not
+ * included). time-to-first-pixel is the splash reaching the panel,
+ * time-to-online the first successful backend poll. Both are checked
+ * against a budget, logged, posted with every metrics report and exported
+ * on /metrics, so a slow boot shows up as a regression rather than a feel.
+ */
+
+#ifndef BOOT_TIMING_H
+#define BOOT_TIMING_H
+
+#include <stdint.h>
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// Budgets for the two headline phases; exceeding one is flagged in the report
+#define BOOT_FIRST_PIXEL_BUDGET_MS  500
+#define BOOT_ONLINE_BUDGET_MS       8000
+
+enum BootPhase {
+    BOOT_PHASE_BOARD_READY,         // board->begin() returned, panel running
+    BOOT_PHASE_FIRST_PIXEL,         // Splash frame drawn
+    BOOT_PHASE_UI_READY,            // LVGL started and the eye created
+    BOOT_PHASE_FIRST_FRAME,         // First animated eye frame rendered
+    BOOT_PHASE_WIFI_CONNECTED,      // Station connected with an IP
+    BOOT_PHASE_ONLINE,              // First successful backend poll
+    BOOT_PHASE_COUNT
+};
+
+// Stamp phase with the current time; only the first call per phase counts. Safe from any task
+void boot_timing_mark(BootPhase phase);
+
+// Time phase was reached in ms since app start, or -1 if not yet
+int32_t boot_timing_get_ms(BootPhase phase);
+
+// Add {"boot": {"<phase>_ms": ..., "over_budget": [...]}} to doc
+void boot_timing_report(JsonDocument &doc);
+
+// Write hal_boot_ms{phase="..."} lines for /metrics
+void boot_timing_write_text(Print &out);
+
+#endif // BOOT_TIMING_H
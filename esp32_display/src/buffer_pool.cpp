@@ -0,0 +1,114 @@
+/**
+ * Shared pool of large PSRAM buffers - see buffer_pool.h
+ */
+
+#include <string.h>
+#include <esp_heap_caps.h>
+#include "buffer_pool.h"
+
+typedef struct {
+    void *ptr;
+    size_t bytes;
+    const char *owner;              // Last taker, kept while idle so a returning owner is preferred
+    bool in_use;
+} PoolBuffer;
+
+static PoolBuffer buffers[BUFFER_POOL_MAX_BUFFERS];
+static BufferPoolStats stats;
+
+static void release(PoolBuffer *b)
+{
+    heap_caps_free(b->ptr);
+    stats.resident_bytes -= b->bytes;
+    memset(b, 0, sizeof(*b));
+}
+
+void *buffer_pool_take(const char *owner, size_t bytes)
+{
+    // Smallest idle buffer that fits without wasting more than half of it, and drop the owner's idle
+    // buffers that no longer fit
+    PoolBuffer *best = NULL;
+    for (int i = 0; i < BUFFER_POOL_MAX_BUFFERS; i++) {
+        PoolBuffer *b = &buffers[i];
+        if (b->ptr == NULL || b->in_use) {
+            continue;
+        }
+        if (b->bytes >= bytes && b->bytes / 2 <= bytes) {
+            if (best == NULL || b->bytes < best->bytes) {
+                best = b;
+            }
+        } else if (b->owner == owner) {
+            release(b);
+        }
+    }
+    if (best != NULL) {
+        best->in_use = true;
+        best->owner = owner;
+        stats.in_use_bytes += best->bytes;
+        stats.reuses++;
+        return best->ptr;
+    }
+
+    PoolBuffer *slot = NULL;
+    for (int i = 0; i < BUFFER_POOL_MAX_BUFFERS && slot == NULL; i++) {
+        if (buffers[i].ptr == NULL) {
+            slot = &buffers[i];
+        }
+    }
+    void *ptr = slot != NULL ? heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM) : NULL;
+    if (ptr == NULL) {
+        stats.failures++;
+        return NULL;
+    }
+    slot->ptr = ptr;
+    slot->bytes = bytes;
+    slot->owner = owner;
+    slot->in_use = true;
+    stats.resident_bytes += bytes;
+    stats.in_use_bytes += bytes;
+    stats.allocations++;
+    if (stats.resident_bytes > stats.peak_resident_bytes) {
+        stats.peak_resident_bytes = stats.resident_bytes;
+    }
+    return ptr;
+}
+
+void buffer_pool_give(void *buf)
+{
+    if (buf == NULL) {
+        return;
+    }
+    for (int i = 0; i < BUFFER_POOL_MAX_BUFFERS; i++) {
+        if (buffers[i].ptr == buf && buffers[i].in_use) {
+            buffers[i].in_use = false;
+            stats.in_use_bytes -= buffers[i].bytes;
+            return;
+        }
+    }
+}
+
+void buffer_pool_trim(void)
+{
+    for (int i = 0; i < BUFFER_POOL_MAX_BUFFERS; i++) {
+        if (buffers[i].ptr != NULL && !buffers[i].in_use) {
+            release(&buffers[i]);
+        }
+    }
+}
+
+void buffer_pool_get_stats(BufferPoolStats *out)
+{
+    *out = stats;
+}
+
+bool buffer_pool_get_in_use(int i, const char **owner, size_t *bytes)
+{
+    for (int n = 0; n < BUFFER_POOL_MAX_BUFFERS; n++) {
+        if (buffers[n].ptr != NULL && buffers[n].in_use && i-- == 0) {
+            *owner = buffers[n].owner;
+            *bytes = buffers[n].bytes;
+            return true;
+        }
+    }
+    return false;
+}
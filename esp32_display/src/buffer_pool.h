@@ -0,0 +1,50 @@
+/**
+ * Shared pool of large PSRAM buffers
+ *
+ * Display modes take their canvases here on entry and give them back on
+ * exit; the face stream takes its JPEG receive buffer per frame. A buffer
+ * that has been given back stays in the pool (idle) so the next taker of
+ * the same size reuses it without a fresh allocation, e.g. the receive
+ * buffer between face frames, or a canvas handed from the mode being left
+ * to the mode being entered. buffer_pool_trim() frees every idle buffer;
+ * the mode registry calls it after each switch, so resident PSRAM follows
+ * what the active mode holds and the rest stays free for prefetch and
+ * caches.
+ *
+ * Loop and LVGL code only (callers hold the LVGL lock or run in the loop
+ * task); not safe from other tasks.
+ */
+
+#ifndef BUFFER_POOL_H
+#define BUFFER_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define BUFFER_POOL_MAX_BUFFERS     8
+
+typedef struct {
+    size_t resident_bytes;          // Taken plus idle
+    size_t in_use_bytes;
+    size_t peak_resident_bytes;
+    uint32_t allocations;           // Fresh heap allocations
+    uint32_t reuses;                // Takes served by an idle buffer
+    uint32_t failures;
+} BufferPoolStats;
+
+// A PSRAM buffer of at least bytes (an idle one at most twice that, or a new one) for owner, a static
+// string used in reports. NULL if PSRAM is exhausted
+void *buffer_pool_take(const char *owner, size_t bytes);
+
+// Return a buffer from buffer_pool_take(); it stays idle in the pool until reused or trimmed. NULL is ignored
+void buffer_pool_give(void *buf);
+
+// Free every idle buffer
+void buffer_pool_trim(void);
+
+void buffer_pool_get_stats(BufferPoolStats *stats);
+
+// Owner and size of buffer i in use, for reports; false past the last one
+bool buffer_pool_get_in_use(int i, const char **owner, size_t *bytes);
+
+#endif // BUFFER_POOL_H
@@ -0,0 +1,100 @@
+/**
+ * Backend clock synchronisation - see clock_sync.h
+ */
+
+#include <Arduino.h>
+#include "clock_sync.h"
+
+// Number of recent exchanges considered when picking the best sample
+#define CLOCK_SYNC_WINDOW       8
+// Offset errors above this are stepped instead of slewed
+#define CLOCK_SYNC_STEP_MS      100
+// Samples slower than this are too asymmetric to trust
+#define CLOCK_SYNC_MAX_RTT_MS   500
+
+typedef struct {
+    int64_t offset_ms;
+    uint32_t rtt_ms;
+} clock_sample_t;
+
+static clock_sample_t samples[CLOCK_SYNC_WINDOW];
+static int sample_count = 0;
+static int sample_next = 0;
+
+// Shared with the LVGL task, so 64-bit reads/writes go through the spinlock
+static portMUX_TYPE clock_sync_mux = portMUX_INITIALIZER_UNLOCKED;
+static int64_t applied_offset_ms = 0;
+static uint32_t applied_rtt_ms = 0;
+static bool synced = false;
+
+void clock_sync_sample(uint32_t local_tx_ms, uint32_t local_rx_ms, int64_t server_rx_ms, int64_t server_tx_ms)
+{
+    uint32_t round_trip = local_rx_ms - local_tx_ms;
+    int64_t server_hold = server_tx_ms - server_rx_ms;
+    if (server_hold < 0 || server_hold > round_trip) {
+        return;
+    }
+    uint32_t rtt = round_trip - (uint32_t)server_hold;
+    if (rtt > CLOCK_SYNC_MAX_RTT_MS) {
+        return;
+    }
+
+    // Classic NTP offset: average of the two one-way differences
+    int64_t offset = ((server_rx_ms - (int64_t)local_tx_ms) + (server_tx_ms - (int64_t)local_rx_ms)) / 2;
+
+    samples[sample_next].offset_ms = offset;
+    samples[sample_next].rtt_ms = rtt;
+    sample_next = (sample_next + 1) % CLOCK_SYNC_WINDOW;
+    if (sample_count < CLOCK_SYNC_WINDOW) {
+        sample_count++;
+    }
+
+    // The lowest-RTT exchange has the least room for path asymmetry
+    int best = 0;
+    for (int i = 1; i < sample_count; i++) {
+        if (samples[i].rtt_ms < samples[best].rtt_ms) {
+            best = i;
+        }
+    }
+
+    portENTER_CRITICAL(&clock_sync_mux);
+    int64_t error = samples[best].offset_ms - applied_offset_ms;
+    if (!synced || error > CLOCK_SYNC_STEP_MS || error < -CLOCK_SYNC_STEP_MS) {
+        applied_offset_ms = samples[best].offset_ms;
+    } else {
+        // Slew small corrections so the pulse never visibly jumps
+        applied_offset_ms += error / 4;
+    }
+    applied_rtt_ms = samples[best].rtt_ms;
+    synced = true;
+    portEXIT_CRITICAL(&clock_sync_mux);
+}
+
+int64_t clock_sync_server_ms(void)
+{
+    portENTER_CRITICAL(&clock_sync_mux);
+    int64_t offset = applied_offset_ms;
+    portEXIT_CRITICAL(&clock_sync_mux);
+    return (int64_t)millis() + offset;
+}
+
+bool clock_sync_valid(void)
+{
+    return synced;
+}
+
+uint32_t clock_sync_rtt_ms(void)
+{
+    return applied_rtt_ms;
+}
+
+void clock_sync_reset(void)
+{
+    sample_count = 0;
+    sample_next = 0;
+    portENTER_CRITICAL(&clock_sync_mux);
+    applied_offset_ms = 0;
+    applied_rtt_ms = 0;
+    synced = false;
+    portEXIT_CRITICAL(&clock_sync_mux);
+}
@@ -0,0 +1,32 @@
+/**
+ * Backend clock synchronisation
+ *
+ * NTP-style offset estimate piggybacked on the regular /api/hal/display poll.
+ * The backend stamps each response with its receive and transmit times, the
+ * display brackets the request with millis(), and the lowest-RTT sample in a
+ * short window wins. Animations that derive their phase from
+ * clock_sync_server_ms() stay in lockstep across every display in the room.
+ */
+
+#ifndef CLOCK_SYNC_H
+#define CLOCK_SYNC_H
+
+#include <stdint.h>
+
+// Feed one request/response exchange (local times from millis(), server times from the response)
+void clock_sync_sample(uint32_t local_tx_ms, uint32_t local_rx_ms, int64_t server_rx_ms, int64_t server_tx_ms);
+
+// Current time on the backend's timebase (falls back to millis() until the first sample)
+int64_t clock_sync_server_ms(void);
+
+// True once at least one exchange has been accepted
+bool clock_sync_valid(void);
+
+// Round-trip time of the sample currently in use, in milliseconds
+uint32_t clock_sync_rtt_ms(void);
+
+// Drop every sample, e.g. after switching to another backend with its own timebase. The next exchange is
+// applied straight away
+void clock_sync_reset(void);
+
+#endif // CLOCK_SYNC_H
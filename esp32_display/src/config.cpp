@@ -0,0 +1,202 @@
+/**
+ * Runtime-tunable configuration registry - see config.h
+ */
+
+#include <Preferences.h>
+#include "config.h"
+#include "log_sink.h"
+
+#define CONFIG_NAMESPACE            "config"
+#define CONFIG_VERSION_KEY          "backend_ver"
+#define CONFIG_VERSION_MAX          16
+
+// In ConfigId order: name, type, default, min, max
+const ConfigDef CONFIG_DEFS[CONFIG_COUNT] = {
+    { "poll_ms",        CONFIG_TYPE_U32, 1000,   100,  60000 },
+    { "face_ms",        CONFIG_TYPE_U32, 200,    20,   5000 },
+    { "http_timeout",   CONFIG_TYPE_U32, 2000,   200,  30000 },
+    { "face_timeout",   CONFIG_TYPE_U32, 3000,   200,  30000 },
+    { "face_max_bytes", CONFIG_TYPE_U32, 200000, 4096, 1048576 },
+    { "report_ms",      CONFIG_TYPE_U32, 5000,   1000, 600000 },
+    { "eye_divisor",    CONFIG_TYPE_U32, 2,      1,    8 },
+    { "eye_period_ms",  CONFIG_TYPE_U32, 33,     10,   1000 },
+    { "lvgl_min_ms",    CONFIG_TYPE_U32, 2,      1,    100 },
+    { "lvgl_max_ms",    CONFIG_TYPE_U32, 500,    10,   5000 },
+    { "idle_after_ms",  CONFIG_TYPE_U32, 300000, 0,    86400000 },
+    { "idle_divisor",   CONFIG_TYPE_U32, 6,      1,    30 },
+    { "idle_period_ms", CONFIG_TYPE_U32, 100,    10,   1000 },
+    { "idle_cpu_mhz",   CONFIG_TYPE_U32, 80,     80,   240 },
+    { "cpu_min_mhz",    CONFIG_TYPE_U32, 80,     80,   240 },
+    { "backlight",      CONFIG_TYPE_U32, 100,    1,    100 },
+    { "idle_backlight", CONFIG_TYPE_U32, 30,     0,    100 },
+    { "fade_ms",        CONFIG_TYPE_U32, 400,    0,    3000 },
+    { "fade_divisor",   CONFIG_TYPE_U32, 3,      1,    8 },
+    { "face_interp",    CONFIG_TYPE_BOOL, 1,     0,    1 },
+    { "face_divisor",   CONFIG_TYPE_U32, 2,      1,    8 },
+};
+
+uint32_t config_values[CONFIG_COUNT];
+
+static uint32_t changed_mask = 0;
+static char backend_version[CONFIG_VERSION_MAX] = "";
+
+static bool parse_value(const ConfigDef *def, const char *text, uint32_t *out)
+{
+    if (strcmp(text, "default") == 0) {
+        *out = def->def;
+        return true;
+    }
+    if (def->type == CONFIG_TYPE_BOOL) {
+        if (strcmp(text, "true") == 0 || strcmp(text, "1") == 0) {
+            *out = 1;
+        } else if (strcmp(text, "false") == 0 || strcmp(text, "0") == 0) {
+            *out = 0;
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    char *end;
+    unsigned long value = strtoul(text, &end, 10);
+    if (end == text || *end != '\0' || value < def->min || value > def->max) {
+        return false;
+    }
+    *out = (uint32_t)value;
+    return true;
+}
+
+// Store a validated value; defaults are removed from NVS so a later default change takes effect
+static void store(int id, uint32_t value)
+{
+    const ConfigDef *def = &CONFIG_DEFS[id];
+    if (__atomic_exchange_n(&config_values[id], value, __ATOMIC_RELAXED) == value) {
+        return;
+    }
+    __atomic_or_fetch(&changed_mask, 1u << id, __ATOMIC_RELAXED);
+
+    Preferences prefs;
+    if (prefs.begin(CONFIG_NAMESPACE, false)) {
+        if (value == def->def) {
+            prefs.remove(def->name);
+        } else {
+            prefs.putUInt(def->name, value);
+        }
+        prefs.end();
+    }
+    LOG("Config %s = %lu", def->name, (unsigned long)value);
+}
+
+void config_init(void)
+{
+    Preferences prefs;
+    bool opened = prefs.begin(CONFIG_NAMESPACE, true);
+    for (int i = 0; i < CONFIG_COUNT; i++) {
+        const ConfigDef *def = &CONFIG_DEFS[i];
+        uint32_t value = opened ? prefs.getUInt(def->name, def->def) : def->def;
+        // A stored value outside a range tightened by a firmware update falls back to the default
+        config_values[i] = (value >= def->min && value <= def->max) ? value : def->def;
+    }
+    if (opened) {
+        prefs.getString(CONFIG_VERSION_KEY, backend_version, sizeof(backend_version));
+        prefs.end();
+    }
+}
+
+int config_find(const char *name)
+{
+    for (int i = 0; i < CONFIG_COUNT; i++) {
+        if (strcmp(CONFIG_DEFS[i].name, name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+bool config_set(const char *name, const char *value)
+{
+    int id = config_find(name);
+    uint32_t parsed;
+    if (id < 0 || !parse_value(&CONFIG_DEFS[id], value, &parsed)) {
+        LOG("Config %s = %s rejected", name, value);
+        return false;
+    }
+    store(id, parsed);
+    return true;
+}
+
+int config_apply_backend(JsonObjectConst values, const char *version)
+{
+    int rejected = 0;
+    for (JsonPairConst kv : values) {
+        char text[16];
+        if (kv.value().isNull()) {
+            continue;                   // Cleared on the backend, reset below
+        } else if (kv.value().is<bool>()) {
+            strlcpy(text, kv.value().as<bool>() ? "true" : "false", sizeof(text));
+        } else if (kv.value().is<uint32_t>()) {
+            snprintf(text, sizeof(text), "%lu", (unsigned long)kv.value().as<uint32_t>());
+        } else {
+            strlcpy(text, kv.value().as<const char *>() ? kv.value().as<const char *>() : "", sizeof(text));
+        }
+        if (!config_set(kv.key().c_str(), text)) {
+            rejected++;
+        }
+    }
+    for (int i = 0; i < CONFIG_COUNT; i++) {
+        if (values[CONFIG_DEFS[i].name].isNull()) {
+            store(i, CONFIG_DEFS[i].def);
+        }
+    }
+
+    strlcpy(backend_version, version, sizeof(backend_version));
+    Preferences prefs;
+    if (prefs.begin(CONFIG_NAMESPACE, false)) {
+        prefs.putString(CONFIG_VERSION_KEY, backend_version);
+        prefs.end();
+    }
+    return rejected;
+}
+
+const char *config_backend_version(void)
+{
+    return backend_version;
+}
+
+void config_forget_backend_version(void)
+{
+    backend_version[0] = '\0';
+}
+
+uint32_t config_take_changes(void)
+{
+    return __atomic_exchange_n(&changed_mask, 0, __ATOMIC_RELAXED);
+}
+
+void config_report(JsonDocument &doc)
+{
+    JsonObject out = doc["config"].to<JsonObject>();
+    for (int i = 0; i < CONFIG_COUNT; i++) {
+        if (CONFIG_DEFS[i].type == CONFIG_TYPE_BOOL) {
+            out[CONFIG_DEFS[i].name] = config_get_bool((ConfigId)i);
+        } else {
+            out[CONFIG_DEFS[i].name] = config_get((ConfigId)i);
+        }
+    }
+    doc["config_version"] = backend_version;
+}
+
+void config_write_text(Print &out)
+{
+    for (int i = 0; i < CONFIG_COUNT; i++) {
+        const ConfigDef *def = &CONFIG_DEFS[i];
+        if (def->type == CONFIG_TYPE_BOOL) {
+            out.printf("%-16s %-8s (default %s)\n", def->name, config_get((ConfigId)i) ? "true" : "false",
+                       def->def ? "true" : "false");
+        } else {
+            out.printf("%-16s %-8lu (default %lu, %lu..%lu)\n", def->name, (unsigned long)config_get((ConfigId)i),
+                       (unsigned long)def->def, (unsigned long)def->min, (unsigned long)def->max);
+        }
+    }
+    out.printf("backend version: %s\n", backend_version[0] ? backend_version : "none");
+}
@@ -0,0 +1,107 @@
+/**
+ * Runtime-tunable configuration registry
+ *
+ * Every tunable is declared once in config.cpp with its type, default and
+ * allowed range. Values live in NVS (namespace "config") and are read with
+ * config_get(), a single atomic load, so code picks up a change on its next
+ * use without a reboot. Values that need more than a re-read (the eye pacing,
+ * the LVGL task delays) are re-applied by the loop through
+ * config_take_changes().
+ *
+ * Two ways in, both validated against the declared range:
+ *  - The backend serves overrides at /api/hal/config and announces their
+ *    version in every /api/hal/display poll. The display fetches them when
+ *    the version differs from the one it last applied (kept in NVS), so a
+ *    backend change reaches every display within a poll interval.
+ *  - The diagnostics server's /config lists every value and accepts
+ *    POST name=value (or name=default) for tuning one display by hand.
+ * The last write wins; a local edit lasts until the backend's set changes.
+ */
+
+#ifndef CONFIG_H
+#define CONFIG_H
+
+#include <stdint.h>
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+enum ConfigId {
+    CONFIG_POLL_INTERVAL_MS,        // Backend display-state poll
+    CONFIG_FACE_INTERVAL_MS,        // Face frame fetch in face mode
+    CONFIG_HTTP_TIMEOUT_MS,         // Display state, eye script, config and metrics requests
+    CONFIG_FACE_TIMEOUT_MS,         // Face frame requests
+    CONFIG_FACE_MAX_BYTES,          // Larger face frames are discarded
+    CONFIG_METRICS_REPORT_MS,       // Metrics window posted to the backend
+    CONFIG_EYE_VSYNC_DIVISOR,       // Panel refreshes per eye frame
+    CONFIG_EYE_FRAME_PERIOD_MS,     // Eye timer period when the panel has no VSYNC
+    CONFIG_LVGL_MIN_DELAY_MS,       // LVGL task sleep bounds
+    CONFIG_LVGL_MAX_DELAY_MS,
+    CONFIG_IDLE_AFTER_MS,           // Quiet time (nobody present, no state change) before idling, 0 = never
+    CONFIG_IDLE_EYE_DIVISOR,        // Eye pacing while idle, as CONFIG_EYE_VSYNC_DIVISOR / _FRAME_PERIOD_MS
+    CONFIG_IDLE_FRAME_PERIOD_MS,
+    CONFIG_IDLE_CPU_MHZ,            // CPU frequency cap while idle
+    CONFIG_CPU_MIN_MHZ,             // CPU frequency between bursts (power_manager.h), 240 disables scaling
+    CONFIG_BACKLIGHT,               // Backlight percent, active and idle
+    CONFIG_IDLE_BACKLIGHT,
+    CONFIG_FADE_MS,                 // Cross-fade between display modes, 0 = hard cut
+    CONFIG_FADE_DIVISOR,            // Panel refreshes per cross-fade frame
+    CONFIG_FACE_INTERP,             // Interpolate between face frames (face_view.h), from the next face mode entry
+    CONFIG_FACE_DIVISOR,            // Panel refreshes per interpolated face frame
+    CONFIG_COUNT
+};
+
+enum ConfigType {
+    CONFIG_TYPE_U32,
+    CONFIG_TYPE_BOOL
+};
+
+typedef struct {
+    const char *name;               // Wire and NVS key, at most 15 characters
+    ConfigType type;
+    uint32_t def;
+    uint32_t min;
+    uint32_t max;
+} ConfigDef;
+
+extern const ConfigDef CONFIG_DEFS[CONFIG_COUNT];
+extern uint32_t config_values[CONFIG_COUNT];
+
+// Load stored values over the defaults; call once at boot before anything reads the config
+void config_init(void);
+
+static inline uint32_t config_get(ConfigId id)
+{
+    return __atomic_load_n(&config_values[id], __ATOMIC_RELAXED);
+}
+
+static inline bool config_get_bool(ConfigId id)
+{
+    return config_get(id) != 0;
+}
+
+// Index of name, or -1
+int config_find(const char *name);
+
+// Validate and store one value ("default" restores the default); false if unknown or out of range. Any task
+bool config_set(const char *name, const char *value);
+
+// Apply {"name": value, ...} from the backend; keys it no longer sends go back to their default.
+// Returns the number of rejected entries
+int config_apply_backend(JsonObjectConst values, const char *version);
+
+// Version of the backend set last applied ("" if none)
+const char *config_backend_version(void);
+
+// Forget the backend version (not the values), so the next poll fetches the set again
+void config_forget_backend_version(void);
+
+// Bit mask (1 << ConfigId) of values changed since the last call; call from the loop
+uint32_t config_take_changes(void);
+
+// Add {"config": {"name": value, ...}, "config_version": ...} to doc
+void config_report(JsonDocument &doc);
+
+// Write "name value (default, range)" lines for the diagnostics server
+void config_write_text(Print &out);
+
+#endif // CONFIG_H
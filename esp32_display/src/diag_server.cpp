@@ -0,0 +1,248 @@
+/**
+ * On-device diagnostics HTTP server - see diag_server.h
+ */
+
+#include <Arduino.h>
+#include <esp_http_server.h>
+#include "diag_server.h"
+#include "boot_timing.h"
+#include "config.h"
+#include "display_mode.h"
+#include "idle_governor.h"
+#include "lvgl_v8_port.h"
+#include "log_sink.h"
+#include "metrics.h"
+#include "power_manager.h"
+#include "snapshot_encoder.h"
+#include "trace.h"
+#include "wifi_manager.h"
+
+#define DIAG_SERVER_PORT        80
+#define DIAG_SERVER_PRIORITY    1       // Below the LVGL task and the Arduino loop
+#define DIAG_SERVER_STACK       6144
+#define DIAG_CHUNK_SIZE         1024
+
+static httpd_handle_t server = NULL;
+
+// Print adapter that batches output into HTTP chunks
+class HttpChunkPrint : public Print {
+public:
+    explicit HttpChunkPrint(httpd_req_t *req) : req(req), used(0), failed(false) {}
+
+    size_t write(uint8_t c) override
+    {
+        return write(&c, 1);
+    }
+
+    size_t write(const uint8_t *data, size_t len) override
+    {
+        size_t done = 0;
+        while (done < len && !failed) {
+            size_t n = len - done;
+            if (n > sizeof(buffer) - used) {
+                n = sizeof(buffer) - used;
+            }
+            memcpy(buffer + used, data + done, n);
+            used += n;
+            done += n;
+            if (used == sizeof(buffer)) {
+                flush();
+            }
+        }
+        return done;
+    }
+
+    void flush() override
+    {
+        if (used > 0 && !failed) {
+            failed = (httpd_resp_send_chunk(req, (const char *)buffer, used) != ESP_OK);
+        }
+        used = 0;
+    }
+
+    // Flush and terminate the chunked response
+    esp_err_t finish()
+    {
+        flush();
+        return failed ? ESP_FAIL : httpd_resp_send_chunk(req, NULL, 0);
+    }
+
+private:
+    httpd_req_t *req;
+    uint8_t buffer[DIAG_CHUNK_SIZE];
+    size_t used;
+    bool failed;
+};
+
+static esp_err_t index_handler(httpd_req_t *req)
+{
+    httpd_resp_set_type(req, "text/plain");
+    return httpd_resp_sendstr(req,
+        "HAL 9000 display diagnostics\n"
+        "  /metrics                  current metrics window (text)\n"
+        "  /snapshot                 frame buffer as PNG\n"
+        "  /snapshot?format=rle565   frame buffer as RLE565\n"
+        "  /config                   runtime settings; POST name=value&... (or name=default) to change\n"
+#if TRACE_ENABLED
+        "  /trace                    trace ring as Chrome trace JSON\n"
+#endif
+        );
+}
+
+static esp_err_t metrics_handler(httpd_req_t *req)
+{
+    httpd_resp_set_type(req, "text/plain; version=0.0.4");
+    HttpChunkPrint out(req);
+    metrics_write_text(out);
+    boot_timing_write_text(out);
+    wifi_manager_write_text(out);
+    idle_governor_write_text(out);
+    power_manager_write_text(out);
+    display_mode_write_text(out);
+    out.printf("hal_dropped_frames %lu\n", (unsigned long)lvgl_port_get_dropped_frames());
+    out.printf("hal_refresh_period_us %lu\n", (unsigned long)lvgl_port_get_refresh_period_us());
+    out.printf("hal_log_dropped %lu\n", (unsigned long)log_sink_dropped());
+    return out.finish();
+}
+
+static bool snapshot_write_chunk(void *ctx, const uint8_t *data, size_t len)
+{
+    return httpd_resp_send_chunk((httpd_req_t *)ctx, (const char *)data, len) == ESP_OK;
+}
+
+static esp_err_t snapshot_handler(httpd_req_t *req)
+{
+    uint16_t width = 0, height = 0;
+    const uint16_t *pixels = (const uint16_t *)lvgl_port_get_scanout_buffer(&width, &height);
+    if (pixels == NULL) {
+        httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "This panel has no readable frame buffer");
+        return ESP_FAIL;
+    }
+
+    char query[32] = "";
+    char format[16] = "";
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK) {
+        httpd_query_key_value(query, "format", format, sizeof(format));
+    }
+    bool rle = (strcmp(format, "rle565") == 0);
+
+    // Read straight from the buffer being scanned out: no lock, no copy, may catch a flush half way
+    int64_t start_us = esp_timer_get_time();
+    httpd_resp_set_type(req, rle ? "application/octet-stream" : "image/png");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    bool ok = rle ? snapshot_write_rle565(pixels, width, height, snapshot_write_chunk, req)
+                  : snapshot_write_png(pixels, width, height, snapshot_write_chunk, req);
+    LOG("Snapshot (%s) %s in %lu ms", rle ? "rle565" : "png", ok ? "sent" : "aborted",
+        (unsigned long)((esp_timer_get_time() - start_us) / 1000));
+    if (!ok) {
+        return ESP_FAIL;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+static esp_err_t config_get_handler(httpd_req_t *req)
+{
+    httpd_resp_set_type(req, "text/plain");
+    HttpChunkPrint out(req);
+    config_write_text(out);
+    return out.finish();
+}
+
+// Body (or query) "name=value&name=value"; valid pairs apply, the rest are reported back
+static esp_err_t config_post_handler(httpd_req_t *req)
+{
+    char body[256];
+    int len = 0;
+    if (req->content_len >= sizeof(body)) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Body too long");
+        return ESP_FAIL;
+    }
+    while (len < (int)req->content_len) {
+        int n = httpd_req_recv(req, body + len, req->content_len - len);
+        if (n <= 0) {
+            return ESP_FAIL;
+        }
+        len += n;
+    }
+    body[len] = '\0';
+    if (len == 0 && httpd_req_get_url_query_str(req, body, sizeof(body)) != ESP_OK) {
+        body[0] = '\0';
+    }
+
+    char values[CONFIG_COUNT][16];
+    bool present[CONFIG_COUNT];
+    int count = 0;
+    for (int i = 0; i < CONFIG_COUNT; i++) {
+        present[i] = (httpd_query_key_value(body, CONFIG_DEFS[i].name, values[i], sizeof(values[i])) == ESP_OK);
+        count += present[i];
+    }
+    if (count == 0) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "No known settings in the request");
+        return ESP_FAIL;
+    }
+
+    int rejected = 0;
+    for (int i = 0; i < CONFIG_COUNT; i++) {
+        if (present[i] && !config_set(CONFIG_DEFS[i].name, values[i])) {
+            rejected++;
+        }
+    }
+
+    if (rejected > 0) {
+        httpd_resp_set_status(req, "400 Bad Request");
+    }
+    httpd_resp_set_type(req, "text/plain");
+    HttpChunkPrint out(req);
+    if (rejected > 0) {
+        out.printf("%d of %d settings rejected (unknown value or out of range)\n", rejected, count);
+    }
+    config_write_text(out);
+    return out.finish();
+}
+
+#if TRACE_ENABLED
+static esp_err_t trace_handler(httpd_req_t *req)
+{
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Content-Disposition", "attachment; filename=\"hal-display-trace.json\"");
+    HttpChunkPrint out(req);
+    trace_write_json(out);
+    return out.finish();
+}
+#endif
+
+bool diag_server_start(void)
+{
+    if (server != NULL) {
+        return true;
+    }
+
+    httpd_config_t config = HTTPD_DEFAULT_CONFIG();
+    config.server_port = DIAG_SERVER_PORT;
+    config.task_priority = DIAG_SERVER_PRIORITY;
+    config.stack_size = DIAG_SERVER_STACK;
+    config.lru_purge_enable = true;
+
+    if (httpd_start(&server, &config) != ESP_OK) {
+        LOG_EVERY_MS(60000, "Diagnostics server failed to start");
+        server = NULL;
+        return false;
+    }
+
+    static const httpd_uri_t routes[] = {
+        { "/", HTTP_GET, index_handler, NULL },
+        { "/metrics", HTTP_GET, metrics_handler, NULL },
+        { "/snapshot", HTTP_GET, snapshot_handler, NULL },
+        { "/config", HTTP_GET, config_get_handler, NULL },
+        { "/config", HTTP_POST, config_post_handler, NULL },
+#if TRACE_ENABLED
+        { "/trace", HTTP_GET, trace_handler, NULL },
+#endif
+    };
+    for (const httpd_uri_t &route : routes) {
+        httpd_register_uri_handler(server, &route);
+    }
+
+    LOG("Diagnostics server on port %d", DIAG_SERVER_PORT);
+    return true;
+}
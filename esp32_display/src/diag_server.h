@@ -0,0 +1,23 @@
+/**
+ * On-device diagnostics HTTP server
+ *
+ * A small esp_http_server on port 80, running at low priority so it never
+ * competes with rendering:
+ *   /                         list of endpoints
+ *   /metrics                  current metrics window as Prometheus-style text
+ *   /snapshot                 the panel frame buffer as PNG
+ *   /snapshot?format=rle565   the same frame run-length encoded (see snapshot_encoder.h)
+ *   /config                   runtime settings (config.h); POST name=value to change
+ *   /trace                    the trace ring as Chrome trace JSON (when TRACE_ENABLED)
+ *
+ * Responses are chunked and produced row by row straight from the scanout
+ * buffer, so a snapshot costs one row of RAM and never pauses the panel.
+ */
+
+#ifndef DIAG_SERVER_H
+#define DIAG_SERVER_H
+
+// Start the server once WiFi is up; safe to call again after a reconnect
+bool diag_server_start(void);
+
+#endif // DIAG_SERVER_H
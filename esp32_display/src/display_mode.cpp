@@ -0,0 +1,404 @@
+/**
+ * Display mode registry and frame scheduler - see display_mode.h
+ */
+
+#include <esp_timer.h>
+#include "display_mode.h"
+#include "buffer_pool.h"
+#include "config.h"
+#include "log_sink.h"
+#include "lvgl_v8_port.h"
+#include "mode_transition.h"
+#include "pixel_blend.h"
+#include "trace.h"
+
+#define FADE_SLOT                   DISPLAY_MODE_MAX    // Frame stats of cross-fades, after the modes'
+
+typedef struct {
+    uint32_t frames;
+    uint32_t overruns;
+    uint32_t max_us;
+    uint32_t budget_us;                 // Budget the last frame was held to
+    uint64_t total_us;
+} ModeFrameStats;
+
+static const DisplayModeOps *modes[DISPLAY_MODE_MAX];
+static int current = -1;
+static uint32_t switches = 0;
+static uint32_t enter_failures = 0;
+static uint32_t enter_deferred = 0;     // Switches refused while a failed mode waits to be retried
+static int64_t retry_at_us[DISPLAY_MODE_MAX];
+static uint32_t last_switch_us = 0;
+
+// Frame ticks of the active mode, or of the cross-fade into it, LVGL lock held
+static bool ticking = false;
+static bool fading = false;
+static int64_t fade_start_us = 0;
+static uint32_t fade_dropped_at_start = 0;  // lvgl_port_get_dropped_frames() as the fade began
+static uint32_t fade_dropped = 0;           // Panel frames dropped during fades
+static lv_timer_t *tick_timer = NULL;   // Fallback pacing when there is no VSYNC
+static uint32_t timer_frame = 0;
+static int64_t tick_start_us = 0;       // Start of the last tick, 0 once it has been accounted
+static uint32_t tick_us = 0;
+static int tick_slot = 0;               // Mode id of the last tick, or FADE_SLOT
+
+// Read by the reports from other tasks, under stats_mux
+static portMUX_TYPE stats_mux = portMUX_INITIALIZER_UNLOCKED;
+static ModeFrameStats stats[DISPLAY_MODE_MAX + 1];
+
+static const char *slot_name(int slot)
+{
+    return slot == FADE_SLOT ? "fade" : modes[slot]->name;
+}
+
+// Panel refreshes per tick, and the tick period without VSYNC
+static uint32_t tick_divisor(void)
+{
+    if (fading) {
+        return config_get(CONFIG_FADE_DIVISOR);
+    }
+    return modes[current]->frame_divisor != NULL ? modes[current]->frame_divisor() : 1;
+}
+
+static uint32_t tick_period_ms(void)
+{
+    if (fading) {
+        return DISPLAY_MODE_FADE_PERIOD_MS;
+    }
+    return modes[current]->frame_period_ms != NULL ? modes[current]->frame_period_ms() : 33;
+}
+
+// The tick interval of a slot, the default budget
+static uint32_t interval_us(int slot)
+{
+    uint32_t refresh_us = lvgl_port_get_refresh_period_us();
+    if (slot == FADE_SLOT) {
+        return tick_timer == NULL && refresh_us > 0 ? refresh_us * config_get(CONFIG_FADE_DIVISOR)
+                                                    : DISPLAY_MODE_FADE_PERIOD_MS * 1000;
+    }
+    const DisplayModeOps *ops = modes[slot];
+    uint32_t divisor = ops->frame_divisor != NULL ? ops->frame_divisor() : 0;
+    if (tick_timer == NULL && refresh_us > 0 && divisor > 0) {
+        return refresh_us * divisor;
+    }
+    return ops->frame_period_ms != NULL ? ops->frame_period_ms() * 1000 : 0;
+}
+
+static void record(int slot, uint32_t cost_us)
+{
+    uint32_t budget_us = slot != FADE_SLOT && modes[slot]->frame_budget_us ? modes[slot]->frame_budget_us
+                                                                            : interval_us(slot);
+    bool overrun = budget_us > 0 && cost_us > budget_us;
+
+    portENTER_CRITICAL(&stats_mux);
+    ModeFrameStats *s = &stats[slot];
+    s->frames++;
+    s->total_us += cost_us;
+    if (cost_us > s->max_us) {
+        s->max_us = cost_us;
+    }
+    s->budget_us = budget_us;
+    if (overrun) {
+        s->overruns++;
+    }
+    portEXIT_CRITICAL(&stats_mux);
+
+    if (overrun) {
+        LOG_EVERY_MS(DISPLAY_MODE_OVERRUN_LOG_MS, "Mode %s frame %lu us over its %lu us budget", slot_name(slot),
+                     (unsigned long)cost_us, (unsigned long)budget_us);
+    }
+}
+
+// Charge the previous tick: until its redraw was flushed, or just the tick if it did not redraw anything
+static void account_tick(void)
+{
+    if (tick_start_us == 0) {
+        return;
+    }
+    int64_t done_us = lvgl_port_get_last_frame_done_us();
+    record(tick_slot, done_us >= tick_start_us ? (uint32_t)(done_us - tick_start_us) : tick_us);
+    tick_start_us = 0;
+}
+
+// Whether a mode animates right now
+static bool mode_ticks(const DisplayModeOps *ops)
+{
+    return ops->tick != NULL && (ops->frame_divisor == NULL || ops->frame_divisor() > 0);
+}
+
+static void start_ticks(void);
+static void stop_ticks(void);
+
+// Uncover the new mode and hand the ticks over to it
+static void finish_fade(void)
+{
+    bool was_ticking = ticking;
+    stop_ticks();
+    fading = false;
+    fade_dropped += lvgl_port_get_dropped_frames() - fade_dropped_at_start;
+    mode_transition_end();
+    buffer_pool_trim();
+    if (was_ticking) {
+        start_ticks();
+    }
+}
+
+static void fade_tick(uint32_t frame)
+{
+    // A mode fading in from its own buffer keeps drawing into it, so the fade follows it
+    const DisplayModeOps *ops = modes[current];
+    if (ops->pixels != NULL && mode_ticks(ops)) {
+        ops->tick(frame);
+    }
+
+    uint32_t duration_ms = config_get(CONFIG_FADE_MS);
+    uint32_t elapsed_ms = (uint32_t)((esp_timer_get_time() - fade_start_us) / 1000);
+    if (elapsed_ms >= duration_ms) {
+        finish_fade();
+        return;
+    }
+    mode_transition_draw(elapsed_ms * PIXEL_BLEND_ALPHA_MAX / duration_ms);
+}
+
+static void run_tick(uint32_t frame)
+{
+    account_tick();
+    TRACE_SCOPE("mode_tick");
+    int slot = fading ? FADE_SLOT : current;
+    int64_t start_us = esp_timer_get_time();
+    if (fading) {
+        fade_tick(frame);
+    } else {
+        modes[current]->tick(frame);
+    }
+    tick_us = (uint32_t)(esp_timer_get_time() - start_us);
+    tick_start_us = start_us;
+    tick_slot = slot;
+}
+
+static void frame_callback(uint32_t frame, void *user_data)
+{
+    run_tick(frame);
+}
+
+static void timer_callback(lv_timer_t *timer)
+{
+    run_tick(timer_frame++);
+}
+
+static void start_ticks(void)
+{
+    if (ticking || (!fading && !mode_ticks(modes[current]))) {
+        return;
+    }
+    ticking = true;
+
+    // Lock the ticks to the panel refresh so every frame is scanned out exactly once
+    if (lvgl_port_set_frame_callback(frame_callback, tick_divisor(), NULL)) {
+        return;
+    }
+    tick_timer = lv_timer_create(timer_callback, tick_period_ms(), NULL);
+}
+
+static void stop_ticks(void)
+{
+    if (!ticking) {
+        return;
+    }
+    ticking = false;
+
+    account_tick();
+    lvgl_port_set_frame_callback(NULL, 0, NULL);
+    if (tick_timer != NULL) {
+        lv_timer_del(tick_timer);
+        tick_timer = NULL;
+    }
+}
+
+void display_mode_register(int id, const DisplayModeOps *ops)
+{
+    if (id >= 0 && id < DISPLAY_MODE_MAX) {
+        modes[id] = ops;
+    }
+}
+
+static bool enter(int id, lv_obj_t *parent)
+{
+    if (modes[id] == NULL || !modes[id]->enter(parent)) {
+        // Whatever the mode managed to take before failing goes back
+        if (modes[id] != NULL) {
+            modes[id]->exit();
+        }
+        return false;
+    }
+    current = id;
+    return true;
+}
+
+// Cross-fade from what is on screen (captured before the switch) to the mode just entered
+static void start_fade(void)
+{
+    const DisplayModeOps *ops = modes[current];
+    const uint16_t *pixels = ops->pixels != NULL ? ops->pixels() : NULL;
+    // Modes drawn by LVGL objects are snapshotted, so their objects have to be up to date first
+    if (pixels == NULL && mode_ticks(ops)) {
+        ops->tick(0);
+    }
+    if (!mode_transition_target(pixels)) {
+        mode_transition_end();
+        return;
+    }
+    fading = true;
+    fade_start_us = esp_timer_get_time();
+    fade_dropped_at_start = lvgl_port_get_dropped_frames();
+}
+
+bool display_mode_switch(int id, lv_obj_t *parent)
+{
+    if (id < 0 || id >= DISPLAY_MODE_MAX || modes[id] == NULL) {
+        return false;
+    }
+    if (id == current) {
+        return true;
+    }
+
+    int64_t start_us = esp_timer_get_time();
+    if (start_us < retry_at_us[id]) {
+        enter_deferred++;
+        return false;
+    }
+    int previous = current;
+    if (previous >= 0) {
+        stop_ticks();
+        if (fading) {
+            finish_fade();
+        }
+    }
+    bool fade = previous >= 0 && config_get(CONFIG_FADE_MS) > 0 && mode_transition_begin(parent);
+    if (previous >= 0) {
+        modes[previous]->exit();
+    }
+    bool ok = enter(id, parent);
+    if (!ok) {
+        enter_failures++;
+        retry_at_us[id] = esp_timer_get_time() + DISPLAY_MODE_RETRY_MS * 1000LL;
+        LOG_EVERY_MS(10000, "Mode %s unavailable, staying in %s", modes[id]->name, modes[0]->name);
+        current = -1;
+        enter(0, parent);
+    }
+    if (current < 0) {
+        mode_transition_end();
+    } else {
+        if (fade) {
+            start_fade();
+        }
+        start_ticks();
+    }
+    buffer_pool_trim();
+    switches++;
+    last_switch_us = (uint32_t)(esp_timer_get_time() - start_us);
+
+    if (ok) {
+        LOG("Mode %s -> %s (%lu us)", previous >= 0 ? modes[previous]->name : "none", modes[id]->name,
+            (unsigned long)last_switch_us);
+    }
+    return ok;
+}
+
+int display_mode_current(void)
+{
+    return current;
+}
+
+void display_mode_repace(void)
+{
+    if (!ticking) {
+        return;
+    }
+    stop_ticks();
+    start_ticks();
+}
+
+void display_mode_record_frame(uint32_t cost_us)
+{
+    if (current >= 0) {
+        record(current, cost_us);
+    }
+}
+
+static void report_slot(JsonObject m, const ModeFrameStats *s)
+{
+    m["frames"] = s->frames;
+    m["overruns"] = s->overruns;
+    m["avg_us"] = s->frames ? (uint32_t)(s->total_us / s->frames) : 0;
+    m["max_us"] = s->max_us;
+    m["budget_us"] = s->budget_us;
+}
+
+void display_mode_report(JsonDocument &doc)
+{
+    ModeFrameStats snapshot[DISPLAY_MODE_MAX + 1];
+    portENTER_CRITICAL(&stats_mux);
+    memcpy(snapshot, stats, sizeof(snapshot));
+    portEXIT_CRITICAL(&stats_mux);
+
+    JsonObject out = doc["modes"].to<JsonObject>();
+    out["current"] = current >= 0 ? modes[current]->name : "none";
+    out["switches"] = switches;
+    out["enter_failures"] = enter_failures;
+    out["enter_deferred"] = enter_deferred;
+    out["last_switch_us"] = last_switch_us;
+    for (int i = 0; i < DISPLAY_MODE_MAX; i++) {
+        if (modes[i] == NULL) {
+            continue;
+        }
+        report_slot(out[modes[i]->name].to<JsonObject>(), &snapshot[i]);
+    }
+    JsonObject fade = out["fade"].to<JsonObject>();
+    report_slot(fade, &snapshot[FADE_SLOT]);
+    fade["dropped_frames"] = fade_dropped;
+
+    BufferPoolStats pool_stats;
+    buffer_pool_get_stats(&pool_stats);
+    JsonObject pool = doc["pool"].to<JsonObject>();
+    pool["resident_bytes"] = pool_stats.resident_bytes;
+    pool["in_use_bytes"] = pool_stats.in_use_bytes;
+    pool["peak_resident_bytes"] = pool_stats.peak_resident_bytes;
+    pool["allocations"] = pool_stats.allocations;
+    pool["reuses"] = pool_stats.reuses;
+    pool["failures"] = pool_stats.failures;
+    JsonArray buffers = pool["buffers"].to<JsonArray>();
+    const char *owner;
+    size_t bytes;
+    for (int i = 0; buffer_pool_get_in_use(i, &owner, &bytes); i++) {
+        JsonObject entry = buffers.add<JsonObject>();
+        entry["owner"] = owner;
+        entry["bytes"] = bytes;
+    }
+}
+
+void display_mode_write_text(Print &out)
+{
+    ModeFrameStats snapshot[DISPLAY_MODE_MAX + 1];
+    portENTER_CRITICAL(&stats_mux);
+    memcpy(snapshot, stats, sizeof(snapshot));
+    portEXIT_CRITICAL(&stats_mux);
+
+    out.printf("hal_mode_enter_failures_total %lu\n", (unsigned long)enter_failures);
+    out.printf("hal_mode_enter_deferred_total %lu\n", (unsigned long)enter_deferred);
+
+    // The modes, then the cross-fades between them
+    for (int i = 0; i <= FADE_SLOT; i++) {
+        if (i != FADE_SLOT && modes[i] == NULL) {
+            continue;
+        }
+        const char *name = slot_name(i);
+        bool active = i == FADE_SLOT ? fading : current == i && !fading;
+        out.printf("hal_mode_active{mode=\"%s\"} %d\n", name, active ? 1 : 0);
+        out.printf("hal_mode_frames_total{mode=\"%s\"} %lu\n", name, (unsigned long)snapshot[i].frames);
+        out.printf("hal_mode_overruns_total{mode=\"%s\"} %lu\n", name, (unsigned long)snapshot[i].overruns);
+        out.printf("hal_mode_frame_max_us{mode=\"%s\"} %lu\n", name, (unsigned long)snapshot[i].max_us);
+        out.printf("hal_mode_frame_budget_us{mode=\"%s\"} %lu\n", name, (unsigned long)snapshot[i].budget_us);
+    }
+    out.printf("hal_mode_fade_dropped_frames_total %lu\n", (unsigned long)fade_dropped);
+}
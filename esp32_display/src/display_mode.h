@@ -0,0 +1,87 @@
+/**
+ * Display mode registry and frame scheduler
+ *
+ * Each display mode (the eye, the face stream, ...) registers a small ops
+ * table. Only the active mode has any LVGL objects, buffers or frame ticks:
+ * switching stops the frame ticks, calls the old mode's exit(), which
+ * deletes its objects and gives its buffers back to the pool, then the new
+ * mode's enter(), which creates them, restarts the ticks at the new mode's
+ * pacing and finally trims the pool so nothing idle stays resident. A mode
+ * that cannot get its resources on entry (PSRAM exhausted) fails the switch
+ * and the registry falls back to the default mode (id 0). The failed mode
+ * is not tried again for DISPLAY_MODE_RETRY_MS: switches to it fail
+ * straight away meanwhile and leave the current mode alone, so a caller
+ * asking on every poll does not tear the display down each time.
+ *
+ * Modes that animate provide tick(), run in the LVGL task once every
+ * frame_divisor() panel refreshes (or every frame_period_ms() from an LVGL
+ * timer on panels without VSYNC); a frame_divisor() of 0 means the mode has
+ * nothing to animate at the moment. A frame's cost runs from the start of its
+ * tick until LVGL has flushed the redraw it caused, and is checked against
+ * the mode's frame budget. Modes whose frames come from elsewhere (the face
+ * stream without interpolation) report each frame's cost with
+ * display_mode_record_frame(). Frame counts, costs and budget overruns are
+ * kept per mode.
+ *
+ * A switch cross-fades from the old mode to the new one over fade_ms
+ * (config.h), see mode_transition.h. The fade has the ticks meanwhile, at
+ * fade_divisor panel refreshes per frame, and its frames are accounted and
+ * budgeted like a mode's (reported as "fade", with the panel frames
+ * dropped while fading); the new mode's own ticks
+ * start when it is uncovered. Without PSRAM for the fade frames the switch
+ * is a hard cut.
+ *
+ * Call everything here from the loop task with the LVGL lock held, apart
+ * from the reports.
+ */
+
+#ifndef DISPLAY_MODE_H
+#define DISPLAY_MODE_H
+
+#include <stdint.h>
+#include <Arduino.h>
+#include <lvgl.h>
+#include <ArduinoJson.h>
+
+#define DISPLAY_MODE_MAX                8
+#define DISPLAY_MODE_OVERRUN_LOG_MS     10000   // Overrun log lines at most this often
+#define DISPLAY_MODE_FADE_PERIOD_MS     50      // Cross-fade frame period without VSYNC, fade_divisor 3 at 60 Hz
+#define DISPLAY_MODE_RETRY_MS           5000    // A mode that failed to enter is not tried again for this long
+
+typedef struct {
+    const char *name;
+    bool (*enter)(lv_obj_t *parent);    // Create objects and take buffers; false if they are not available
+    void (*exit)(void);                 // Delete objects and give buffers back
+    void (*tick)(uint32_t frame);       // Update the objects for one frame, NULL if the mode does not animate
+    uint32_t (*frame_divisor)(void);    // Panel refreshes per tick, 0 for no ticks (read on entry and repace)
+    uint32_t (*frame_period_ms)(void);  // Tick period without VSYNC
+    uint32_t frame_budget_us;           // Per frame; 0 means the whole tick interval
+    const uint16_t *(*pixels)(void);    // Full-screen RGB565 buffer the mode draws into, NULL if LVGL objects draw it
+} DisplayModeOps;
+
+// Register ops (static storage) under id, 0 being the default mode
+void display_mode_register(int id, const DisplayModeOps *ops);
+
+// Leave the current mode and enter id on parent; returns false (and enters the default mode) if id could
+// not be entered, or false with nothing changed while id is waiting out a failure. No-op if id is already
+// active
+bool display_mode_switch(int id, lv_obj_t *parent);
+
+// Active mode id, -1 before the first switch
+int display_mode_current(void);
+
+// Restart the active mode's ticks after its frame_divisor() / frame_period_ms() changed
+void display_mode_repace(void);
+
+// Account one frame of the active mode that was produced outside tick(), e.g. a decoded face frame
+void display_mode_record_frame(uint32_t cost_us);
+
+// Add {"modes": {...}} (active mode, switch and entry failure counters, per-mode and cross-fade frames /
+// cost / overruns) and
+// {"pool": {...}} (buffer pool usage) to doc
+void display_mode_report(JsonDocument &doc);
+
+// Write the per-mode frame counters as Prometheus-style text for the diagnostics server
+void display_mode_write_text(Print &out);
+
+#endif // DISPLAY_MODE_H
@@ -0,0 +1,226 @@
+/**
+ * Fixed-point HAL eye animation maths
+ *
+ * All per-frame eye maths reduces to table loads and integer lerps. The
+ * tables are generated at compile time (constexpr), so nothing is computed
+ * at boot and nothing touches the soft-float double path that sin() takes
+ * on the ESP32-S3.
+ *
+ * Conventions:
+ *  - pulse:       0-255, the classic (sin + 1) / 2 wave
+ *  - brightness:  0-255 multiplier, 255 = full colour
+ *  - colours:     RGB565 packed the same way as lv_color_make() (truncating)
+ *
+ * Header-only and free of Arduino/LVGL dependencies so it also builds on the host.
+ */
+
+#ifndef EYE_MATH_H
+#define EYE_MATH_H
+
+#include <stdint.h>
+
+static_assert(__cplusplus >= 201402L, "eye_math.h needs C++14 constexpr");
+
+/* Compile-time helpers */
+
+template <typename T, int N>
+struct EyeTable {
+    T v[N];
+    constexpr const T &operator[](int i) const { return v[i]; }
+};
+
+constexpr double EYE_PI = 3.14159265358979323846;
+
+// Taylor series sine, accurate to well below 8 bits over [-pi, pi] after range reduction
+constexpr double eye_const_sin(double x)
+{
+    while (x > EYE_PI) {
+        x -= 2 * EYE_PI;
+    }
+    while (x < -EYE_PI) {
+        x += 2 * EYE_PI;
+    }
+    double term = x;
+    double sum = x;
+    for (int n = 1; n < 12; n++) {
+        term *= -x * x / ((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr uint8_t eye_const_round8(double v)
+{
+    return (v <= 0) ? 0 : (v >= 255) ? 255 : (uint8_t)(v + 0.5);
+}
+
+constexpr uint16_t eye_rgb565(uint8_t r, uint8_t g, uint8_t b)
+{
+    return (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+}
+
+/* Sine / ease curves */
+
+// One full pulse period sampled at 256 points (index 0 = mid-level, rising)
+constexpr EyeTable<uint8_t, 256> eye_make_sine_pulse()
+{
+    EyeTable<uint8_t, 256> t{};
+    for (int i = 0; i < 256; i++) {
+        t.v[i] = eye_const_round8((eye_const_sin(2 * EYE_PI * i / 256) * 0.5 + 0.5) * 255);
+    }
+    return t;
+}
+
+// Easing curves (EyeEase order) sampled at 256 points, output 0-256 (8.8 fixed point)
+enum {
+    EYE_MATH_EASE_LINEAR,
+    EYE_MATH_EASE_IN,
+    EYE_MATH_EASE_OUT,
+    EYE_MATH_EASE_IN_OUT,
+    EYE_MATH_EASE_STEP,
+    EYE_MATH_EASE_COUNT
+};
+
+constexpr EyeTable<EyeTable<uint16_t, 256>, EYE_MATH_EASE_COUNT> eye_make_ease()
+{
+    EyeTable<EyeTable<uint16_t, 256>, EYE_MATH_EASE_COUNT> t{};
+    for (int i = 0; i < 256; i++) {
+        double u = i / 256.0;
+        t.v[EYE_MATH_EASE_LINEAR].v[i] = (uint16_t)(u * 256 + 0.5);
+        t.v[EYE_MATH_EASE_IN].v[i] = (uint16_t)(u * u * 256 + 0.5);
+        t.v[EYE_MATH_EASE_OUT].v[i] = (uint16_t)((1 - (1 - u) * (1 - u)) * 256 + 0.5);
+        // Half cosine: 0.5 - 0.5 * cos(pi * u) == 0.5 + 0.5 * sin(pi * u - pi / 2)
+        t.v[EYE_MATH_EASE_IN_OUT].v[i] = (uint16_t)((0.5 + 0.5 * eye_const_sin(EYE_PI * u - EYE_PI / 2)) * 256 + 0.5);
+        t.v[EYE_MATH_EASE_STEP].v[i] = 0;
+    }
+    return t;
+}
+
+static constexpr EyeTable<uint8_t, 256> EYE_SINE_PULSE = eye_make_sine_pulse();
+static constexpr EyeTable<EyeTable<uint16_t, 256>, EYE_MATH_EASE_COUNT> EYE_EASE = eye_make_ease();
+
+/* Brightness curves */
+
+// Built-in pulse: 0.70 .. 1.00
+constexpr EyeTable<uint8_t, 256> eye_make_pulse_brightness()
+{
+    EyeTable<uint8_t, 256> t{};
+    for (int i = 0; i < 256; i++) {
+        t.v[i] = eye_const_round8((0.7 + 0.3 * i / 255.0) * 255);
+    }
+    return t;
+}
+
+// Speech envelope: 0.55 .. 1.00
+constexpr EyeTable<uint8_t, 256> eye_make_envelope_brightness()
+{
+    EyeTable<uint8_t, 256> t{};
+    for (int i = 0; i < 256; i++) {
+        t.v[i] = eye_const_round8((0.55 + 0.45 * i / 255.0) * 255);
+    }
+    return t;
+}
+
+static constexpr EyeTable<uint8_t, 256> EYE_PULSE_BRIGHTNESS = eye_make_pulse_brightness();
+static constexpr EyeTable<uint8_t, 256> EYE_ENVELOPE_BRIGHTNESS = eye_make_envelope_brightness();
+
+/* Ring colours */
+
+#define EYE_RING_COUNT      5       // ring_1 .. ring_4, main_eye
+#define EYE_LEVELS          64      // brightness quantisation for the palettes (RGB565 has <= 64 steps)
+
+// Per-ring brightness scale, outer to inner (0.35, 0.50, 0.70, 0.85, 1.00) in 8.8
+static constexpr uint16_t EYE_RING_SCALE_Q8[EYE_RING_COUNT] = { 90, 128, 179, 218, 256 };
+
+// Built-in state colours: idle #CC0000, listening #FF0000, speaking #FF3300
+enum {
+    EYE_PALETTE_IDLE,
+    EYE_PALETTE_LISTENING,
+    EYE_PALETTE_SPEAKING,
+    EYE_PALETTE_COUNT
+};
+
+static constexpr uint8_t EYE_PALETTE_BASE[EYE_PALETTE_COUNT][3] = {
+    { 204, 0, 0 },
+    { 255, 0, 0 },
+    { 255, 51, 0 },
+};
+
+// Scale one channel by ring scale (8.8) and brightness (0-255)
+constexpr uint8_t eye_scale_channel(uint8_t c, uint16_t ring_q8, uint8_t brightness)
+{
+    return (uint8_t)(((uint32_t)c * ring_q8 * brightness) / (256u * 255u));
+}
+
+typedef EyeTable<EyeTable<EyeTable<uint16_t, EYE_LEVELS>, EYE_RING_COUNT>, EYE_PALETTE_COUNT> EyePalette;
+
+// Pre-packed RGB565 ring colours for every built-in state, ring and brightness level
+constexpr EyePalette eye_make_palette()
+{
+    EyePalette t{};
+    for (int s = 0; s < EYE_PALETTE_COUNT; s++) {
+        for (int r = 0; r < EYE_RING_COUNT; r++) {
+            for (int l = 0; l < EYE_LEVELS; l++) {
+                uint8_t brightness = (uint8_t)((l * 255 + (EYE_LEVELS - 1) / 2) / (EYE_LEVELS - 1));
+                t.v[s].v[r].v[l] = eye_rgb565(
+                    eye_scale_channel(EYE_PALETTE_BASE[s][0], EYE_RING_SCALE_Q8[r], brightness),
+                    eye_scale_channel(EYE_PALETTE_BASE[s][1], EYE_RING_SCALE_Q8[r], brightness),
+                    eye_scale_channel(EYE_PALETTE_BASE[s][2], EYE_RING_SCALE_Q8[r], brightness)
+                );
+            }
+        }
+    }
+    return t;
+}
+
+// Pulse-driven accents: outer glow (40 * brightness, 0, 0), border (255, 50 + 30p, 0), centre (255, 180 + 40p, 0)
+constexpr EyeTable<uint16_t, EYE_LEVELS> eye_make_glow_colors()
+{
+    EyeTable<uint16_t, EYE_LEVELS> t{};
+    for (int l = 0; l < EYE_LEVELS; l++) {
+        t.v[l] = eye_rgb565((uint8_t)(40 * l / (EYE_LEVELS - 1)), 0, 0);
+    }
+    return t;
+}
+
+constexpr EyeTable<uint16_t, EYE_LEVELS> eye_make_accent_colors(int g_base, int g_swing)
+{
+    EyeTable<uint16_t, EYE_LEVELS> t{};
+    for (int l = 0; l < EYE_LEVELS; l++) {
+        t.v[l] = eye_rgb565(255, (uint8_t)(g_base + g_swing * l / (EYE_LEVELS - 1)), 0);
+    }
+    return t;
+}
+
+static constexpr EyePalette EYE_PALETTE = eye_make_palette();
+static constexpr EyeTable<uint16_t, EYE_LEVELS> EYE_GLOW_COLOR = eye_make_glow_colors();
+static constexpr EyeTable<uint16_t, EYE_LEVELS> EYE_BORDER_COLOR = eye_make_accent_colors(50, 30);
+static constexpr EyeTable<uint16_t, EYE_LEVELS> EYE_CENTER_COLOR = eye_make_accent_colors(180, 40);
+
+/* Per-frame helpers (integer only) */
+
+// Pulse value at phase_ms (< 65536) into a period of period_ms, interpolated between table entries
+static inline uint8_t eye_pulse_at(uint32_t phase_ms, uint32_t period_ms)
+{
+    uint32_t pos = (phase_ms << 16) / period_ms;        // 8.8 table index
+    uint32_t index = (pos >> 8) & 0xFF;
+    int a = EYE_SINE_PULSE[index];
+    int b = EYE_SINE_PULSE[(index + 1) & 0xFF];
+    return (uint8_t)(a + (((b - a) * (int)(pos & 0xFF)) >> 8));
+}
+
+static inline uint8_t eye_level(uint8_t brightness)
+{
+    return brightness >> 2;     // 0-255 -> 0-63
+}
+
+// Ring colour for an arbitrary (scripted) base colour
+static inline uint16_t eye_ring_color(uint8_t r, uint8_t g, uint8_t b, int ring, uint8_t brightness)
+{
+    uint32_t scale = EYE_RING_SCALE_Q8[ring] * brightness;     // 8.8 * 0-255
+    return eye_rgb565((uint8_t)((r * scale) / (256u * 255u)),
+                      (uint8_t)((g * scale) / (256u * 255u)),
+                      (uint8_t)((b * scale) / (256u * 255u)));
+}
+
+#endif // EYE_MATH_H
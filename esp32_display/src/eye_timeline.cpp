@@ -0,0 +1,54 @@
+/**
+ * HAL eye keyframe timeline engine - see eye_timeline.h
+ */
+
+#include "eye_timeline.h"
+#include "eye_math.h"
+
+static_assert((int)EYE_EASE_COUNT == (int)EYE_MATH_EASE_COUNT, "EyeEase must match the eye_math.h ease tables");
+
+static inline uint8_t lerp8(uint8_t a, uint8_t b, uint16_t w)
+{
+    return (uint8_t)(a + (((int)b - (int)a) * (int)w >> 8));
+}
+
+bool eye_timeline_eval(const EyeTimeline *timeline, int64_t elapsed_ms, EyeFrame *out)
+{
+    if (timeline->count == 0) {
+        return false;
+    }
+
+    // Play the intro once, then wrap inside the loop region
+    uint32_t t_ms;
+    if (elapsed_ms <= 0) {
+        t_ms = 0;
+    } else if (elapsed_ms >= timeline->loop_end_ms && timeline->loop_end_ms > timeline->loop_start_ms) {
+        uint32_t loop_len = timeline->loop_end_ms - timeline->loop_start_ms;
+        t_ms = timeline->loop_start_ms + (uint32_t)((elapsed_ms - timeline->loop_start_ms) % loop_len);
+    } else {
+        t_ms = (elapsed_ms > UINT16_MAX) ? UINT16_MAX : (uint32_t)elapsed_ms;
+    }
+
+    const EyeKeyframe *a = &timeline->frames[0];
+    const EyeKeyframe *b = a;
+    for (int i = 1; i < timeline->count; i++) {
+        b = &timeline->frames[i];
+        if (t_ms < b->t_ms) {
+            break;
+        }
+        a = b;
+    }
+
+    uint16_t w = 0;
+    if (b != a && b->t_ms > a->t_ms && t_ms > a->t_ms) {
+        uint32_t u = ((t_ms - a->t_ms) << 8) / (b->t_ms - a->t_ms);
+        w = EYE_EASE[a->ease < EYE_EASE_COUNT ? a->ease : (int)EYE_EASE_LINEAR][u > 255 ? 255 : u];
+    }
+
+    out->r = lerp8(a->r, b->r, w);
+    out->g = lerp8(a->g, b->g, w);
+    out->b = lerp8(a->b, b->b, w);
+    out->glow = lerp8(a->glow, b->glow, w);
+    out->brightness = lerp8(a->brightness, b->brightness, w);
+    return true;
+}
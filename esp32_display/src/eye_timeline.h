@@ -0,0 +1,60 @@
+/**
+ * HAL eye keyframe timeline engine
+ *
+ * The backend uploads one compact keyframe script per eye state (colour,
+ * glow size, brightness, easing, loop points). The display interpolates it
+ * locally every frame with 8.8 fixed-point maths and the compile-time easing
+ * tables from eye_math.h, so new expressions cost one small upload and no per-frame traffic.
+ */
+
+#ifndef EYE_TIMELINE_H
+#define EYE_TIMELINE_H
+
+#include <stdint.h>
+
+#define EYE_TIMELINE_MAX_KEYFRAMES  16
+
+// Eye states that can carry their own script
+enum EyeTimelineState {
+    EYE_STATE_IDLE,
+    EYE_STATE_LISTENING,
+    EYE_STATE_SPEAKING,
+    EYE_STATE_COUNT
+};
+
+// Easing applied from a keyframe towards the next one
+enum EyeEase {
+    EYE_EASE_LINEAR,
+    EYE_EASE_IN,
+    EYE_EASE_OUT,
+    EYE_EASE_IN_OUT,    // Half cosine, matches the classic sinusoidal pulse
+    EYE_EASE_STEP,
+    EYE_EASE_COUNT
+};
+
+typedef struct {
+    uint16_t t_ms;          // Time of this keyframe within the script
+    uint8_t r, g, b;        // Base eye colour
+    uint8_t glow;           // Outer glow growth in pixels
+    uint8_t brightness;     // Ring brightness, 255 = full
+    uint8_t ease;           // EyeEase towards the next keyframe
+} EyeKeyframe;
+
+typedef struct {
+    uint8_t count;                  // 0 = no script, use the built-in animation
+    uint16_t loop_start_ms;         // Playback repeats [loop_start_ms, loop_end_ms) once past the end
+    uint16_t loop_end_ms;
+    EyeKeyframe frames[EYE_TIMELINE_MAX_KEYFRAMES];
+} EyeTimeline;
+
+// Interpolated output for one display frame
+typedef struct {
+    uint8_t r, g, b;
+    uint8_t glow;
+    uint8_t brightness;
+} EyeFrame;
+
+// Evaluate a timeline at elapsed_ms since its origin; returns false if the timeline is empty
+bool eye_timeline_eval(const EyeTimeline *timeline, int64_t elapsed_ms, EyeFrame *out);
+
+#endif // EYE_TIMELINE_H
@@ -0,0 +1,28 @@
+/**
+ * Face frame block copy
+ *
+ * The inner loop of tft_output(): TJpg_Decoder hands over one decoded MCU
+ * block at a time and it is copied into the face canvas buffer, clipped to
+ * the view. Free of LVGL so the benchmarks can time it on host and device.
+ */
+
+#ifndef FACE_BLIT_H
+#define FACE_BLIT_H
+
+#include <stdint.h>
+
+static inline void face_blit(uint16_t *dst, int dst_w, int dst_h,
+                             int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t *bitmap)
+{
+    for (int j = 0; j < h; j++) {
+        for (int i = 0; i < w; i++) {
+            int px = x + i;
+            int py = y + j;
+            if (px < dst_w && py < dst_h) {
+                dst[py * dst_w + px] = bitmap[j * w + i];
+            }
+        }
+    }
+}
+
+#endif // FACE_BLIT_H
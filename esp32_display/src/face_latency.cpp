@@ -0,0 +1,105 @@
+/**
+ * Camera-to-glass latency tracing - see face_latency.h
+ */
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include "face_latency.h"
+#include "clock_sync.h"
+#include "lvgl_v8_port.h"
+#include "metrics.h"
+
+const char *FACE_LATENCY_HEADERS[FACE_LATENCY_HEADER_COUNT] = {
+    "X-Frame-Seq", "X-Capture-Time", "X-Server-Rx-Time", "X-Server-Tx-Time"
+};
+
+// The frame in flight between receive and scanout
+static FaceFrameStamp pending_stamp;
+static int64_t pending_received_us = 0;
+static int64_t pending_received_server_ms = 0;
+static int64_t pending_decoded_us = 0;
+static bool pending_synced = false;
+static bool pending_scanout = false;
+
+// When the canvas held the whole frame, 0 until then; written from the LVGL task
+static portMUX_TYPE shown_mux = portMUX_INITIALIZER_UNLOCKED;
+static int64_t pending_shown_us = 0;
+
+static int64_t last_seq = -1;
+
+// Clamp a stage duration into the unsigned histogram range
+static uint32_t stage(int64_t value)
+{
+    return (value < 0) ? 0 : (uint32_t)value;
+}
+
+void face_latency_received(const FaceFrameStamp *stamp, int64_t received_us)
+{
+    pending_stamp = *stamp;
+    pending_received_us = received_us;
+    pending_received_server_ms = clock_sync_server_ms();
+    pending_synced = clock_sync_valid();
+    pending_scanout = false;
+
+    // Stages on the backend's clock are exact; the hop back to the display needs the clock sync
+    if (stamp->capture_ms >= 0 && stamp->server_rx_ms >= 0) {
+        metrics_record(METRIC_FACE_AGE_MS, stage(stamp->server_rx_ms - stamp->capture_ms));
+    }
+    if (stamp->server_rx_ms >= 0 && stamp->server_tx_ms >= 0) {
+        metrics_record(METRIC_FACE_ENCODE_MS, stage(stamp->server_tx_ms - stamp->server_rx_ms));
+    }
+    if (pending_synced && stamp->server_tx_ms >= 0) {
+        metrics_record(METRIC_FACE_TRANSFER_MS, stage(pending_received_server_ms - stamp->server_tx_ms));
+    }
+}
+
+void face_latency_decoded(int64_t decoded_us, bool shown)
+{
+    pending_decoded_us = decoded_us;
+    portENTER_CRITICAL(&shown_mux);
+    pending_shown_us = shown ? decoded_us : 0;
+    portEXIT_CRITICAL(&shown_mux);
+    pending_scanout = true;
+    metrics_record(METRIC_FACE_DECODE_US, stage(decoded_us - pending_received_us));
+}
+
+void face_latency_shown(int64_t shown_us)
+{
+    portENTER_CRITICAL(&shown_mux);
+    if (pending_shown_us == 0) {
+        pending_shown_us = shown_us;
+    }
+    portEXIT_CRITICAL(&shown_mux);
+}
+
+void face_latency_poll(void)
+{
+    if (!pending_scanout) {
+        return;
+    }
+    portENTER_CRITICAL(&shown_mux);
+    int64_t shown_us = pending_shown_us;
+    portEXIT_CRITICAL(&shown_mux);
+    if (shown_us == 0) {
+        return;                             // Still blending towards it
+    }
+    // The frame was completed in the canvas under the LVGL lock, so the first flush to finish after that
+    // shows it
+    int64_t flushed_us = lvgl_port_get_last_frame_done_us();
+    if (flushed_us < shown_us) {
+        return;
+    }
+    pending_scanout = false;
+
+    metrics_record(METRIC_FACE_SCANOUT_US, stage(flushed_us - shown_us));
+    if (pending_synced && pending_stamp.capture_ms >= 0) {
+        int64_t flushed_server_ms = pending_received_server_ms + (flushed_us - pending_received_us) / 1000;
+        metrics_record(METRIC_FACE_GLASS_MS, stage(flushed_server_ms - pending_stamp.capture_ms));
+    }
+    if (pending_stamp.seq >= 0) {
+        if (last_seq >= 0 && pending_stamp.seq > last_seq) {
+            metrics_record(METRIC_FACE_SEQ_GAP, stage(pending_stamp.seq - last_seq - 1));
+        }
+        last_seq = pending_stamp.seq;
+    }
+}
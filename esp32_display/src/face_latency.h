@@ -0,0 +1,46 @@
+/**
+ * Camera-to-glass latency tracing for face mode
+ *
+ * The backend stamps every /api/hal/face_frame response with the camera
+ * frame's sequence number and capture time, plus its own request receive
+ * and send times, all on the clock displays sync to. The display adds when
+ * the body was read, when the decode finished and when LVGL flushed the
+ * frame to the panel, and records each stage into the metrics histograms
+ * (face_age_ms ... face_glass_ms), so the report shows where the lag goes.
+ *
+ * With interpolation (face_view.h) the canvas only holds the decoded frame
+ * once the blend towards it has finished, so scanout is counted from then
+ * and face_glass_ms includes the blend.
+ */
+
+#ifndef FACE_LATENCY_H
+#define FACE_LATENCY_H
+
+#include <stdint.h>
+
+// Response headers carrying the stamps, for HTTPClient::collectHeaders()
+#define FACE_LATENCY_HEADER_COUNT   4
+extern const char *FACE_LATENCY_HEADERS[FACE_LATENCY_HEADER_COUNT];
+
+// Backend stamps of one face frame, -1 where a header was missing
+typedef struct {
+    int64_t seq;
+    int64_t capture_ms;
+    int64_t server_rx_ms;
+    int64_t server_tx_ms;
+} FaceFrameStamp;
+
+// The body of a stamped frame has been read (esp_timer time)
+void face_latency_received(const FaceFrameStamp *stamp, int64_t received_us);
+
+// The frame last passed to face_latency_received() is decoded; shown is whether it went straight into the
+// canvas, false if it will be blended in (face_latency_shown() follows)
+void face_latency_decoded(int64_t decoded_us, bool shown);
+
+// The blend reached the decoded frame at shown_us; call from the LVGL task
+void face_latency_shown(int64_t shown_us);
+
+// Record the scanout stages once LVGL has flushed the frame; call from the loop
+void face_latency_poll(void);
+
+#endif // FACE_LATENCY_H
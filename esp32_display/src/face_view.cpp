@@ -0,0 +1,216 @@
+/**
+ * Face mode view - see face_view.h
+ */
+
+#include <Arduino.h>
+#include <string.h>
+#include "face_view.h"
+#include "buffer_pool.h"
+#include "face_blit.h"
+#include "pixel_blend.h"
+#include "trace.h"
+
+#define FACE_VIEW_FRAME_BYTES   (FACE_VIEW_WIDTH * FACE_VIEW_HEIGHT * sizeof(lv_color_t))
+
+static lv_obj_t *face_canvas = NULL;
+static lv_color_t *face_buffer = NULL;
+
+// Interpolation: the canvas blends from face_from to face_to
+static uint16_t *face_from = NULL;      // The canvas as the latest frame arrived
+static uint16_t *face_to = NULL;        // The latest decoded frame
+static uint16_t *face_next = NULL;      // The frame being decoded, swapped with face_to once it succeeds
+static uint16_t *decode_target = NULL;  // Where tft_output() writes: face_next or the canvas
+static int64_t to_arrival_us = 0;       // 0 before the first frame
+static uint32_t to_gap_us = 0;          // Time the blend to face_to takes
+static bool blending = false;           // The canvas has not reached face_to yet
+static uint32_t shown_alpha = 0;        // Blend on the canvas while blending
+static PixelSpan disc_spans[FACE_VIEW_HEIGHT];
+static uint32_t decoded_blocks = 0;     // tft_output() calls since face_view_frame_begin()
+
+bool face_view_create(lv_obj_t *parent)
+{
+    if (face_canvas != NULL) {
+        return true;
+    }
+
+    // Face buffer in PSRAM, only while the view exists
+    face_buffer = (lv_color_t *)buffer_pool_take("face_canvas", FACE_VIEW_WIDTH * FACE_VIEW_HEIGHT * sizeof(lv_color_t));
+    if (face_buffer == NULL) {
+        return false;                       // Counted by the pool and reported by the mode registry
+    }
+
+    // Create canvas for face display
+    face_canvas = lv_canvas_create(parent);
+    lv_canvas_set_buffer(face_canvas, face_buffer, FACE_VIEW_WIDTH, FACE_VIEW_HEIGHT, LV_IMG_CF_TRUE_COLOR);
+    lv_obj_align(face_canvas, LV_ALIGN_CENTER, 0, 0);
+
+    // Initially hidden
+    lv_obj_add_flag(face_canvas, LV_OBJ_FLAG_HIDDEN);
+
+    // Fill with black initially
+    lv_canvas_fill_bg(face_canvas, lv_color_black(), LV_OPA_COVER);
+    decode_target = (uint16_t *)face_buffer;
+    return true;
+}
+
+void face_view_destroy(void)
+{
+    if (face_canvas != NULL) {
+        lv_obj_del(face_canvas);
+        face_canvas = NULL;
+    }
+    buffer_pool_give(face_buffer);
+    buffer_pool_give(face_from);
+    buffer_pool_give(face_to);
+    buffer_pool_give(face_next);
+    face_buffer = NULL;
+    face_from = NULL;
+    face_to = NULL;
+    face_next = NULL;
+    decode_target = NULL;
+}
+
+bool face_view_ready(void)
+{
+    return face_canvas != NULL && face_buffer != NULL;
+}
+
+bool face_view_enable_interpolation(void)
+{
+    if (face_buffer == NULL) {
+        return false;
+    }
+    if (face_to != NULL) {
+        return true;
+    }
+
+    face_from = (uint16_t *)buffer_pool_take("face_from", FACE_VIEW_FRAME_BYTES);
+    face_to = (uint16_t *)buffer_pool_take("face_to", FACE_VIEW_FRAME_BYTES);
+    face_next = (uint16_t *)buffer_pool_take("face_next", FACE_VIEW_FRAME_BYTES);
+    if (face_from == NULL || face_to == NULL || face_next == NULL) {
+        buffer_pool_give(face_from);
+        buffer_pool_give(face_to);
+        buffer_pool_give(face_next);
+        face_from = NULL;
+        face_to = NULL;
+        face_next = NULL;
+        return false;
+    }
+
+    memcpy(face_to, face_buffer, FACE_VIEW_FRAME_BYTES);
+    pixel_disc_spans(disc_spans, FACE_VIEW_WIDTH, FACE_VIEW_HEIGHT);
+    decode_target = face_next;
+    to_arrival_us = 0;
+    blending = false;
+    return true;
+}
+
+bool face_view_interpolating(void)
+{
+    return face_to != NULL;
+}
+
+void face_view_frame_begin(void)
+{
+    // Nothing to hold: the decode writes face_next, which the blend never reads
+    decoded_blocks = 0;
+}
+
+uint32_t face_view_decoded_blocks(void)
+{
+    return decoded_blocks;
+}
+
+void face_view_frame_end(bool ok, int64_t now_us)
+{
+    if (!ok) {
+        // A partial frame in face_next is never shown; the blend in progress carries on
+        return;
+    }
+    if (face_to == NULL) {
+        face_view_invalidate();
+        return;
+    }
+
+    // The blend restarts from whatever is on screen, so a frame arriving early does not jump. Once the
+    // last blend has finished that is face_to (inside the disc, all the blend reads), so no copy is needed
+    uint16_t *spare = face_from;
+    if (blending) {
+        memcpy(face_from, face_buffer, FACE_VIEW_FRAME_BYTES);
+    } else {
+        face_from = face_to;
+        face_to = spare;
+    }
+    uint16_t *decoded = face_next;
+    face_next = face_to;
+    face_to = decoded;
+    decode_target = face_next;
+
+    int64_t gap_us = to_arrival_us > 0 ? now_us - to_arrival_us : 0;
+    to_arrival_us = now_us;
+    // The first frame, or one after a stall, has nothing to move from and is shown whole
+    bool cut = gap_us <= 0 || gap_us > FACE_VIEW_INTERP_MAX_GAP_MS * 1000LL;
+    to_gap_us = cut ? 0 : (uint32_t)gap_us;
+    shown_alpha = 0;
+    blending = true;
+}
+
+bool face_view_interpolate(int64_t now_us)
+{
+    if (face_to == NULL || face_canvas == NULL || !blending) {
+        return false;
+    }
+
+    uint32_t alpha = PIXEL_BLEND_ALPHA_MAX;
+    int64_t elapsed_us = now_us - to_arrival_us;
+    if (to_gap_us > 0 && elapsed_us < (int64_t)to_gap_us) {
+        alpha = (uint32_t)(elapsed_us * PIXEL_BLEND_ALPHA_MAX / to_gap_us);
+    }
+    if (alpha == shown_alpha) {
+        return false;                       // Same step as the last display frame, nothing to redraw
+    }
+
+    TRACE_SCOPE_ARG("face_interp", alpha);
+    pixel_blend_disc((uint16_t *)face_buffer, face_from, face_to, FACE_VIEW_WIDTH, FACE_VIEW_HEIGHT,
+                     disc_spans, alpha);
+    shown_alpha = alpha;
+    blending = alpha < PIXEL_BLEND_ALPHA_MAX;
+    lv_obj_invalidate(face_canvas);
+    return !blending;
+}
+
+void face_view_set_visible(bool visible)
+{
+    if (face_canvas == NULL) {
+        return;
+    }
+    if (visible) {
+        lv_obj_clear_flag(face_canvas, LV_OBJ_FLAG_HIDDEN);
+    } else {
+        lv_obj_add_flag(face_canvas, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+void face_view_invalidate(void)
+{
+    if (face_canvas) {
+        lv_obj_invalidate(face_canvas);
+    }
+}
+
+const lv_color_t *face_view_pixels(void)
+{
+    return face_buffer;
+}
+
+bool tft_output(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t *bitmap)
+{
+    if (face_canvas == NULL || decode_target == NULL) return false;
+    // Counted rather than traced: a span per block would be ~900 per frame and flood the trace ring
+    decoded_blocks++;
+
+    // Copy decoded pixels to the canvas buffer, or the frame being interpolated to
+    static_assert(sizeof(lv_color_t) == sizeof(uint16_t), "The face canvas is RGB565");
+    face_blit(decode_target, FACE_VIEW_WIDTH, FACE_VIEW_HEIGHT, x, y, w, h, bitmap);
+    return true;
+}
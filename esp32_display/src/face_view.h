@@ -0,0 +1,74 @@
+/**
+ * Face mode view
+ *
+ * A full-screen LVGL canvas backed by a PSRAM frame buffer. TJpg_Decoder
+ * writes decoded face frames straight into that buffer through tft_output().
+ * The buffer (450 KB) comes from the buffer pool and only exists between
+ * face_view_create() and face_view_destroy(), i.e. while face mode is active.
+ *
+ * Frames arrive at 5 fps at best. With interpolation on, each frame is
+ * decoded into a buffer of its own instead, and every display frame
+ * face_view_interpolate() blends from what was on screen when it arrived
+ * to the new frame (pixel_blend.h, visible disc only), taking as long as
+ * the gap before it. Motion looks smoother for one frame interval of
+ * added latency. A frame after a gap of more than
+ * FACE_VIEW_INTERP_MAX_GAP_MS (the first one, or after a stall) is shown
+ * straight away. Decodes go to a spare buffer that only becomes the new
+ * frame once the decode succeeds, so a failed one leaves the blend in
+ * progress alone. Interpolation needs three more pool buffers.
+ */
+
+#ifndef FACE_VIEW_H
+#define FACE_VIEW_H
+
+#include <stdint.h>
+#include <lvgl.h>
+
+#define FACE_VIEW_WIDTH     480
+#define FACE_VIEW_HEIGHT    480
+#define FACE_VIEW_INTERP_MAX_GAP_MS     1000
+
+// Take the frame buffer and create the (hidden, black) canvas on parent; no-op if it exists.
+// Call with the LVGL lock held
+bool face_view_create(lv_obj_t *parent);
+
+// Delete the canvas and give the frame buffer back to the pool; call with the LVGL lock held
+void face_view_destroy(void);
+
+// True once the canvas and its buffer exist
+bool face_view_ready(void);
+
+// Decode frames into a buffer of their own and blend towards them from now on; false (frames keep going
+// straight to the canvas) if the buffers are not available. Call after face_view_create(), LVGL lock held
+bool face_view_enable_interpolation(void);
+
+// True while decoded frames are being interpolated
+bool face_view_interpolating(void);
+
+// Bracket each JPEG decode; ok is whether it succeeded. Call both with the LVGL lock held. While
+// interpolating, the decode between them writes to a frame the LVGL task does not read and may run unlocked.
+// The view must not be destroyed in between
+void face_view_frame_begin(void);
+void face_view_frame_end(bool ok, int64_t now_us);
+
+// Blocks (MCUs) tft_output() has written since face_view_frame_begin()
+uint32_t face_view_decoded_blocks(void);
+
+// Blend one display frame at time now_us (esp_timer_get_time()); no-op once the latest frame is fully
+// shown. True if this call completed the blend to it. Call with the LVGL lock held
+bool face_view_interpolate(int64_t now_us);
+
+// Show or hide the canvas; call with the LVGL lock held
+void face_view_set_visible(bool visible);
+
+// Redraw after new pixels were written; call with the LVGL lock held
+void face_view_invalidate(void);
+
+// The canvas pixels, FACE_VIEW_WIDTH x FACE_VIEW_HEIGHT (NULL before face_view_create)
+const lv_color_t *face_view_pixels(void);
+
+// JPEG decoder callback - copies one decoded block into the canvas buffer, or the frame being
+// interpolated to
+bool tft_output(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t *bitmap);
+
+#endif // FACE_VIEW_H
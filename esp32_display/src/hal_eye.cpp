@@ -0,0 +1,201 @@
+/**
+ * HAL 9000 eye rendering - see hal_eye.h
+ */
+
+#include "hal_eye.h"
+#include "eye_math.h"
+
+// LVGL objects for HAL eye layers (outer to inner)
+static lv_obj_t *outer_glow = NULL;
+static lv_obj_t *ring_1 = NULL;
+static lv_obj_t *ring_2 = NULL;
+static lv_obj_t *ring_3 = NULL;
+static lv_obj_t *ring_4 = NULL;
+static lv_obj_t *main_eye = NULL;
+static lv_obj_t *center_yellow = NULL;
+static lv_obj_t *center_highlight = NULL;
+
+// Wrap a packed RGB565 value from the eye tables as an LVGL colour
+static inline lv_color_t color565(uint16_t value)
+{
+    lv_color_t color;
+    color.full = value;
+    return color;
+}
+
+void hal_eye_create(lv_obj_t *parent)
+{
+    // Create outer glow circle (pulsing, darkest)
+    outer_glow = lv_obj_create(parent);
+    lv_obj_remove_style_all(outer_glow);
+    lv_obj_set_size(outer_glow, EYE_OUTER_RADIUS * 2 + 30, EYE_OUTER_RADIUS * 2 + 30);
+    lv_obj_align(outer_glow, LV_ALIGN_CENTER, 0, 0);
+    lv_obj_set_style_bg_color(outer_glow, lv_color_make(40, 0, 0), 0);
+    lv_obj_set_style_bg_opa(outer_glow, LV_OPA_COVER, 0);
+    lv_obj_set_style_radius(outer_glow, LV_RADIUS_CIRCLE, 0);
+    lv_obj_set_style_border_width(outer_glow, 0, 0);
+
+    // Gradient ring 1 (dark red)
+    ring_1 = lv_obj_create(parent);
+    lv_obj_remove_style_all(ring_1);
+    lv_obj_set_size(ring_1, EYE_RING_1_RADIUS * 2, EYE_RING_1_RADIUS * 2);
+    lv_obj_align(ring_1, LV_ALIGN_CENTER, 0, 0);
+    lv_obj_set_style_bg_color(ring_1, lv_color_make(80, 0, 0), 0);
+    lv_obj_set_style_bg_opa(ring_1, LV_OPA_COVER, 0);
+    lv_obj_set_style_radius(ring_1, LV_RADIUS_CIRCLE, 0);
+    lv_obj_set_style_border_width(ring_1, 0, 0);
+
+    // Gradient ring 2
+    ring_2 = lv_obj_create(parent);
+    lv_obj_remove_style_all(ring_2);
+    lv_obj_set_size(ring_2, EYE_RING_2_RADIUS * 2, EYE_RING_2_RADIUS * 2);
+    lv_obj_align(ring_2, LV_ALIGN_CENTER, 0, 0);
+    lv_obj_set_style_bg_color(ring_2, lv_color_make(120, 0, 0), 0);
+    lv_obj_set_style_bg_opa(ring_2, LV_OPA_COVER, 0);
+    lv_obj_set_style_radius(ring_2, LV_RADIUS_CIRCLE, 0);
+    lv_obj_set_style_border_width(ring_2, 0, 0);
+
+    // Gradient ring 3
+    ring_3 = lv_obj_create(parent);
+    lv_obj_remove_style_all(ring_3);
+    lv_obj_set_size(ring_3, EYE_RING_3_RADIUS * 2, EYE_RING_3_RADIUS * 2);
+    lv_obj_align(ring_3, LV_ALIGN_CENTER, 0, 0);
+    lv_obj_set_style_bg_color(ring_3, lv_color_make(160, 0, 0), 0);
+    lv_obj_set_style_bg_opa(ring_3, LV_OPA_COVER, 0);
+    lv_obj_set_style_radius(ring_3, LV_RADIUS_CIRCLE, 0);
+    lv_obj_set_style_border_width(ring_3, 0, 0);
+
+    // Gradient ring 4
+    ring_4 = lv_obj_create(parent);
+    lv_obj_remove_style_all(ring_4);
+    lv_obj_set_size(ring_4, EYE_RING_4_RADIUS * 2, EYE_RING_4_RADIUS * 2);
+    lv_obj_align(ring_4, LV_ALIGN_CENTER, 0, 0);
+    lv_obj_set_style_bg_color(ring_4, lv_color_make(190, 0, 0), 0);
+    lv_obj_set_style_bg_opa(ring_4, LV_OPA_COVER, 0);
+    lv_obj_set_style_radius(ring_4, LV_RADIUS_CIRCLE, 0);
+    lv_obj_set_style_border_width(ring_4, 0, 0);
+
+    // Main inner eye circle (brightest red)
+    main_eye = lv_obj_create(parent);
+    lv_obj_remove_style_all(main_eye);
+    lv_obj_set_size(main_eye, EYE_INNER_RADIUS * 2, EYE_INNER_RADIUS * 2);
+    lv_obj_align(main_eye, LV_ALIGN_CENTER, 0, 0);
+    lv_obj_set_style_bg_color(main_eye, lv_color_make(220, 0, 0), 0);
+    lv_obj_set_style_bg_opa(main_eye, LV_OPA_COVER, 0);
+    lv_obj_set_style_radius(main_eye, LV_RADIUS_CIRCLE, 0);
+    lv_obj_set_style_border_color(main_eye, lv_color_make(255, 50, 0), 0);
+    lv_obj_set_style_border_width(main_eye, 2, 0);
+
+    // Center yellow/orange spot
+    center_yellow = lv_obj_create(parent);
+    lv_obj_remove_style_all(center_yellow);
+    lv_obj_set_size(center_yellow, EYE_CENTER_RADIUS * 2, EYE_CENTER_RADIUS * 2);
+    lv_obj_align(center_yellow, LV_ALIGN_CENTER, 0, 0);
+    lv_obj_set_style_bg_color(center_yellow, lv_color_make(255, 180, 0), 0);
+    lv_obj_set_style_bg_opa(center_yellow, LV_OPA_COVER, 0);
+    lv_obj_set_style_radius(center_yellow, LV_RADIUS_CIRCLE, 0);
+    lv_obj_set_style_border_width(center_yellow, 0, 0);
+
+    // Center highlight (white reflection)
+    center_highlight = lv_obj_create(parent);
+    lv_obj_remove_style_all(center_highlight);
+    lv_obj_set_size(center_highlight, EYE_HIGHLIGHT_RADIUS * 2, EYE_HIGHLIGHT_RADIUS * 2);
+    lv_obj_align(center_highlight, LV_ALIGN_CENTER, -4, -4);
+    lv_obj_set_style_bg_color(center_highlight, lv_color_white(), 0);
+    lv_obj_set_style_bg_opa(center_highlight, LV_OPA_80, 0);
+    lv_obj_set_style_radius(center_highlight, LV_RADIUS_CIRCLE, 0);
+    lv_obj_set_style_border_width(center_highlight, 0, 0);
+}
+
+void hal_eye_destroy(void)
+{
+    lv_obj_t **layers[] = { &outer_glow, &ring_1, &ring_2, &ring_3, &ring_4, &main_eye, &center_yellow, &center_highlight };
+    for (lv_obj_t **layer : layers) {
+        if (*layer != NULL) {
+            lv_obj_del(*layer);
+            *layer = NULL;
+        }
+    }
+}
+
+void hal_eye_set_visible(bool visible)
+{
+    if (main_eye == NULL) {
+        return;
+    }
+    lv_obj_t *layers[] = { outer_glow, ring_1, ring_2, ring_3, ring_4, main_eye, center_yellow, center_highlight };
+    for (lv_obj_t *layer : layers) {
+        if (visible) {
+            lv_obj_clear_flag(layer, LV_OBJ_FLAG_HIDDEN);
+        } else {
+            lv_obj_add_flag(layer, LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+}
+
+void hal_eye_render(const HalEyeInput *input)
+{
+    if (main_eye == NULL) {
+        return;
+    }
+
+    // Sinusoidal pulse calculation
+    uint32_t pulse_period = PULSE_PERIOD_IDLE_MS;  // Normal idle speed
+    int palette = EYE_PALETTE_IDLE;                // Deep red when idle (#CC0000)
+    if (input->state == EYE_STATE_LISTENING) {
+        pulse_period = PULSE_PERIOD_LISTENING_MS;  // Faster when listening
+        palette = EYE_PALETTE_LISTENING;           // Bright red when listening
+    } else if (input->state == EYE_STATE_SPEAKING) {
+        pulse_period = PULSE_PERIOD_SPEAKING_MS;   // Medium when speaking
+        palette = EYE_PALETTE_SPEAKING;            // Orange-red when speaking (#FF3300)
+    }
+
+    // Phase comes from the synchronised backend clock so all displays pulse together
+    int64_t phase = input->now_ms % pulse_period;
+    uint32_t phase_ms = (uint32_t)(phase < 0 ? phase + pulse_period : phase);
+
+    // Smooth sinusoidal pulse (0-255) and the brightness it implies (0.7-1.0 of full)
+    uint8_t pulse = eye_pulse_at(phase_ms, pulse_period);
+    uint8_t brightness = EYE_PULSE_BRIGHTNESS[pulse];
+    int pulse_offset = (pulse * 20) >> 8;
+
+    // A backend script for this state replaces the built-in pulse
+    EyeFrame frame;
+    bool scripted = (input->script != NULL) && eye_timeline_eval(input->script, input->script_elapsed_ms, &frame);
+    if (scripted) {
+        brightness = frame.brightness;
+        pulse_offset = frame.glow;
+        pulse = (frame.glow >= 20) ? 255 : (frame.glow * 255) / 20;
+    }
+
+    // The speech envelope overrides both, so HAL visibly talks
+    int level = input->envelope_level;
+    if (level >= 0) {
+        pulse = level;
+        brightness = EYE_ENVELOPE_BRIGHTNESS[level];
+        pulse_offset = (pulse * 20) >> 8;
+    }
+
+    // Update outer glow size based on pulse
+    int glow_size = (EYE_OUTER_RADIUS * 2) + 30 + pulse_offset;
+    lv_obj_set_size(outer_glow, glow_size, glow_size);
+    lv_obj_align(outer_glow, LV_ALIGN_CENTER, 0, 0);
+
+    // Update glow color
+    uint8_t brightness_level = eye_level(brightness);
+    lv_obj_set_style_bg_color(outer_glow, color565(EYE_GLOW_COLOR[brightness_level]), 0);
+
+    // Update ring colors with gradient based on state (precomputed for the built-in colours)
+    lv_obj_t *rings[EYE_RING_COUNT] = { ring_1, ring_2, ring_3, ring_4, main_eye };
+    for (int i = 0; i < EYE_RING_COUNT; i++) {
+        uint16_t color = scripted ? eye_ring_color(frame.r, frame.g, frame.b, i, brightness)
+                                  : EYE_PALETTE[palette][i][brightness_level];
+        lv_obj_set_style_bg_color(rings[i], color565(color), 0);
+    }
+
+    // Update border glow
+    lv_obj_set_style_border_color(main_eye, color565(EYE_BORDER_COLOR[pulse >> 2]), 0);
+
+    // Subtle center yellow/white pulsing
+    lv_obj_set_style_bg_color(center_yellow, color565(EYE_CENTER_COLOR[pulse >> 2]), 0);
+}
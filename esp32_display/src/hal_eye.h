@@ -0,0 +1,53 @@
+/**
+ * HAL 9000 eye rendering
+ *
+ * Builds the eye's LVGL objects and restyles them for one animation frame.
+ * It only depends on LVGL and the eye maths, not on WiFi, the clock sync or
+ * the backend protocol, so the host (native) build renders exactly what the
+ * display shows.
+ */
+
+#ifndef HAL_EYE_H
+#define HAL_EYE_H
+
+#include <stdint.h>
+#include <lvgl.h>
+#include "eye_timeline.h"
+
+// HAL eye parameters - movie accurate
+#define EYE_OUTER_RADIUS    140
+#define EYE_RING_1_RADIUS   130
+#define EYE_RING_2_RADIUS   118
+#define EYE_RING_3_RADIUS   105
+#define EYE_RING_4_RADIUS   90
+#define EYE_INNER_RADIUS    75
+#define EYE_CENTER_RADIUS   30
+#define EYE_HIGHLIGHT_RADIUS 12
+
+// Pulse periods in milliseconds of backend time, shared by every display
+#define PULSE_PERIOD_IDLE_MS        3142
+#define PULSE_PERIOD_LISTENING_MS   1047
+#define PULSE_PERIOD_SPEAKING_MS    1571
+
+// Everything one eye frame depends on
+typedef struct {
+    EyeTimelineState state;
+    int64_t now_ms;                 // Synchronised backend clock, sets the built-in pulse phase
+    const EyeTimeline *script;      // Backend keyframe script for this state (may be empty or NULL)
+    int64_t script_elapsed_ms;      // Position within the script
+    int envelope_level;             // Speech envelope level 0-255, or -1 for none
+} HalEyeInput;
+
+// Create the eye objects on parent; call with the LVGL lock held
+void hal_eye_create(lv_obj_t *parent);
+
+// Delete the eye objects (no-op if they do not exist); call with the LVGL lock held
+void hal_eye_destroy(void);
+
+// Show or hide every eye layer; call with the LVGL lock held
+void hal_eye_set_visible(bool visible);
+
+// Restyle the eye for one frame (no-op without the eye objects); call with the LVGL lock held
+void hal_eye_render(const HalEyeInput *input);
+
+#endif // HAL_EYE_H
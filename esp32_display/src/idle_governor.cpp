@@ -0,0 +1,206 @@
+/**
+ * Idle power governor - see idle_governor.h
+ */
+
+#include "idle_governor.h"
+#include "config.h"
+#include "lvgl_v8_port.h"
+#include "log_sink.h"
+#include "power_manager.h"
+
+using namespace esp_panel::drivers;
+
+#define GOVERNOR_MAX_CPU_MHZ        240
+
+static const char *const MODE_NAMES[POWER_MODE_COUNT] = { "active", "idle" };
+
+typedef struct {
+    uint64_t ms;
+    uint64_t busy_us;                   // LVGL task rendering time
+    uint32_t frames;
+} ModeStats;
+
+static Backlight *panel_backlight = NULL;
+
+// Loop task only
+static uint32_t last_activity_ms = 0;
+static uint32_t last_account_ms = 0;
+static uint32_t last_busy_us = 0;
+static uint32_t last_frames = 0;
+
+// Written by the loop, read by the diagnostics server, under governor_mux
+static portMUX_TYPE governor_mux = portMUX_INITIALIZER_UNLOCKED;
+static PowerMode mode = POWER_MODE_ACTIVE;
+static ModeStats stats[POWER_MODE_COUNT];
+static uint32_t idle_entries = 0;
+static uint32_t backlight_percent = 100;
+
+static void set_backlight(uint32_t percent)
+{
+    if (panel_backlight == NULL || percent == backlight_percent) {
+        return;
+    }
+    if (!panel_backlight->setBrightness((int)percent)) {
+        LOG("Backlight %lu%% rejected", (unsigned long)percent);
+        return;
+    }
+    portENTER_CRITICAL(&governor_mux);
+    backlight_percent = percent;
+    portEXIT_CRITICAL(&governor_mux);
+}
+
+// Charge the time, LVGL busy time and frames since the last call to the current mode
+static void account(uint32_t now)
+{
+    uint32_t busy_us = lvgl_port_get_busy_us();
+    uint32_t frames = lvgl_port_get_frame_count();
+
+    portENTER_CRITICAL(&governor_mux);
+    ModeStats *s = &stats[mode];
+    s->ms += now - last_account_ms;
+    s->busy_us += busy_us - last_busy_us;
+    s->frames += frames - last_frames;
+    portEXIT_CRITICAL(&governor_mux);
+
+    last_account_ms = now;
+    last_busy_us = busy_us;
+    last_frames = frames;
+}
+
+static void enter(PowerMode new_mode)
+{
+    account(millis());
+    portENTER_CRITICAL(&governor_mux);
+    mode = new_mode;
+    if (new_mode == POWER_MODE_IDLE) {
+        idle_entries++;
+    }
+    portEXIT_CRITICAL(&governor_mux);
+    idle_governor_apply();
+}
+
+void idle_governor_begin(Backlight *backlight)
+{
+    panel_backlight = backlight;
+    last_activity_ms = millis();
+    last_account_ms = last_activity_ms;
+    last_busy_us = lvgl_port_get_busy_us();
+    last_frames = lvgl_port_get_frame_count();
+    backlight_percent = 0;              // Unknown until set, so the first apply always writes it
+    idle_governor_apply();
+}
+
+bool idle_governor_activity(void)
+{
+    last_activity_ms = millis();
+    if (mode == POWER_MODE_ACTIVE) {
+        return false;
+    }
+    enter(POWER_MODE_ACTIVE);
+    LOG("Leaving idle");
+    return true;
+}
+
+bool idle_governor_poll(void)
+{
+    uint32_t now = millis();
+    account(now);
+
+    uint32_t idle_after_ms = config_get(CONFIG_IDLE_AFTER_MS);
+    if (mode == POWER_MODE_IDLE) {
+        if (idle_after_ms == 0) {
+            enter(POWER_MODE_ACTIVE);   // Idling was switched off
+            return true;
+        }
+        return false;
+    }
+    if (idle_after_ms == 0 || now - last_activity_ms < idle_after_ms) {
+        return false;
+    }
+    enter(POWER_MODE_IDLE);
+    LOG("Idle after %lu s without activity", (unsigned long)((now - last_activity_ms) / 1000));
+    return true;
+}
+
+void idle_governor_apply(void)
+{
+    if (mode == POWER_MODE_IDLE) {
+        power_manager_set_max_mhz(config_get(CONFIG_IDLE_CPU_MHZ));
+        set_backlight(config_get(CONFIG_IDLE_BACKLIGHT));
+    } else {
+        power_manager_set_max_mhz(GOVERNOR_MAX_CPU_MHZ);
+        set_backlight(config_get(CONFIG_BACKLIGHT));
+    }
+}
+
+PowerMode idle_governor_mode(void)
+{
+    return mode;
+}
+
+uint32_t idle_governor_eye_divisor(void)
+{
+    return config_get(mode == POWER_MODE_IDLE ? CONFIG_IDLE_EYE_DIVISOR : CONFIG_EYE_VSYNC_DIVISOR);
+}
+
+uint32_t idle_governor_eye_period_ms(void)
+{
+    return config_get(mode == POWER_MODE_IDLE ? CONFIG_IDLE_FRAME_PERIOD_MS : CONFIG_EYE_FRAME_PERIOD_MS);
+}
+
+// LVGL busy share in percent and frames per second for one mode's accumulated time
+static void mode_rates(const ModeStats *s, float *busy_pct, float *fps)
+{
+    *busy_pct = s->ms ? (float)s->busy_us / (float)(s->ms * 10) : 0.0f;
+    *fps = s->ms ? (float)s->frames * 1000.0f / (float)s->ms : 0.0f;
+}
+
+void idle_governor_report(JsonDocument &doc)
+{
+    ModeStats snapshot[POWER_MODE_COUNT];
+    portENTER_CRITICAL(&governor_mux);
+    PowerMode current = mode;
+    memcpy(snapshot, stats, sizeof(snapshot));
+    uint32_t entries = idle_entries;
+    uint32_t mhz = power_manager_max_mhz();
+    uint32_t backlight = backlight_percent;
+    portEXIT_CRITICAL(&governor_mux);
+
+    JsonObject power = doc["power"].to<JsonObject>();
+    power["mode"] = MODE_NAMES[current];
+    power["cpu_mhz"] = mhz;
+    power["backlight"] = backlight;
+    power["idle_entries"] = entries;
+    for (int i = 0; i < POWER_MODE_COUNT; i++) {
+        float busy_pct, fps;
+        mode_rates(&snapshot[i], &busy_pct, &fps);
+        JsonObject m = power[MODE_NAMES[i]].to<JsonObject>();
+        m["s"] = (uint32_t)(snapshot[i].ms / 1000);
+        m["lvgl_busy_pct"] = busy_pct;
+        m["fps"] = fps;
+    }
+}
+
+void idle_governor_write_text(Print &out)
+{
+    ModeStats snapshot[POWER_MODE_COUNT];
+    portENTER_CRITICAL(&governor_mux);
+    PowerMode current = mode;
+    memcpy(snapshot, stats, sizeof(snapshot));
+    uint32_t entries = idle_entries;
+    uint32_t mhz = power_manager_max_mhz();
+    uint32_t backlight = backlight_percent;
+    portEXIT_CRITICAL(&governor_mux);
+
+    for (int i = 0; i < POWER_MODE_COUNT; i++) {
+        float busy_pct, fps;
+        mode_rates(&snapshot[i], &busy_pct, &fps);
+        out.printf("hal_power_mode{mode=\"%s\"} %d\n", MODE_NAMES[i], current == i ? 1 : 0);
+        out.printf("hal_power_seconds_total{mode=\"%s\"} %lu\n", MODE_NAMES[i], (unsigned long)(snapshot[i].ms / 1000));
+        out.printf("hal_power_lvgl_busy_pct{mode=\"%s\"} %.1f\n", MODE_NAMES[i], busy_pct);
+        out.printf("hal_power_fps{mode=\"%s\"} %.1f\n", MODE_NAMES[i], fps);
+    }
+    out.printf("hal_power_idle_entries %lu\n", (unsigned long)entries);
+    out.printf("hal_power_cpu_mhz %lu\n", (unsigned long)mhz);
+    out.printf("hal_power_backlight_pct %lu\n", (unsigned long)backlight);
+}
@@ -0,0 +1,59 @@
+/**
+ * Idle power governor
+ *
+ * The display otherwise renders at full rate with the CPU at 240 MHz and the
+ * backlight at full brightness around the clock. Once nobody has been
+ * present (per /api/hal/display) and the HAL state has not changed for
+ * idle_after_ms (config.h), the governor drops into idle:
+ *  - the eye is paced with idle_divisor / idle_period_ms instead of the
+ *    normal eye pacing (applied by the loop, see idle_governor_eye_*()),
+ *  - the CPU is capped at idle_cpu_mhz (power_manager.h),
+ *  - the backlight goes from backlight to idle_backlight percent.
+ * Any activity restores all three straight away.
+ *
+ * Time in each mode, the LVGL task's busy share and the frame rate are
+ * accounted per mode, so a power meter reading taken in each mode can be
+ * set against what the device was doing. The board has no current sense,
+ * so power itself is not measured here.
+ */
+
+#ifndef IDLE_GOVERNOR_H
+#define IDLE_GOVERNOR_H
+
+#include <stdint.h>
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <esp_display_panel.hpp>
+
+enum PowerMode {
+    POWER_MODE_ACTIVE,
+    POWER_MODE_IDLE,
+    POWER_MODE_COUNT
+};
+
+// Start in active mode; backlight may be NULL if the board has none. Call once after the board is up
+void idle_governor_begin(esp_panel::drivers::Backlight *backlight);
+
+// Someone is present or the state changed; leaves idle immediately. Returns true if the mode changed
+bool idle_governor_activity(void);
+
+// Account the time since the last call and enter idle once it is due. Returns true if the mode changed.
+// Call from the loop
+bool idle_governor_poll(void);
+
+// Re-apply the current mode's CPU cap and backlight, after their settings changed
+void idle_governor_apply(void);
+
+PowerMode idle_governor_mode(void);
+
+// Eye pacing for the current mode
+uint32_t idle_governor_eye_divisor(void);
+uint32_t idle_governor_eye_period_ms(void);
+
+// Add {"power": {"mode", "cpu_mhz", "backlight", "idle_entries", per-mode residency}} to doc
+void idle_governor_report(JsonDocument &doc);
+
+// Write the same as Prometheus-style text for the diagnostics server
+void idle_governor_write_text(Print &out);
+
+#endif // IDLE_GOVERNOR_H
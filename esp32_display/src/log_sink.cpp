@@ -0,0 +1,165 @@
+/**
+ * Non-blocking log sink - see log_sink.h
+ */
+
+#include <Arduino.h>
+#include <stdarg.h>
+#include "log_sink.h"
+
+#define LOG_DRAIN_PERIOD_MS     50
+#define LOG_DRAIN_STACK         3072
+#define LOG_DRAIN_PRIORITY      1       // Above idle only
+
+static_assert((LOG_RING_SIZE & (LOG_RING_SIZE - 1)) == 0, "LOG_RING_SIZE must be a power of two");
+
+typedef struct {
+    uint32_t time_ms;
+    uint32_t suppressed;
+    char text[LOG_MESSAGE_MAX];
+} LogLine;
+
+// Vyukov bounded queue: a cell is free for the producer at position p when its sequence is p,
+// and holds a line for the consumer when it is p + 1. Cells store the sequence minus their index,
+// so the zero-initialised array is already a valid empty ring and logging works before any init
+typedef struct {
+    uint32_t seq;
+    LogLine line;
+} LogCell;
+
+static LogCell cells[LOG_RING_SIZE];
+static uint32_t enqueue_pos = 0;
+static uint32_t dequeue_pos = 0;
+static uint32_t dropped = 0;
+
+static LogSite *sites = NULL;           // Every site that has logged, newest first
+
+static inline uint32_t cell_seq(uint32_t index)
+{
+    return __atomic_load_n(&cells[index].seq, __ATOMIC_ACQUIRE) + index;
+}
+
+static inline void cell_publish(uint32_t index, uint32_t seq)
+{
+    __atomic_store_n(&cells[index].seq, seq - index, __ATOMIC_RELEASE);
+}
+
+// Claim a free cell; false if the ring is full
+static bool ring_claim(uint32_t *pos_out)
+{
+    uint32_t pos = __atomic_load_n(&enqueue_pos, __ATOMIC_RELAXED);
+    while (true) {
+        int32_t diff = (int32_t)(cell_seq(pos & (LOG_RING_SIZE - 1)) - pos);
+        if (diff == 0) {
+            if (__atomic_compare_exchange_n(&enqueue_pos, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                *pos_out = pos;
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = __atomic_load_n(&enqueue_pos, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+static void register_site(LogSite *site)
+{
+    if (__atomic_exchange_n(&site->registered, 1, __ATOMIC_ACQ_REL)) {
+        return;
+    }
+    LogSite *head = __atomic_load_n(&sites, __ATOMIC_RELAXED);
+    do {
+        site->next = head;
+    } while (!__atomic_compare_exchange_n(&sites, &head, site, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+
+void log_site_write(LogSite *site, ...)
+{
+    register_site(site);
+    __atomic_add_fetch(&site->count, 1, __ATOMIC_RELAXED);
+
+    uint32_t now = millis();
+    if (site->interval_ms != 0 && site->last_emit_ms != 0 && now - site->last_emit_ms < site->interval_ms) {
+        __atomic_add_fetch(&site->suppressed, 1, __ATOMIC_RELAXED);
+        __atomic_add_fetch(&site->pending_suppressed, 1, __ATOMIC_RELAXED);
+        return;
+    }
+    site->last_emit_ms = now ? now : 1;
+
+    uint32_t pos;
+    if (!ring_claim(&pos)) {
+        __atomic_add_fetch(&dropped, 1, __ATOMIC_RELAXED);
+        return;
+    }
+
+    uint32_t index = pos & (LOG_RING_SIZE - 1);
+    LogLine *line = &cells[index].line;
+    line->time_ms = now;
+    line->suppressed = __atomic_exchange_n(&site->pending_suppressed, 0, __ATOMIC_RELAXED);
+    va_list args;
+    va_start(args, site);
+    vsnprintf(line->text, sizeof(line->text), site->format, args);
+    va_end(args);
+
+    cell_publish(index, pos + 1);
+}
+
+// Single consumer: the drain task
+static bool ring_take(LogLine *out)
+{
+    uint32_t pos = dequeue_pos;
+    uint32_t index = pos & (LOG_RING_SIZE - 1);
+    if (cell_seq(index) != pos + 1) {
+        return false;
+    }
+    *out = cells[index].line;
+    cell_publish(index, pos + LOG_RING_SIZE);
+    dequeue_pos = pos + 1;
+    return true;
+}
+
+static void log_drain_task(void *arg)
+{
+    static LogLine line;
+    uint32_t reported_dropped = 0;
+
+    while (true) {
+        while (ring_take(&line)) {
+            Serial.printf("[%lu] %s", (unsigned long)line.time_ms, line.text);
+            if (line.suppressed) {
+                Serial.printf(" (+%lu suppressed)", (unsigned long)line.suppressed);
+            }
+            Serial.println();
+        }
+
+        uint32_t now_dropped = __atomic_load_n(&dropped, __ATOMIC_RELAXED);
+        if (now_dropped != reported_dropped) {
+            Serial.printf("[log] %lu lines dropped, ring full\n", (unsigned long)(now_dropped - reported_dropped));
+            reported_dropped = now_dropped;
+        }
+
+        vTaskDelay(pdMS_TO_TICKS(LOG_DRAIN_PERIOD_MS));
+    }
+}
+
+void log_sink_init(void)
+{
+    xTaskCreate(log_drain_task, "log", LOG_DRAIN_STACK, NULL, LOG_DRAIN_PRIORITY, NULL);
+}
+
+uint32_t log_sink_dropped(void)
+{
+    return __atomic_load_n(&dropped, __ATOMIC_RELAXED);
+}
+
+void log_sink_report(JsonDocument &doc)
+{
+    doc["log_dropped"] = log_sink_dropped();
+    JsonArray out = doc["log_sites"].to<JsonArray>();
+    for (LogSite *site = __atomic_load_n(&sites, __ATOMIC_ACQUIRE); site != NULL; site = site->next) {
+        JsonObject entry = out.add<JsonObject>();
+        entry["format"] = site->format;
+        entry["count"] = site->count;
+        entry["suppressed"] = site->suppressed;
+    }
+}
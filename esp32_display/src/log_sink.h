@@ -0,0 +1,59 @@
+/**
+ * Non-blocking log sink
+ *
+ * LOG() formats into a fixed slot of a lock-free multi-producer ring
+ * (Vyukov's bounded queue) and returns; a low-priority task drains the ring
+ * to Serial, so the render and network paths never block on USB-CDC and
+ * never allocate. When the ring is full the line is dropped and counted.
+ *
+ * Every call site keeps its own counters. LOG_EVERY_MS() also rate-limits
+ * its site: lines inside the interval only bump the counter, and the next
+ * line that is printed says how many were suppressed. The per-site counters
+ * go out with the metrics report.
+ *
+ *   LOG("Switched to %s mode", name);
+ *   LOG_EVERY_MS(5000, "Face frame fetch failed: %d", code);
+ */
+
+#ifndef LOG_SINK_H
+#define LOG_SINK_H
+
+#include <stdint.h>
+#include <ArduinoJson.h>
+
+#define LOG_RING_SIZE       64      // Lines in flight, a power of two
+#define LOG_MESSAGE_MAX     120     // Longer lines are truncated
+
+// Per-call-site state, one static instance per LOG() expansion
+typedef struct LogSite {
+    const char *format;
+    uint32_t interval_ms;           // 0 = no rate limit
+    uint32_t count;                 // Every call, printed or not
+    uint32_t suppressed;            // Calls swallowed by the rate limit
+    uint32_t pending_suppressed;    // Swallowed since the last printed line
+    uint32_t last_emit_ms;
+    uint8_t registered;
+    struct LogSite *next;
+} LogSite;
+
+// Start the drain task; lines logged earlier wait in the ring
+void log_sink_init(void);
+
+// Log through a call site; use the macros below
+void log_site_write(LogSite *site, ...);
+
+// Lines dropped because the ring was full
+uint32_t log_sink_dropped(void);
+
+// Add the per-site counters and drop count to a metrics report
+void log_sink_report(JsonDocument &doc);
+
+#define LOG_EVERY_MS(interval, format, ...)                                                 \
+    do {                                                                                    \
+        static LogSite log_site_ = { format, (interval), 0, 0, 0, 0, 0, NULL };             \
+        log_site_write(&log_site_, ##__VA_ARGS__);                                          \
+    } while (0)
+
+#define LOG(format, ...)    LOG_EVERY_MS(0, format, ##__VA_ARGS__)
+
+#endif // LOG_SINK_H
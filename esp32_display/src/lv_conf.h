@@ -163,7 +163,7 @@
 /*==================
  * OTHERS
  *==================*/
-#define LV_USE_SNAPSHOT 0
+#define LV_USE_SNAPSHOT 1       // Mode transitions capture the incoming mode offscreen
 #define LV_USE_MONKEY   0
 #define LV_USE_GRIDNAV  0
 #define LV_USE_FRAGMENT 0
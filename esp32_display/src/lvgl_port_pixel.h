@@ -0,0 +1,227 @@
+/*
+ * SPDX-FileCopyrightText: 2024-2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+
+/**
+ * @file
+ * @brief Pixel copy and rotate kernels used by the LVGL port.
+ *
+ * Split out of `lvgl_v8_port.cpp` and templated on the pixel format so the same code runs in the firmware, the host
+ * (`native`) build, the benchmarks and the golden-image tests. Nothing here depends on LVGL or ESP-IDF.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
+
+namespace lvgl_port_pixel {
+
+template <int BPP>
+static inline void copy_pixel(uint8_t *to, const uint8_t *from);
+
+template <>
+__attribute__((always_inline)) inline void copy_pixel<8>(uint8_t *to, const uint8_t *from)
+{
+    *to = *from;
+}
+
+template <>
+__attribute__((always_inline)) inline void copy_pixel<16>(uint8_t *to, const uint8_t *from)
+{
+    *(uint16_t *)to = *(const uint16_t *)from;
+}
+
+template <>
+__attribute__((always_inline)) inline void copy_pixel<24>(uint8_t *to, const uint8_t *from)
+{
+    *to++ = *from++;
+    *to++ = *from++;
+    *to++ = *from++;
+}
+
+/**
+ * @brief Generic 90 degree rotation of the area [x_start, x_end] x [y_start, y_end] of a `w` x `h` frame.
+ *
+ * @tparam BPP        Destination bits per pixel (8, 16 or 24)
+ * @tparam FROM_BYTES Source bytes per pixel (`sizeof(lv_color_t)`)
+ */
+template <int BPP, int FROM_BYTES>
+static inline void rotate_90_all_bpp(
+    const uint8_t *from, uint8_t *to, int x_start, int y_start, int x_end, int y_end, int w, int h
+)
+{
+    const int from_bytes_per_line = w * FROM_BYTES;
+    const int to_bytes_per_pixel = BPP >> 3;
+    const int to_bytes_per_line = h * to_bytes_per_pixel;
+    const int to_index_const = (w - x_start - 1) * to_bytes_per_line;
+
+    for (int from_y = y_start; from_y < y_end + 1; from_y++) {
+        int from_index = from_y * from_bytes_per_line + x_start * FROM_BYTES;
+        int to_index = to_index_const + from_y * to_bytes_per_pixel;
+        for (int from_x = x_start; from_x < x_end + 1; from_x++) {
+            copy_pixel<BPP>(to + to_index, from + from_index);
+            from_index += FROM_BYTES;
+            to_index -= to_bytes_per_line;
+        }
+    }
+}
+
+/**
+ * @brief Optimized transpose function for RGB565 format, rotating the whole `w` x `h` frame in cache-sized blocks.
+ *
+ * @note  ESP32-P4 1024x600 full-screen: 738ms -> 34ms
+ * @note  ESP32-S3 480x480  full-screen: 380ms -> 37ms
+ */
+template <int BLOCK_W, int BLOCK_H>
+static inline void rotate_90_optimized_16bpp(const uint8_t *from, uint8_t *to, int w, int h)
+{
+    for (int i = 0; i < h; i += BLOCK_H) {
+        int max_height = (i + BLOCK_H > h) ? h : (i + BLOCK_H);
+        for (int j = 0; j < w; j += BLOCK_W) {
+            int max_width = (j + BLOCK_W > w) ? w : (j + BLOCK_W);
+            int start_y = w - 1 - j;
+            for (int x = i; x < max_height; x++) {
+                const uint16_t *from_next = (const uint16_t *)from + x * w;
+                for (int y = j, mirrored_y = start_y; y < max_width; y += 4, mirrored_y -= 4) {
+                    ((uint16_t *)to)[(mirrored_y) * h + x] = *((const uint32_t *)(from_next + y)) & 0xFFFF;
+                    ((uint16_t *)to)[(mirrored_y - 1) * h + x] = (*((const uint32_t *)(from_next + y)) >> 16) & 0xFFFF;
+                    ((uint16_t *)to)[(mirrored_y - 2) * h + x] = *((const uint32_t *)(from_next + y + 2)) & 0xFFFF;
+                    ((uint16_t *)to)[(mirrored_y - 3) * h + x] = (*((const uint32_t *)(from_next + y + 2)) >> 16) & 0xFFFF;
+                }
+            }
+        }
+    }
+}
+
+template <int BPP, int FROM_BYTES>
+static inline void rotate_180_all_bpp(
+    const uint8_t *from, uint8_t *to, int x_start, int y_start, int x_end, int y_end, int w, int h
+)
+{
+    const int from_bytes_per_line = w * FROM_BYTES;
+    const int to_bytes_per_pixel = BPP >> 3;
+    const int to_bytes_per_line = w * to_bytes_per_pixel;
+    const int to_index_const = (h - 1) * to_bytes_per_line + (w - x_start - 1) * to_bytes_per_pixel;
+
+    for (int from_y = y_start; from_y < y_end + 1; from_y++) {
+        int from_index = from_y * from_bytes_per_line + x_start * FROM_BYTES;
+        int to_index = to_index_const - from_y * to_bytes_per_line;
+        for (int from_x = x_start; from_x < x_end + 1; from_x++) {
+            copy_pixel<BPP>(to + to_index, from + from_index);
+            from_index += FROM_BYTES;
+            to_index -= to_bytes_per_pixel;
+        }
+    }
+}
+
+template <int BLOCK_W, int BLOCK_H>
+static inline void rotate_270_optimized_16bpp(const uint8_t *from, uint8_t *to, int w, int h)
+{
+    for (int i = 0; i < h; i += BLOCK_H) {
+        int max_height = (i + BLOCK_H > h) ? h : (i + BLOCK_H);
+        for (int j = 0; j < w; j += BLOCK_W) {
+            int max_width = (j + BLOCK_W > w) ? w : (j + BLOCK_W);
+            for (int x = i; x < max_height; x++) {
+                const uint16_t *from_next = (const uint16_t *)from + x * w;
+                for (int y = j; y < max_width; y += 4) {
+                    ((uint16_t *)to)[y * h + (h - 1 - x)] = *((const uint32_t *)(from_next + y)) & 0xFFFF;
+                    ((uint16_t *)to)[(y + 1) * h + (h - 1 - x)] = (*((const uint32_t *)(from_next + y)) >> 16) & 0xFFFF;
+                    ((uint16_t *)to)[(y + 2) * h + (h - 1 - x)] = *((const uint32_t *)(from_next + y + 2)) & 0xFFFF;
+                    ((uint16_t *)to)[(y + 3) * h + (h - 1 - x)] = (*((const uint32_t *)(from_next + y + 2)) >> 16) & 0xFFFF;
+                }
+            }
+        }
+    }
+}
+
+template <int BPP, int FROM_BYTES>
+static inline void rotate_270_all_bpp(
+    const uint8_t *from, uint8_t *to, int x_start, int y_start, int x_end, int y_end, int w, int h
+)
+{
+    const int from_bytes_per_line = w * FROM_BYTES;
+    const int to_bytes_per_pixel = BPP >> 3;
+    const int to_bytes_per_line = h * to_bytes_per_pixel;
+    const int from_index_const = x_start * FROM_BYTES;
+    const int to_index_const = x_start * to_bytes_per_line + (h - 1) * to_bytes_per_pixel;
+
+    for (int from_y = y_start; from_y < y_end + 1; from_y++) {
+        int from_index = from_y * from_bytes_per_line + from_index_const;
+        int to_index = to_index_const - from_y * to_bytes_per_pixel;
+        for (int from_x = x_start; from_x < x_end + 1; from_x++) {
+            copy_pixel<BPP>(to + to_index, from + from_index);
+            from_index += FROM_BYTES;
+            to_index += to_bytes_per_line;
+        }
+    }
+}
+
+/**
+ * @brief Copy an area of a `w` x `h` frame into a frame buffer rotated by `rotate` degrees.
+ *
+ * @tparam BPP        Destination bits per pixel (8, 16 or 24)
+ * @tparam FROM_BYTES Source bytes per pixel (`sizeof(lv_color_t)`)
+ * @tparam OPTIMIZED  Use the blocked 16bpp transpose for 90/270 degrees. It always rotates the whole frame.
+ * @tparam BLOCK_W    Block width of the optimized transpose, must be a multiple of 4
+ * @tparam BLOCK_H    Block height of the optimized transpose
+ */
+template <int BPP, int FROM_BYTES, bool OPTIMIZED, int BLOCK_W = 32, int BLOCK_H = 256>
+__attribute__((always_inline))
+IRAM_ATTR static inline void rotate_copy_pixel(
+    const uint8_t *from, uint8_t *to, uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end, uint16_t w,
+    uint16_t h, uint16_t rotate
+)
+{
+    static_assert((BLOCK_W % 4) == 0, "The optimized transpose copies 4 pixels at a time");
+    constexpr bool use_optimized = OPTIMIZED && (BPP == 16) && (FROM_BYTES == 2);
+
+    switch (rotate) {
+    case 90:
+        if (use_optimized) {
+            rotate_90_optimized_16bpp<BLOCK_W, BLOCK_H>(from, to, w, h);
+        } else {
+            rotate_90_all_bpp<BPP, FROM_BYTES>(from, to, x_start, y_start, x_end, y_end, w, h);
+        }
+        break;
+    case 180:
+        rotate_180_all_bpp<BPP, FROM_BYTES>(from, to, x_start, y_start, x_end, y_end, w, h);
+        break;
+    case 270:
+        if (use_optimized) {
+            rotate_270_optimized_16bpp<BLOCK_W, BLOCK_H>(from, to, w, h);
+        } else {
+            rotate_270_all_bpp<BPP, FROM_BYTES>(from, to, x_start, y_start, x_end, y_end, w, h);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Copy every unjoined dirty area of the last refresh into the next frame buffer, rotated.
+ *
+ * @tparam DirtyArea Anything with `inv_p`, `inv_area_joined[]` and `inv_areas[]` (x1/y1/x2/y2), e.g. the port's
+ *                   `lv_port_dirty_area_t`
+ */
+template <int BPP, int FROM_BYTES, bool OPTIMIZED, typename DirtyArea>
+static void flush_dirty_copy(void *dst, void *src, const DirtyArea *dirty_area, uint16_t w, uint16_t h, uint16_t rotate)
+{
+    for (int i = 0; i < dirty_area->inv_p; i++) {
+        /* Refresh the unjoined areas*/
+        if (dirty_area->inv_area_joined[i] == 0) {
+            rotate_copy_pixel<BPP, FROM_BYTES, OPTIMIZED>(
+                (const uint8_t *)src, (uint8_t *)dst, dirty_area->inv_areas[i].x1, dirty_area->inv_areas[i].y1,
+                dirty_area->inv_areas[i].x2, dirty_area->inv_areas[i].y2, w, h, rotate
+            );
+        }
+    }
+}
+
+} // namespace lvgl_port_pixel
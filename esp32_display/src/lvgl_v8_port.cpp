@@ -9,6 +9,10 @@
 #define ESP_UTILS_LOG_TAG "LvPort"
 #include "esp_lib_utils.h"
 #include "lvgl_v8_port.h"
+#include "lvgl_port_pixel.h"
+#include "metrics.h"
+#include "power_manager.h"
+#include "trace.h"
 
 using namespace esp_panel::drivers;
 
@@ -16,140 +20,96 @@ using namespace esp_panel::drivers;
 #define LVGL_PORT_BUFFER_NUM_MAX                (2)
 
 static SemaphoreHandle_t lvgl_mux = nullptr;                  // LVGL mutex
+static SemaphoreHandle_t lvgl_wake = nullptr;                 // Wakes the LVGL task before its next timer deadline
 static TaskHandle_t lvgl_task_handle = nullptr;
 static esp_timer_handle_t lvgl_tick_timer = NULL;
 static void *lvgl_buf[LVGL_PORT_BUFFER_NUM_MAX] = {};
+static int lvgl_lock_depth = 0;                               // Only touched by the task holding lvgl_mux
+static int64_t lvgl_lock_acquired_us = 0;
+static int64_t last_frame_us = 0;
+static volatile int64_t last_frame_done_us = 0;
+static uint32_t frame_count = 0;                              // Completed refreshes, for rate accounting
+static uint32_t task_busy_us = 0;                             // LVGL task time spent rendering (wraps)
+static LCD *scanout_lcd = nullptr;                            // RGB panels only, for lvgl_port_get_scanout_buffer()
+static void *volatile scanout_fb = nullptr;                   // Last buffer handed to the panel, nullptr = buffer 0
+static uint32_t task_min_delay_ms = LVGL_PORT_TASK_MIN_DELAY_MS;
+static uint32_t task_max_delay_ms = LVGL_PORT_TASK_MAX_DELAY_MS;
+static lv_timer_t *held_refr_timer = nullptr;                 // Display refresh paused until lvgl_port_start_refresh()
 
-#if LVGL_PORT_ROTATION_DEGREE != 0
-static void *get_next_frame_buffer(LCD *lcd)
+/**
+ * VSYNC-paced frame scheduler: the panel's refresh-finish (VSYNC) interrupt marks every `frame_divisor`-th
+ * refresh as a due frame and wakes the LVGL task, which runs the frame callback once for the latest due frame.
+ * Frames that come due while the previous one is still being worked on are skipped and counted.
+ */
+static bool frame_vsync_available = false;
+static lvgl_port_frame_cb_t volatile frame_cb = nullptr;
+static void *frame_cb_user_data = nullptr;
+static volatile uint32_t frame_divisor = 1;
+static volatile uint32_t frame_vsync_count = 0;
+static volatile uint32_t frame_due = 0;
+static uint32_t frame_done = 0;
+static uint32_t frame_dropped = 0;
+static volatile uint32_t frame_refresh_period_us = 0;
+static int64_t frame_last_vsync_us = 0;
+
+IRAM_ATTR static bool frame_scheduler_on_vsync(void)
 {
-    static void *next_fb = NULL;
-    static void *fbs[2] = { NULL };
+    int64_t now_us = esp_timer_get_time();
+    if (frame_last_vsync_us != 0) {
+        uint32_t period_us = (uint32_t)(now_us - frame_last_vsync_us);
+        // Exponential moving average of the real panel refresh period
+        frame_refresh_period_us = (frame_refresh_period_us == 0) ? period_us :
+                                  (frame_refresh_period_us * 7 + period_us) / 8;
+    }
+    frame_last_vsync_us = now_us;
 
-    if (next_fb == NULL) {
-        fbs[0] = lcd->getFrameBufferByIndex(0);
-        fbs[1] = lcd->getFrameBufferByIndex(1);
-        next_fb = fbs[1];
-    } else {
-        next_fb = (next_fb == fbs[0]) ? fbs[1] : fbs[0];
+    if ((frame_cb == nullptr) || (++frame_vsync_count % frame_divisor) != 0) {
+        return false;
     }
+    frame_due = frame_due + 1;
 
-    return next_fb;
+    return lvgl_port_notify_from_isr();
 }
 
-__attribute__((always_inline))
-static inline void copy_pixel_8bpp(uint8_t *to, const uint8_t *from)
+// Run the frame callback for the latest due frame; call from the LVGL task with the lock held
+static void frame_scheduler_run(void)
 {
-    *to++ = *from++;
-}
+    lvgl_port_frame_cb_t cb = frame_cb;
+    uint32_t due = frame_due;
+    if ((cb == nullptr) || (due == frame_done)) {
+        return;
+    }
 
-__attribute__((always_inline))
-static inline void copy_pixel_16bpp(uint8_t *to, const uint8_t *from)
-{
-    *(uint16_t *)to++ = *(const uint16_t *)from++;
+    // Skip straight to the newest frame so overruns never queue up stale work
+    frame_dropped += due - frame_done - 1;
+    frame_done = due;
+    cb(due, frame_cb_user_data);
 }
 
-__attribute__((always_inline))
-static inline void copy_pixel_24bpp(uint8_t *to, const uint8_t *from)
+#if LVGL_PORT_AVOID_TEAR
+static inline void switch_frame_buffer(LCD *lcd, void *fb)
 {
-    *to++ = *from++;
-    *to++ = *from++;
-    *to++ = *from++;
+    scanout_fb = fb;
+    lcd->switchFrameBufferTo(fb);
 }
+#endif
 
-#define _COPY_PIXEL(_bpp, to, from) copy_pixel_##_bpp##bpp(to, from)
-#define COPY_PIXEL(_bpp, to, from)  _COPY_PIXEL(_bpp, to, from)
+#if LVGL_PORT_ROTATION_DEGREE != 0
+static void *get_next_frame_buffer(LCD *lcd)
+{
+    static void *next_fb = NULL;
+    static void *fbs[2] = { NULL };
 
-#define ROTATE_90_ALL_BPP() \
-    { \
-        to_bytes_per_line = h * to_bytes_per_piexl; \
-        to_index_const = (w - x_start - 1) * to_bytes_per_line; \
-        for (int from_y = y_start; from_y < y_end + 1; from_y++) { \
-            from_index = from_y * from_bytes_per_line + x_start * from_bytes_per_piexl; \
-            to_index = to_index_const + from_y * to_bytes_per_piexl; \
-            for (int from_x = x_start; from_x < x_end + 1; from_x++) { \
-                COPY_PIXEL(LV_COLOR_DEPTH, to + to_index, from + from_index); \
-                from_index += from_bytes_per_piexl; \
-                to_index -= to_bytes_per_line; \
-            } \
-        } \
+    if (next_fb == NULL) {
+        fbs[0] = lcd->getFrameBufferByIndex(0);
+        fbs[1] = lcd->getFrameBufferByIndex(1);
+        next_fb = fbs[1];
+    } else {
+        next_fb = (next_fb == fbs[0]) ? fbs[1] : fbs[0];
     }
 
-/**
- * @brief Optimized transpose function for RGB565 format.
- *
- * @note  ESP32-P4 1024x600 full-screen: 738ms -> 34ms
- * @note  ESP32-S3 480x480  full-screen: 380ms -> 37ms
- */
-#define ROTATE_90_OPTIMIZED_16BPP(block_w, block_h) \
-    { \
-        for (int i = 0; i < h; i += block_h) { \
-            max_height = (i + block_h > h) ? h : (i + block_h); \
-            for (int j = 0; j < w; j += block_w) { \
-                max_width = (j + block_w > w) ? w : (j + block_w); \
-                start_y = w - 1 - j;   \
-                for (int x = i; x < max_height; x++) { \
-                    from_next = (uint16_t *)from + x * w; \
-                    for (int y = j, mirrored_y = start_y; y < max_width; y += 4, mirrored_y -= 4) { \
-                        ((uint16_t *)to)[(mirrored_y) * h + x] = *((uint32_t *)(from_next + y)) & 0xFFFF; \
-                        ((uint16_t *)to)[(mirrored_y - 1) * h + x] = (*((uint32_t *)(from_next + y)) >> 16) & 0xFFFF; \
-                        ((uint16_t *)to)[(mirrored_y - 2) * h + x] = *((uint32_t *)(from_next + y + 2)) & 0xFFFF; \
-                        ((uint16_t *)to)[(mirrored_y - 3) * h + x] = (*((uint32_t *)(from_next + y + 2)) >> 16) & 0xFFFF; \
-                    } \
-                } \
-            } \
-        } \
-    }
-
-#define ROTATE_180_ALL_BPP() \
-    { \
-        to_bytes_per_line = w * to_bytes_per_piexl; \
-        to_index_const = (h - 1) * to_bytes_per_line + (w - x_start - 1) * to_bytes_per_piexl; \
-        for (int from_y = y_start; from_y < y_end + 1; from_y++) { \
-            from_index = from_y * from_bytes_per_line + x_start * from_bytes_per_piexl; \
-            to_index = to_index_const - from_y * to_bytes_per_line; \
-            for (int from_x = x_start; from_x < x_end + 1; from_x++) { \
-                COPY_PIXEL(LV_COLOR_DEPTH, to + to_index, from + from_index); \
-                from_index += from_bytes_per_piexl; \
-                to_index -= to_bytes_per_piexl; \
-            } \
-        } \
-    }
-
-#define ROTATE_270_OPTIMIZED_16BPP(block_w, block_h) \
-    { \
-        for (int i = 0; i < h; i += block_h) { \
-            max_height = i + block_h > h ? h : i + block_h; \
-            for (int j = 0; j < w; j += block_w) { \
-                max_width = j + block_w > w ? w : j + block_w; \
-                for (int x = i; x < max_height; x++) { \
-                    from_next = (uint16_t *)from + x * w; \
-                    for (int y = j; y < max_width; y += 4) { \
-                        ((uint16_t *)to)[y * h + (h - 1 - x)] = *((uint32_t *)(from_next + y)) & 0xFFFF; \
-                        ((uint16_t *)to)[(y + 1) * h + (h - 1 - x)] = (*((uint32_t *)(from_next + y)) >> 16) & 0xFFFF; \
-                        ((uint16_t *)to)[(y + 2) * h + (h - 1 - x)] = *((uint32_t *)(from_next + y + 2)) & 0xFFFF; \
-                        ((uint16_t *)to)[(y + 3) * h + (h - 1 - x)] = (*((uint32_t *)(from_next + y + 2)) >> 16) & 0xFFFF; \
-                    } \
-                } \
-            } \
-        } \
-    }
-
-#define ROTATE_270_ALL_BPP() \
-    { \
-        to_bytes_per_line = h * to_bytes_per_piexl; \
-        from_index_const = x_start * from_bytes_per_piexl; \
-        to_index_const = x_start * to_bytes_per_line + (h - 1) * to_bytes_per_piexl; \
-        for (int from_y = y_start; from_y < y_end + 1; from_y++) { \
-            from_index = from_y * from_bytes_per_line + from_index_const; \
-            to_index = to_index_const - from_y * to_bytes_per_piexl; \
-            for (int from_x = x_start; from_x < x_end + 1; from_x++) { \
-                COPY_PIXEL(LV_COLOR_DEPTH, to + to_index, from + from_index); \
-                from_index += from_bytes_per_piexl; \
-                to_index += to_bytes_per_line; \
-            } \
-        } \
-    }
+    return next_fb;
+}
 
 __attribute__((always_inline))
 IRAM_ATTR static inline void rotate_copy_pixel(
@@ -157,45 +117,10 @@ IRAM_ATTR static inline void rotate_copy_pixel(
     uint16_t h, uint16_t rotate
 )
 {
-    int from_bytes_per_piexl = sizeof(lv_color_t);
-    int from_bytes_per_line = w * from_bytes_per_piexl;
-    int from_index = 0;
-
-    int to_bytes_per_piexl = LV_COLOR_DEPTH >> 3;
-    int to_bytes_per_line;
-    int to_index = 0;
-    int to_index_const = 0;
-
-#if (LV_COLOR_DEPTH == 16) && LVGL_PORT_ENABLE_ROTATION_OPTIMIZED
-    int max_height = 0;
-    int max_width = 0;
-    int start_y = 0;
-    uint16_t *from_next = NULL;
-#endif
-
     // uint32_t time = esp_log_timestamp();
-    switch (rotate) {
-    case 90:
-#if (LV_COLOR_DEPTH == 16) && LVGL_PORT_ENABLE_ROTATION_OPTIMIZED
-        ROTATE_90_OPTIMIZED_16BPP(32, 256);
-#else
-        ROTATE_90_ALL_BPP();
-#endif
-        break;
-    case 180:
-        ROTATE_180_ALL_BPP();
-        break;
-    case 270:
-#if (LV_COLOR_DEPTH == 16) && LVGL_PORT_ENABLE_ROTATION_OPTIMIZED
-        ROTATE_270_OPTIMIZED_16BPP(32, 256);
-#else
-        int from_index_const = 0;
-        ROTATE_270_ALL_BPP();
-#endif
-        break;
-    default:
-        break;
-    }
+    lvgl_port_pixel::rotate_copy_pixel<LV_COLOR_DEPTH, sizeof(lv_color_t), LVGL_PORT_ENABLE_ROTATION_OPTIMIZED>(
+        from, to, x_start, y_start, x_end, y_end, w, h, rotate
+    );
     // ESP_LOGI(TAG, "rotate: end, time used:%d", (int)(esp_log_timestamp() - time));
 }
 #endif /* LVGL_PORT_ROTATION_DEGREE */
@@ -282,21 +207,9 @@ static inline void *flush_get_next_buf(LCD *lcd)
  */
 static void flush_dirty_copy(void *dst, void *src, lv_port_dirty_area_t *dirty_area)
 {
-    lv_coord_t x_start, x_end, y_start, y_end;
-    for (int i = 0; i < dirty_area->inv_p; i++) {
-        /* Refresh the unjoined areas*/
-        if (dirty_area->inv_area_joined[i] == 0) {
-            x_start = dirty_area->inv_areas[i].x1;
-            x_end = dirty_area->inv_areas[i].x2;
-            y_start = dirty_area->inv_areas[i].y1;
-            y_end = dirty_area->inv_areas[i].y2;
-
-            rotate_copy_pixel(
-                (uint8_t *)src, (uint8_t *)dst, x_start, y_start, x_end, y_end, LV_HOR_RES, LV_VER_RES,
-                LVGL_PORT_ROTATION_DEGREE
-            );
-        }
-    }
+    lvgl_port_pixel::flush_dirty_copy<LV_COLOR_DEPTH, sizeof(lv_color_t), LVGL_PORT_ENABLE_ROTATION_OPTIMIZED>(
+        dst, src, dirty_area, LV_HOR_RES, LV_VER_RES, LVGL_PORT_ROTATION_DEGREE
+    );
 }
 
 static void flush_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
@@ -325,7 +238,7 @@ static void flush_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t
             );
 
             /* Switch the current LCD frame buffer to `next_fb` */
-            lcd->switchFrameBufferTo(next_fb);
+            switch_frame_buffer(lcd, next_fb);
 
             /* Waiting for the current frame buffer to complete transmission */
             ulTaskNotifyValueClear(NULL, ULONG_MAX);
@@ -356,7 +269,7 @@ static void flush_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t
                 flush_dirty_copy(next_fb, color_map, &dirty_area);
 
                 /* Switch the current LCD frame buffer to `next_fb` */
-                lcd->switchFrameBufferTo(next_fb);
+                switch_frame_buffer(lcd, next_fb);
 
                 /* Waiting for the current frame buffer to complete transmission */
                 ulTaskNotifyValueClear(NULL, ULONG_MAX);
@@ -384,7 +297,7 @@ static void flush_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t
     /* Action after last area refresh */
     if (lv_disp_flush_is_last(drv)) {
         /* Switch the current LCD frame buffer to `color_map` */
-        lcd->switchFrameBufferTo(color_map);
+        switch_frame_buffer(lcd, color_map);
 
         /* Waiting for the last frame buffer to complete transmission */
         ulTaskNotifyValueClear(NULL, ULONG_MAX);
@@ -402,7 +315,7 @@ static void flush_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t
     LCD *lcd = (LCD *)drv->user_data;
 
     /* Switch the current LCD frame buffer to `color_map` */
-    lcd->switchFrameBufferTo(color_map);
+    switch_frame_buffer(lcd, color_map);
 
     /* Waiting for the last frame buffer to complete transmission */
     ulTaskNotifyValueClear(NULL, ULONG_MAX);
@@ -437,14 +350,14 @@ void flush_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color
     );
 
     /* Switch the current LCD frame buffer to `next_fb` */
-    lcd->switchFrameBufferTo(next_fb);
+    switch_frame_buffer(lcd, next_fb);
 #else
     drv->draw_buf->buf1 = color_map;
     drv->draw_buf->buf2 = lvgl_port_flush_next_buf;
     lvgl_port_flush_next_buf = color_map;
 
     /* Switch the current LCD frame buffer to `color_map` */
-    lcd->switchFrameBufferTo(color_map);
+    switch_frame_buffer(lcd, color_map);
 
     lvgl_port_lcd_next_buf = color_map;
 #endif
@@ -466,7 +379,8 @@ IRAM_ATTR bool onLcdVsyncCallback(void *user_data)
     // Notify that the current LCD frame buffer has been transmitted
     xTaskNotifyFromISR(task_handle, ULONG_MAX, eNoAction, &need_yield);
 #endif
-    return (need_yield == pdTRUE);
+    bool frame_yield = frame_scheduler_on_vsync();
+    return (need_yield == pdTRUE) || frame_yield;
 }
 
 #else
@@ -486,6 +400,31 @@ void flush_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color
     }
 }
 
+IRAM_ATTR static bool onLcdVsyncFrameCallback(void *user_data)
+{
+    return frame_scheduler_on_vsync();
+}
+
+// Times every flush and the interval between completed frames
+static void flush_callback_timed(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
+{
+    bool last = lv_disp_flush_is_last(drv);
+    int64_t start_us = esp_timer_get_time();
+
+    flush_callback(drv, area, color_map);
+    metrics_record_since_us(METRIC_FLUSH_US, start_us);
+    TRACE_END("flush", start_us, lv_area_get_size(area));
+
+    if (last) {
+        if (last_frame_us != 0) {
+            metrics_record(METRIC_FRAME_INTERVAL_US, (uint32_t)(start_us - last_frame_us));
+        }
+        last_frame_us = start_us;
+        last_frame_done_us = esp_timer_get_time();
+        __atomic_add_fetch(&frame_count, 1, __ATOMIC_RELAXED);
+    }
+}
+
 static void update_callback(lv_disp_drv_t *drv)
 {
     LCD *lcd = (LCD *)drv->user_data;
@@ -604,7 +543,7 @@ static lv_disp_t *display_init(LCD *lcd)
 
     ESP_UTILS_LOGD("Register display driver to LVGL");
     lv_disp_drv_init(&disp_drv);
-    disp_drv.flush_cb = flush_callback;
+    disp_drv.flush_cb = flush_callback_timed;
 #if (LVGL_PORT_ROTATION_DEGREE == 90) || (LVGL_PORT_ROTATION_DEGREE == 270)
     disp_drv.hor_res = lcd_height;
     disp_drv.ver_res = lcd_width;
@@ -711,18 +650,40 @@ static void lvgl_port_task(void *arg)
 {
     ESP_UTILS_LOGD("Starting LVGL task");
 
-    uint32_t task_delay_ms = LVGL_PORT_TASK_MAX_DELAY_MS;
+    uint32_t task_delay_ms = task_max_delay_ms;
     while (1) {
         if (lvgl_port_lock(-1)) {
+            power_boost_acquire();
+            int64_t busy_start_us = esp_timer_get_time();
+            TRACE_BEGIN(frame_start_us);
+            frame_scheduler_run();
+            TRACE_END("frame_callback", frame_start_us);
+            TRACE_BEGIN(timer_start_us);
             task_delay_ms = lv_timer_handler();
+            TRACE_END("lv_timer_handler", timer_start_us);
+            __atomic_add_fetch(&task_busy_us, (uint32_t)(esp_timer_get_time() - busy_start_us), __ATOMIC_RELAXED);
+            power_boost_release();
             lvgl_port_unlock();
         }
-        if (task_delay_ms > LVGL_PORT_TASK_MAX_DELAY_MS) {
-            task_delay_ms = LVGL_PORT_TASK_MAX_DELAY_MS;
-        } else if (task_delay_ms < LVGL_PORT_TASK_MIN_DELAY_MS) {
-            task_delay_ms = LVGL_PORT_TASK_MIN_DELAY_MS;
+
+        /**
+         * Sleep until the next LVGL timer deadline. Invalidations from other tasks (via `lvgl_port_unlock()`),
+         * input events and frame-buffer-ready callbacks wake the task early through `lvgl_wake`.
+         */
+        TickType_t wait_ticks;
+        if (task_delay_ms == LV_NO_TIMER_READY) {
+            wait_ticks = portMAX_DELAY;
+        } else {
+            uint32_t min_ms = __atomic_load_n(&task_min_delay_ms, __ATOMIC_RELAXED);
+            uint32_t max_ms = __atomic_load_n(&task_max_delay_ms, __ATOMIC_RELAXED);
+            if (task_delay_ms > max_ms) {
+                task_delay_ms = max_ms;
+            } else if (task_delay_ms < min_ms) {
+                task_delay_ms = min_ms;
+            }
+            wait_ticks = pdMS_TO_TICKS(task_delay_ms);
         }
-        vTaskDelay(pdMS_TO_TICKS(task_delay_ms));
+        xSemaphoreTake(lvgl_wake, wait_ticks);
     }
 }
 
@@ -732,7 +693,8 @@ IRAM_ATTR bool onDrawBitmapFinishCallback(void *user_data)
 
     lv_disp_flush_ready(drv);
 
-    return false;
+    // The next frame can be rendered now
+    return lvgl_port_notify_from_isr();
 }
 
 bool lvgl_port_init(LCD *lcd, Touch *tp)
@@ -761,6 +723,12 @@ bool lvgl_port_init(LCD *lcd, Touch *tp)
     ESP_UTILS_LOGI("Initializing LVGL display driver");
     disp = display_init(lcd);
     ESP_UTILS_CHECK_NULL_RETURN(disp, false, "Initialize LVGL display driver failed");
+    if (bus_type == ESP_PANEL_BUS_TYPE_RGB) {
+        scanout_lcd = lcd;
+    }
+    // Keep whatever is on the panel (boot splash) until the application has built its first screen
+    held_refr_timer = disp->refr_timer;
+    lv_timer_pause(held_refr_timer);
     // Record the initial rotation of the display
     lv_disp_set_rotation(disp, LV_DISP_ROT_NONE);
 
@@ -793,6 +761,8 @@ bool lvgl_port_init(LCD *lcd, Touch *tp)
     ESP_UTILS_LOGD("Create mutex for LVGL");
     lvgl_mux = xSemaphoreCreateRecursiveMutex();
     ESP_UTILS_CHECK_NULL_RETURN(lvgl_mux, false, "Create LVGL mutex failed");
+    lvgl_wake = xSemaphoreCreateBinary();
+    ESP_UTILS_CHECK_NULL_RETURN(lvgl_wake, false, "Create LVGL wake semaphore failed");
 
     ESP_UTILS_LOGD("Create LVGL task");
     BaseType_t core_id = (LVGL_PORT_TASK_CORE < 0) ? tskNO_AFFINITY : LVGL_PORT_TASK_CORE;
@@ -802,6 +772,12 @@ bool lvgl_port_init(LCD *lcd, Touch *tp)
 
 #if LVGL_PORT_AVOID_TEAR
     lcd->attachRefreshFinishCallback(onLcdVsyncCallback, (void *)lvgl_task_handle);
+    frame_vsync_available = true;
+#else
+    // RGB panels report the end of every scanout, which paces the frame scheduler
+    if (bus_type == ESP_PANEL_BUS_TYPE_RGB) {
+        frame_vsync_available = lcd->attachRefreshFinishCallback(onLcdVsyncFrameCallback, nullptr);
+    }
 #endif
 
     return true;
@@ -812,18 +788,134 @@ bool lvgl_port_lock(int timeout_ms)
     ESP_UTILS_CHECK_NULL_RETURN(lvgl_mux, false, "LVGL mutex is not initialized");
 
     const TickType_t timeout_ticks = (timeout_ms < 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
-    return (xSemaphoreTakeRecursive(lvgl_mux, timeout_ticks) == pdTRUE);
+    int64_t start_us = esp_timer_get_time();
+    if (xSemaphoreTakeRecursive(lvgl_mux, timeout_ticks) != pdTRUE) {
+        return false;
+    }
+    if (lvgl_lock_depth++ == 0) {
+        lvgl_lock_acquired_us = esp_timer_get_time();
+        metrics_record(METRIC_LOCK_WAIT_US, (uint32_t)(lvgl_lock_acquired_us - start_us));
+        TRACE_END("lvgl_lock_wait", start_us);
+    }
+
+    return true;
 }
 
 bool lvgl_port_unlock(void)
 {
     ESP_UTILS_CHECK_NULL_RETURN(lvgl_mux, false, "LVGL mutex is not initialized");
 
+    // Another task may have invalidated objects or changed timers; wake the LVGL task to pick it up.
+    // This is done before releasing the mutex, so the LVGL task can never be inside a flush when it arrives.
+    if (xTaskGetCurrentTaskHandle() != lvgl_task_handle) {
+        lvgl_port_notify();
+    }
+    if (--lvgl_lock_depth == 0) {
+        metrics_record_since_us(METRIC_LOCK_HOLD_US, lvgl_lock_acquired_us);
+        TRACE_END("lvgl_lock_hold", lvgl_lock_acquired_us);
+    }
     xSemaphoreGiveRecursive(lvgl_mux);
 
     return true;
 }
 
+bool lvgl_port_set_frame_callback(lvgl_port_frame_cb_t cb, uint8_t vsync_divisor, void *user_data)
+{
+    if (cb == nullptr) {
+        frame_cb = nullptr;
+        return true;
+    }
+    ESP_UTILS_CHECK_FALSE_RETURN(frame_vsync_available, false, "No VSYNC callback on this panel");
+    ESP_UTILS_CHECK_FALSE_RETURN(vsync_divisor > 0, false, "Invalid VSYNC divisor");
+
+    frame_divisor = vsync_divisor;
+    frame_cb_user_data = user_data;
+    frame_done = frame_due;
+    frame_cb = cb;
+
+    return true;
+}
+
+uint32_t lvgl_port_get_dropped_frames(void)
+{
+    return frame_dropped;
+}
+
+uint32_t lvgl_port_get_refresh_period_us(void)
+{
+    return frame_refresh_period_us;
+}
+
+int64_t lvgl_port_get_last_frame_done_us(void)
+{
+    return last_frame_done_us;
+}
+
+const void *lvgl_port_get_scanout_buffer(uint16_t *width, uint16_t *height)
+{
+    if (scanout_lcd == nullptr) {
+        return nullptr;
+    }
+    *width = scanout_lcd->getFrameWidth();
+    *height = scanout_lcd->getFrameHeight();
+
+    void *fb = scanout_fb;
+    return (fb != nullptr) ? fb : scanout_lcd->getFrameBufferByIndex(0);
+}
+
+bool lvgl_port_start_refresh(void)
+{
+    ESP_UTILS_CHECK_FALSE_RETURN(lvgl_port_lock(-1), false, "Lock LVGL failed");
+    if (held_refr_timer != nullptr) {
+        lv_timer_resume(held_refr_timer);
+        held_refr_timer = nullptr;
+    }
+    // Unlocking wakes the task, which renders the first frame straight away
+    lvgl_port_unlock();
+
+    return true;
+}
+
+bool lvgl_port_set_task_delay(uint32_t min_ms, uint32_t max_ms)
+{
+    ESP_UTILS_CHECK_FALSE_RETURN((min_ms > 0) && (min_ms <= max_ms), false, "Invalid task delay range");
+
+    __atomic_store_n(&task_min_delay_ms, min_ms, __ATOMIC_RELAXED);
+    __atomic_store_n(&task_max_delay_ms, max_ms, __ATOMIC_RELAXED);
+
+    return true;
+}
+
+uint32_t lvgl_port_get_frame_count(void)
+{
+    return __atomic_load_n(&frame_count, __ATOMIC_RELAXED);
+}
+
+uint32_t lvgl_port_get_busy_us(void)
+{
+    return __atomic_load_n(&task_busy_us, __ATOMIC_RELAXED);
+}
+
+bool lvgl_port_notify(void)
+{
+    ESP_UTILS_CHECK_NULL_RETURN(lvgl_wake, false, "LVGL wake semaphore is not initialized");
+
+    xSemaphoreGive(lvgl_wake);
+
+    return true;
+}
+
+IRAM_ATTR bool lvgl_port_notify_from_isr(void)
+{
+    BaseType_t need_yield = pdFALSE;
+
+    if (lvgl_wake != nullptr) {
+        xSemaphoreGiveFromISR(lvgl_wake, &need_yield);
+    }
+
+    return (need_yield == pdTRUE);
+}
+
 bool lvgl_port_deinit(void)
 {
 #if !LV_TICK_CUSTOM
@@ -854,6 +946,10 @@ bool lvgl_port_deinit(void)
         vSemaphoreDelete(lvgl_mux);
         lvgl_mux = nullptr;
     }
+    if (lvgl_wake != nullptr) {
+        vSemaphoreDelete(lvgl_wake);
+        lvgl_wake = nullptr;
+    }
 
     return true;
 }
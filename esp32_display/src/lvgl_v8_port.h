@@ -44,7 +44,8 @@
 /**
  * LVGL timer handle task related parameters, can be adjusted by users
  */
-#define LVGL_PORT_TASK_MAX_DELAY_MS             (500)       // The maximum delay of the LVGL timer task, in milliseconds
+#define LVGL_PORT_TASK_MAX_DELAY_MS             (500)       // The maximum delay of the LVGL timer task while any LVGL timer
+                                                            // is pending, in milliseconds. With no timers it sleeps until notified
 #define LVGL_PORT_TASK_MIN_DELAY_MS             (2)         // The minimum delay of the LVGL timer task, in milliseconds
 #define LVGL_PORT_TASK_STACK_SIZE               (6 * 1024)  // The stack size of the LVGL timer task, in bytes
 #define LVGL_PORT_TASK_PRIORITY                 (2)         // The priority of the LVGL timer task
@@ -134,8 +135,19 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Frame callback run by the VSYNC-paced frame scheduler, in the LVGL task with the LVGL mutex held.
+ *
+ * @param frame     Index of the frame being produced. It increases by one per scheduled frame, so a jump
+ *                  means frames were skipped.
+ * @param user_data The pointer passed to `lvgl_port_set_frame_callback()`
+ */
+typedef void (*lvgl_port_frame_cb_t)(uint32_t frame, void *user_data);
+
 /**
  * @brief Porting LVGL with LCD and touch panel. This function should be called after the initialization of the LCD and touch panel.
+ *        The display is not refreshed until `lvgl_port_start_refresh()` is called, so the panel keeps its current
+ *        content (e.g. a boot splash) while the first screen is built.
  *
  * @param lcd The pointer to the LCD panel device, mustn't be nullptr
  * @param tp  The pointer to the touch panel device, set to nullptr if is not used
@@ -144,6 +156,13 @@ extern "C" {
  */
 bool lvgl_port_init(esp_panel::drivers::LCD *lcd, esp_panel::drivers::Touch *tp);
 
+/**
+ * @brief Start refreshing the display, once the first screen has been created. Safe to call more than once.
+ *
+ * @return true if success, otherwise false
+ */
+bool lvgl_port_start_refresh(void);
+
 /**
  * @brief Deinitialize the LVGL porting.
  *
@@ -169,6 +188,85 @@ bool lvgl_port_lock(int timeout_ms);
  */
 bool lvgl_port_unlock(void);
 
+/**
+ * @brief Run `cb` once every `vsync_divisor` panel refreshes, paced by the LCD's VSYNC (refresh finish) callback.
+ *        If the previous frame is still running when the next one comes due, the due frame is skipped and counted
+ *        in `lvgl_port_get_dropped_frames()`.
+ *
+ * @param cb            Frame callback, set to nullptr to stop the scheduler
+ * @param vsync_divisor Number of panel refreshes per frame, e.g. 2 for 30 fps on a 60 Hz panel
+ * @param user_data     Passed to `cb`
+ *
+ * @return true if success, false if the panel has no VSYNC callback (use an LVGL timer instead)
+ */
+bool lvgl_port_set_frame_callback(lvgl_port_frame_cb_t cb, uint8_t vsync_divisor, void *user_data);
+
+/**
+ * @brief Get the number of scheduled frames skipped because the previous frame overran.
+ */
+uint32_t lvgl_port_get_dropped_frames(void);
+
+/**
+ * @brief Get the measured panel refresh period in microseconds (0 until two VSYNCs have been seen).
+ */
+uint32_t lvgl_port_get_refresh_period_us(void);
+
+/**
+ * @brief Get the `esp_timer_get_time()` time at which the last area of the latest LVGL refresh was flushed to the
+ *        panel (0 before the first refresh). With RGB panels it reaches the glass within one refresh period.
+ */
+int64_t lvgl_port_get_last_frame_done_us(void);
+
+/**
+ * @brief Get the frame buffer an RGB panel is scanning out, for read-only diagnostics such as snapshots. Reading it
+ *        does not pause scanout or rendering, so a snapshot taken mid-flush can mix two frames.
+ *
+ * @param width  Set to the frame buffer width in pixels (panel orientation, before LVGL rotation)
+ * @param height Set to the frame buffer height in pixels
+ *
+ * @return Pixels in the panel's colour format (RGB565 with 16-bit LVGL colour), or nullptr if the panel has no
+ *         CPU-visible frame buffer
+ */
+const void *lvgl_port_get_scanout_buffer(uint16_t *width, uint16_t *height);
+
+/**
+ * @brief Change the bounds on how long the LVGL task sleeps between timer runs at runtime. The defaults are
+ *        `LVGL_PORT_TASK_MIN_DELAY_MS` and `LVGL_PORT_TASK_MAX_DELAY_MS`; the new bounds apply from the next sleep.
+ *
+ * @param min_ms Minimum sleep, in milliseconds (at least 1)
+ * @param max_ms Maximum sleep, in milliseconds (at least `min_ms`)
+ *
+ * @return true if success, otherwise false
+ */
+bool lvgl_port_set_task_delay(uint32_t min_ms, uint32_t max_ms);
+
+/**
+ * @brief Get the number of completed LVGL refreshes since boot (wraps), for measuring the frame rate over a window.
+ */
+uint32_t lvgl_port_get_frame_count(void);
+
+/**
+ * @brief Get the total time in microseconds the LVGL task has spent running frame callbacks and LVGL timers
+ *        (rendering and flushing) since boot. Wraps after about 71 minutes, so only differences between samples
+ *        taken more often than that are meaningful.
+ */
+uint32_t lvgl_port_get_busy_us(void);
+
+/**
+ * @brief Wake the LVGL task before its next timer deadline, e.g. after an input event. Unlocking from another task
+ *        already does this, so it is only needed for changes made without `lvgl_port_lock()`.
+ *
+ * @return true if success, otherwise false
+ */
+bool lvgl_port_notify(void);
+
+/**
+ * @brief ISR-safe version of `lvgl_port_notify()`.
+ *
+ * @return true if a higher priority task was woken and the ISR should yield
+ */
+bool lvgl_port_notify_from_isr(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -6,6 +6,7 @@
  * - Movie-accurate HAL 9000 eye with gradient rings and smooth pulsing
  * - State-based color shifts (idle, listening, speaking)
  * - Face display mode with red-filtered JPEG streaming from Pi
+ * - Cross-fades between the eye and face modes
  */
 
 #include <Arduino.h>
@@ -15,7 +16,27 @@
 #include <esp_display_panel.hpp>
 #include <lvgl.h>
 #include <TJpg_Decoder.h>
+#include <mbedtls/base64.h>
+#include <esp_timer.h>
 #include "lvgl_v8_port.h"
+#include "clock_sync.h"
+#include "eye_timeline.h"
+#include "hal_eye.h"
+#include "face_view.h"
+#include "buffer_pool.h"
+#include "display_mode.h"
+#include "face_latency.h"
+#include "metrics.h"
+#include "trace.h"
+#include "log_sink.h"
+#include "diag_server.h"
+#include "boot_timing.h"
+#include "splash.h"
+#include "wifi_manager.h"
+#include "backend_discovery.h"
+#include "config.h"
+#include "idle_governor.h"
+#include "power_manager.h"
 #include "secrets.h"
 
 using namespace esp_panel::drivers;
@@ -27,49 +48,77 @@ using namespace esp_panel::board;
 #define CENTER_X          240
 #define CENTER_Y          240
 
-// HAL eye parameters - movie accurate
-#define EYE_OUTER_RADIUS    140
-#define EYE_RING_1_RADIUS   130
-#define EYE_RING_2_RADIUS   118
-#define EYE_RING_3_RADIUS   105
-#define EYE_RING_4_RADIUS   90
-#define EYE_INNER_RADIUS    75
-#define EYE_CENTER_RADIUS   30
-#define EYE_HIGHLIGHT_RADIUS 12
-
-// Display modes
+// Poll and fetch intervals, HTTP timeouts, eye pacing and the metrics report interval are runtime
+// tunables, see config.h
+
+// Performance metrics: gauges are sampled every second
+#define METRICS_SAMPLE_INTERVAL_MS  1000
+
+// Repeated request failures (backend down) print at most once per interval per call site
+#define LOG_FAILURE_INTERVAL_MS     10000
+
+// Show "Offline Mode" when WiFi has not connected for this long (it keeps retrying)
+#define OFFLINE_LABEL_DELAY_MS      15000
+
+// Display modes, registered with display_mode.h; the eye is the default
 enum DisplayMode {
     MODE_EYE,
-    MODE_FACE
+    MODE_FACE,
+    MODE_COUNT
 };
 
-// LVGL objects for HAL eye layers (outer to inner)
-static lv_obj_t *outer_glow = NULL;
-static lv_obj_t *ring_1 = NULL;
-static lv_obj_t *ring_2 = NULL;
-static lv_obj_t *ring_3 = NULL;
-static lv_obj_t *ring_4 = NULL;
-static lv_obj_t *main_eye = NULL;
-static lv_obj_t *center_yellow = NULL;
-static lv_obj_t *center_highlight = NULL;
+// Status text under the eye
 static lv_obj_t *status_label = NULL;
 
-// Face display objects
-static lv_obj_t *face_canvas = NULL;
-static lv_color_t *face_buffer = NULL;
+// WiFi connection, kept up in the background by wifi_manager
+static unsigned long wifi_down_since = 0;
+static bool wifi_connected = false;
+static bool wifi_offline_shown = false;
 
 // Animation state
 static unsigned long last_display_check = 0;
 static unsigned long last_frame_fetch = 0;
+static unsigned long last_metrics_sample = 0;
+static unsigned long last_metrics_report = 0;
 
 // HAL state from backend
 static String hal_state = "idle";
 static bool hal_listening = false;
-static bool hal_speaking = false;
 static DisplayMode current_mode = MODE_EYE;
 static String current_person = "";
 
-// API settings from secrets.h
+// Scheduled state changes from the backend ("state X from server time T1 to T2"),
+// applied on the synchronised clock so the eye lines up with audio playback
+#define MAX_SCHEDULED_EVENTS 8
+typedef struct {
+    uint32_t id;
+    int64_t start_ms;
+    int64_t end_ms;
+    bool listening;
+    bool speaking;
+} ScheduledEvent;
+static ScheduledEvent scheduled_events[MAX_SCHEDULED_EVENTS];
+static int scheduled_event_count = 0;
+
+// Effective state drawn by the eye (polled state overridden by active events, which alone can speak)
+static bool eye_listening = false;
+static bool eye_speaking = false;
+static uint32_t eye_event_id = 0;
+static int64_t eye_event_start_ms = 0;
+
+// Keyframe scripts uploaded by the backend, one per eye state
+static EyeTimeline eye_timelines[EYE_STATE_COUNT];
+static String eye_script_version = "";
+
+// Speech amplitude envelope (8-bit samples) for the latest speaking event. The backend decimates longer
+// envelopes to fit (DISPLAY_MAX_ENVELOPE_SAMPLES in backend/hal_controller.py)
+#define MAX_ENVELOPE_SAMPLES 1536
+static uint8_t speech_envelope[MAX_ENVELOPE_SAMPLES];
+static size_t speech_envelope_len = 0;
+static uint16_t speech_envelope_hz = 0;
+static uint32_t speech_envelope_id = 0;
+
+// Backend address: discovered over mDNS and cached, secrets.h is the first-boot fallback
 String api_host = HAL_API_HOST;
 int api_port = HAL_API_PORT;
 
@@ -77,48 +126,39 @@ int api_port = HAL_API_PORT;
 static bool jpeg_decode_success = false;
 
 // Forward declarations
-void create_hal_eye(void);
-void create_face_display(void);
-void update_hal_eye(lv_timer_t *timer);
+void create_ui(void);
+void check_wifi(void);
 void check_display_state(void);
 void fetch_face_frame(void);
-void show_eye_mode(void);
-void show_face_mode(void);
-bool tft_output(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t* bitmap);
-
-// JPEG decoder callback - draws to LVGL canvas
-bool tft_output(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t* bitmap) {
-    if (face_canvas == NULL || face_buffer == NULL) return false;
-
-    // Copy decoded pixels to canvas buffer
-    for (int j = 0; j < h; j++) {
-        for (int i = 0; i < w; i++) {
-            int px = x + i;
-            int py = y + j;
-            if (px < SCREEN_WIDTH && py < SCREEN_HEIGHT) {
-                face_buffer[py * SCREEN_WIDTH + px].full = bitmap[j * w + i];
-            }
-        }
-    }
-    return true;
-}
+void fetch_eye_scripts(void);
+void fetch_config(void);
+void apply_config_changes(void);
+void forget_backend_state(void);
+void report_metrics(void);
+void switch_mode(DisplayMode mode);
+void repace_display_mode(void);
+void parse_hal_state(const char *state, bool *listening, bool *speaking);
+bool resolve_eye_state(void);
+int envelope_level(int64_t elapsed_ms);
+void update_status_label(void);
 
 void setup()
 {
     Serial.begin(115200);
-    delay(2000);
-    Serial.println("\n\n========================================");
-    Serial.println("HAL 9000 Display Starting...");
-    Serial.println("========================================");
+    log_sink_init();
+    config_init();
+    power_manager_init();
+#if TRACE_ENABLED
+    trace_init();
+#endif
+    // Setup logs go through the sink: with USB CDC and no host attached a direct print can stall the boot
+    LOG("HAL 9000 Display Starting...");
 
     // Initialize board
-    Serial.println("Creating board object...");
     Board *board = new Board();
-    Serial.println("Board created, calling init...");
     if (!board->init()) {
-        Serial.println("ERROR: Board init failed!");
+        LOG("ERROR: Board init failed!");
     }
-    Serial.println("Board init done");
 
 #if LVGL_PORT_AVOID_TEARING_MODE
     auto lcd = board->getLCD();
@@ -130,16 +170,26 @@ void setup()
     }
 #endif
 #endif
-    Serial.println("Calling board->begin()...");
     if (!board->begin()) {
-        Serial.println("ERROR: board->begin() failed!");
+        LOG("ERROR: board->begin() failed!");
+    }
+    boot_timing_mark(BOOT_PHASE_BOARD_READY);
+
+    // Put the eye on the glass before anything else is up
+    if (splash_draw(board->getLCD())) {
+        boot_timing_mark(BOOT_PHASE_FIRST_PIXEL);
+    } else {
+        LOG("Splash draw failed");
     }
-    Serial.println("Board started successfully");
+
+    // Start WiFi now so the association runs while LVGL and the eye come up
+    backend_discovery_begin(api_host, api_port);
+    wifi_manager_begin(WIFI_SSID, WIFI_PASSWORD);
+    wifi_down_since = millis();
 
     // Initialize LVGL
-    Serial.println("Initializing LVGL...");
     lvgl_port_init(board->getLCD(), board->getTouch());
-    Serial.println("LVGL initialized");
+    lvgl_port_set_task_delay(config_get(CONFIG_LVGL_MIN_DELAY_MS), config_get(CONFIG_LVGL_MAX_DELAY_MS));
 
     // Initialize TJpg_Decoder
     TJpgDec.setJpgScale(1);
@@ -147,236 +197,217 @@ void setup()
     TJpgDec.setCallback(tft_output);
 
     // Create UI elements
-    Serial.println("Creating HAL 9000 eye");
     lvgl_port_lock(-1);
-    create_hal_eye();
-    create_face_display();
+    create_ui();
+    lv_label_set_text(status_label, "Connecting...");
     lvgl_port_unlock();
+    lvgl_port_start_refresh();
+    boot_timing_mark(BOOT_PHASE_UI_READY);
+    idle_governor_begin(board->getBacklight());
 
-    // Connect to WiFi
-    Serial.println("Connecting to WiFi...");
-    WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
-
-    int wifi_attempts = 0;
-    while (WiFi.status() != WL_CONNECTED && wifi_attempts < 30) {
-        delay(500);
-        Serial.print(".");
-        wifi_attempts++;
-    }
-
-    if (WiFi.status() == WL_CONNECTED) {
-        Serial.println("\nWiFi connected!");
-        Serial.print("IP: ");
-        Serial.println(WiFi.localIP());
-        Serial.printf("Backend URL: http://%s:%d/api/hal/display\n", api_host.c_str(), api_port);
-
-        lvgl_port_lock(-1);
-        lv_label_set_text(status_label, "HAL 9000 Online");
-        lvgl_port_unlock();
-    } else {
-        Serial.println("\nWiFi failed!");
-        lvgl_port_lock(-1);
-        lv_label_set_text(status_label, "Offline Mode");
-        lvgl_port_unlock();
-    }
-
-    Serial.println("Setup complete!");
+    LOG("Setup complete, connecting to WiFi in the background");
 }
 
 void loop()
 {
     unsigned long now = millis();
 
-    // Check display state every 1 second
-    if (now - last_display_check >= 1000) {
+    check_wifi();
+    apply_config_changes();
+    if (idle_governor_poll()) {
+        repace_display_mode();
+    }
+    if (backend_discovery_poll(api_host, api_port)) {
+        LOG("Using backend http://%s:%d", api_host.c_str(), api_port);
+        forget_backend_state();
+    }
+
+    // Check display state every poll interval
+    if (now - last_display_check >= config_get(CONFIG_POLL_INTERVAL_MS)) {
         last_display_check = now;
         check_display_state();
     }
 
     // Fetch face frame more frequently when in face mode
-    if (current_mode == MODE_FACE && now - last_frame_fetch >= 200) {
+    if (current_mode == MODE_FACE && now - last_frame_fetch >= config_get(CONFIG_FACE_INTERVAL_MS)) {
         last_frame_fetch = now;
         fetch_face_frame();
     }
+    face_latency_poll();
+
+    if (now - last_metrics_sample >= METRICS_SAMPLE_INTERVAL_MS) {
+        last_metrics_sample = now;
+        metrics_sample_gauges();
+    }
+    if (now - last_metrics_report >= config_get(CONFIG_METRICS_REPORT_MS)) {
+        last_metrics_report = now;
+        report_metrics();
+    }
+
+#if TRACE_ENABLED
+    // 't' on the serial console dumps the trace ring as Chrome trace JSON
+    if (Serial.available() && Serial.read() == 't') {
+        trace_write_json(Serial);
+    }
+#endif
 
     delay(10);
 }
 
-void create_hal_eye(void)
+// Drive the WiFi manager and follow its connection state; the eye animates throughout
+void check_wifi(void)
 {
-    // Set black background
-    lv_obj_set_style_bg_color(lv_scr_act(), lv_color_black(), 0);
+    bool connected = wifi_manager_poll();
+    if (connected == wifi_connected) {
+        if (!connected && !wifi_offline_shown && millis() - wifi_down_since >= OFFLINE_LABEL_DELAY_MS) {
+            // Keep retrying in the background, but say so
+            wifi_offline_shown = true;
+            lvgl_port_lock(-1);
+            lv_label_set_text(status_label, "Offline Mode");
+            lvgl_port_unlock();
+        }
+        return;
+    }
+    wifi_connected = connected;
 
-    // Create outer glow circle (pulsing, darkest)
-    outer_glow = lv_obj_create(lv_scr_act());
-    lv_obj_remove_style_all(outer_glow);
-    lv_obj_set_size(outer_glow, EYE_OUTER_RADIUS * 2 + 30, EYE_OUTER_RADIUS * 2 + 30);
-    lv_obj_align(outer_glow, LV_ALIGN_CENTER, 0, 0);
-    lv_obj_set_style_bg_color(outer_glow, lv_color_make(40, 0, 0), 0);
-    lv_obj_set_style_bg_opa(outer_glow, LV_OPA_COVER, 0);
-    lv_obj_set_style_radius(outer_glow, LV_RADIUS_CIRCLE, 0);
-    lv_obj_set_style_border_width(outer_glow, 0, 0);
-
-    // Gradient ring 1 (dark red)
-    ring_1 = lv_obj_create(lv_scr_act());
-    lv_obj_remove_style_all(ring_1);
-    lv_obj_set_size(ring_1, EYE_RING_1_RADIUS * 2, EYE_RING_1_RADIUS * 2);
-    lv_obj_align(ring_1, LV_ALIGN_CENTER, 0, 0);
-    lv_obj_set_style_bg_color(ring_1, lv_color_make(80, 0, 0), 0);
-    lv_obj_set_style_bg_opa(ring_1, LV_OPA_COVER, 0);
-    lv_obj_set_style_radius(ring_1, LV_RADIUS_CIRCLE, 0);
-    lv_obj_set_style_border_width(ring_1, 0, 0);
-
-    // Gradient ring 2
-    ring_2 = lv_obj_create(lv_scr_act());
-    lv_obj_remove_style_all(ring_2);
-    lv_obj_set_size(ring_2, EYE_RING_2_RADIUS * 2, EYE_RING_2_RADIUS * 2);
-    lv_obj_align(ring_2, LV_ALIGN_CENTER, 0, 0);
-    lv_obj_set_style_bg_color(ring_2, lv_color_make(120, 0, 0), 0);
-    lv_obj_set_style_bg_opa(ring_2, LV_OPA_COVER, 0);
-    lv_obj_set_style_radius(ring_2, LV_RADIUS_CIRCLE, 0);
-    lv_obj_set_style_border_width(ring_2, 0, 0);
-
-    // Gradient ring 3
-    ring_3 = lv_obj_create(lv_scr_act());
-    lv_obj_remove_style_all(ring_3);
-    lv_obj_set_size(ring_3, EYE_RING_3_RADIUS * 2, EYE_RING_3_RADIUS * 2);
-    lv_obj_align(ring_3, LV_ALIGN_CENTER, 0, 0);
-    lv_obj_set_style_bg_color(ring_3, lv_color_make(160, 0, 0), 0);
-    lv_obj_set_style_bg_opa(ring_3, LV_OPA_COVER, 0);
-    lv_obj_set_style_radius(ring_3, LV_RADIUS_CIRCLE, 0);
-    lv_obj_set_style_border_width(ring_3, 0, 0);
-
-    // Gradient ring 4
-    ring_4 = lv_obj_create(lv_scr_act());
-    lv_obj_remove_style_all(ring_4);
-    lv_obj_set_size(ring_4, EYE_RING_4_RADIUS * 2, EYE_RING_4_RADIUS * 2);
-    lv_obj_align(ring_4, LV_ALIGN_CENTER, 0, 0);
-    lv_obj_set_style_bg_color(ring_4, lv_color_make(190, 0, 0), 0);
-    lv_obj_set_style_bg_opa(ring_4, LV_OPA_COVER, 0);
-    lv_obj_set_style_radius(ring_4, LV_RADIUS_CIRCLE, 0);
-    lv_obj_set_style_border_width(ring_4, 0, 0);
-
-    // Main inner eye circle (brightest red)
-    main_eye = lv_obj_create(lv_scr_act());
-    lv_obj_remove_style_all(main_eye);
-    lv_obj_set_size(main_eye, EYE_INNER_RADIUS * 2, EYE_INNER_RADIUS * 2);
-    lv_obj_align(main_eye, LV_ALIGN_CENTER, 0, 0);
-    lv_obj_set_style_bg_color(main_eye, lv_color_make(220, 0, 0), 0);
-    lv_obj_set_style_bg_opa(main_eye, LV_OPA_COVER, 0);
-    lv_obj_set_style_radius(main_eye, LV_RADIUS_CIRCLE, 0);
-    lv_obj_set_style_border_color(main_eye, lv_color_make(255, 50, 0), 0);
-    lv_obj_set_style_border_width(main_eye, 2, 0);
-
-    // Center yellow/orange spot
-    center_yellow = lv_obj_create(lv_scr_act());
-    lv_obj_remove_style_all(center_yellow);
-    lv_obj_set_size(center_yellow, EYE_CENTER_RADIUS * 2, EYE_CENTER_RADIUS * 2);
-    lv_obj_align(center_yellow, LV_ALIGN_CENTER, 0, 0);
-    lv_obj_set_style_bg_color(center_yellow, lv_color_make(255, 180, 0), 0);
-    lv_obj_set_style_bg_opa(center_yellow, LV_OPA_COVER, 0);
-    lv_obj_set_style_radius(center_yellow, LV_RADIUS_CIRCLE, 0);
-    lv_obj_set_style_border_width(center_yellow, 0, 0);
-
-    // Center highlight (white reflection)
-    center_highlight = lv_obj_create(lv_scr_act());
-    lv_obj_remove_style_all(center_highlight);
-    lv_obj_set_size(center_highlight, EYE_HIGHLIGHT_RADIUS * 2, EYE_HIGHLIGHT_RADIUS * 2);
-    lv_obj_align(center_highlight, LV_ALIGN_CENTER, -4, -4);
-    lv_obj_set_style_bg_color(center_highlight, lv_color_white(), 0);
-    lv_obj_set_style_bg_opa(center_highlight, LV_OPA_80, 0);
-    lv_obj_set_style_radius(center_highlight, LV_RADIUS_CIRCLE, 0);
-    lv_obj_set_style_border_width(center_highlight, 0, 0);
+    if (!connected) {
+        wifi_down_since = millis();
+        return;
+    }
 
-    // Create status label
-    status_label = lv_label_create(lv_scr_act());
-    lv_label_set_text(status_label, "Initializing...");
-    lv_obj_set_style_text_color(status_label, lv_color_make(200, 0, 0), 0);
-    lv_obj_set_style_text_font(status_label, &lv_font_montserrat_16, 0);
-    lv_obj_align(status_label, LV_ALIGN_BOTTOM_MID, 0, -30);
+    boot_timing_mark(BOOT_PHASE_WIFI_CONNECTED);
+    backend_discovery_start();
+    LOG("IP %s, backend http://%s:%d/api/hal/display",
+        WiFi.localIP().toString().c_str(), api_host.c_str(), api_port);
+    if (diag_server_start()) {
+        LOG("Diagnostics: http://%s/metrics", WiFi.localIP().toString().c_str());
+    }
+    wifi_offline_shown = false;
 
-    // Create animation timer
-    lv_timer_create(update_hal_eye, 33, NULL);  // ~30fps
+    lvgl_port_lock(-1);
+    lv_label_set_text(status_label, "HAL 9000 Online");
+    lvgl_port_unlock();
 }
 
-void create_face_display(void)
+// Eye mode: the eye layers under the status label, restyled every tick at the idle governor's pacing
+static bool eye_mode_enter(lv_obj_t *parent)
 {
-    // Allocate face buffer in PSRAM
-    face_buffer = (lv_color_t *)heap_caps_malloc(SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
-    if (face_buffer == NULL) {
-        Serial.println("ERROR: Failed to allocate face buffer in PSRAM!");
-        return;
+    hal_eye_create(parent);
+    lv_obj_move_foreground(status_label);
+    return true;
+}
+
+static void eye_mode_exit(void)
+{
+    hal_eye_destroy();
+}
+
+static void eye_mode_tick(uint32_t frame)
+{
+    // Apply any scheduled state change that has come due
+    if (resolve_eye_state()) {
+        update_status_label();
     }
 
-    // Create canvas for face display
-    face_canvas = lv_canvas_create(lv_scr_act());
-    lv_canvas_set_buffer(face_canvas, face_buffer, SCREEN_WIDTH, SCREEN_HEIGHT, LV_IMG_CF_TRUE_COLOR);
-    lv_obj_align(face_canvas, LV_ALIGN_CENTER, 0, 0);
+    HalEyeInput input;
+    input.state = eye_listening ? EYE_STATE_LISTENING : eye_speaking ? EYE_STATE_SPEAKING : EYE_STATE_IDLE;
+    input.now_ms = clock_sync_server_ms();
+    input.script = &eye_timelines[input.state];
+    // Scheduled events start their script at the event time, otherwise it loops on the shared clock
+    input.script_elapsed_ms = eye_event_id ? input.now_ms - eye_event_start_ms : input.now_ms;
+    // While speaking, follow the speech envelope so HAL visibly talks
+    input.envelope_level = eye_speaking ? envelope_level(input.now_ms - eye_event_start_ms) : -1;
+    hal_eye_render(&input);
+    boot_timing_mark(BOOT_PHASE_FIRST_FRAME);
+}
 
-    // Initially hidden
-    lv_obj_add_flag(face_canvas, LV_OBJ_FLAG_HIDDEN);
+// Face mode: the full-screen canvas and its frame buffers exist only while the mode is active. The loop
+// fetches and decodes frames; with interpolation the ticks blend between them at face_divisor, otherwise
+// there are no ticks and each decode is recorded against the fetch interval
+static bool face_mode_enter(lv_obj_t *parent)
+{
+    if (!face_view_create(parent)) {
+        return false;
+    }
+    if (config_get_bool(CONFIG_FACE_INTERP) && !face_view_enable_interpolation()) {
+        LOG_EVERY_MS(10000, "No buffers for face interpolation, showing frames as they arrive");
+    }
+    face_view_set_visible(true);
+    return true;
+}
 
-    // Fill with black initially
-    lv_canvas_fill_bg(face_canvas, lv_color_black(), LV_OPA_COVER);
+static void face_mode_exit(void)
+{
+    face_view_destroy();
 }
 
-void update_hal_eye(lv_timer_t *timer)
+static void face_mode_tick(uint32_t frame)
 {
-    // Skip animation if in face mode
-    if (current_mode == MODE_FACE) return;
-
-    // Sinusoidal pulse calculation
-    float pulse_speed = 0.002f;  // Normal idle speed
-    if (hal_listening) {
-        pulse_speed = 0.006f;  // Faster when listening
-    } else if (hal_speaking) {
-        pulse_speed = 0.004f;  // Medium when speaking
-    }
-
-    // Smooth sinusoidal pulse (0.0 to 1.0)
-    float pulse = (sin(millis() * pulse_speed) * 0.5f) + 0.5f;
-
-    // Base colors based on state
-    uint8_t base_r, base_g;
-    if (hal_listening) {
-        // Bright red when listening
-        base_r = 255;
-        base_g = 0;
-    } else if (hal_speaking) {
-        // Orange-red when speaking
-        base_r = 255;
-        base_g = 51;  // #FF3300
-    } else {
-        // Deep red when idle (#CC0000)
-        base_r = 204;
-        base_g = 0;
+    int64_t now_us = esp_timer_get_time();
+    if (face_view_interpolate(now_us)) {
+        face_latency_shown(now_us);
     }
+}
+
+static uint32_t face_mode_frame_divisor(void)
+{
+    return face_view_interpolating() ? config_get(CONFIG_FACE_DIVISOR) : 0;
+}
+
+// Without VSYNC interpolated frames run at the eye's frame period
+static uint32_t face_mode_frame_period_ms(void)
+{
+    return config_get(face_view_interpolating() ? CONFIG_EYE_FRAME_PERIOD_MS : CONFIG_FACE_INTERVAL_MS);
+}
+
+// Transitions into face mode fade to the canvas itself, so frames decoded meanwhile show up in the fade
+static const uint16_t *face_mode_pixels(void)
+{
+    return (const uint16_t *)face_view_pixels();
+}
 
-    // Apply pulse to colors (vary brightness)
-    float brightness = 0.7f + (pulse * 0.3f);
+// A budget of 0 is the whole tick interval: the eye must be on the glass before its next tick is due
+static const DisplayModeOps EYE_MODE = {
+    "eye", eye_mode_enter, eye_mode_exit, eye_mode_tick,
+    idle_governor_eye_divisor, idle_governor_eye_period_ms, 0, NULL
+};
+static const DisplayModeOps FACE_MODE = {
+    "face", face_mode_enter, face_mode_exit, face_mode_tick,
+    face_mode_frame_divisor, face_mode_frame_period_ms, 0, face_mode_pixels
+};
 
-    // Update outer glow size based on pulse
-    int pulse_offset = (int)(pulse * 20);
-    int glow_size = (EYE_OUTER_RADIUS * 2) + 30 + pulse_offset;
-    lv_obj_set_size(outer_glow, glow_size, glow_size);
-    lv_obj_align(outer_glow, LV_ALIGN_CENTER, 0, 0);
+// Call with the LVGL lock held
+void create_ui(void)
+{
+    // Set black background
+    lv_obj_set_style_bg_color(lv_scr_act(), lv_color_black(), 0);
 
-    // Update glow color
-    lv_obj_set_style_bg_color(outer_glow, lv_color_make((uint8_t)(40 * brightness), 0, 0), 0);
+    // Create status label
+    status_label = lv_label_create(lv_scr_act());
+    lv_label_set_text(status_label, "Initializing...");
+    lv_obj_set_style_text_color(status_label, lv_color_make(200, 0, 0), 0);
+    lv_obj_set_style_text_font(status_label, &lv_font_montserrat_16, 0);
+    lv_obj_align(status_label, LV_ALIGN_BOTTOM_MID, 0, -30);
 
-    // Update ring colors with gradient based on state
-    lv_obj_set_style_bg_color(ring_1, lv_color_make((uint8_t)(base_r * 0.35f * brightness), (uint8_t)(base_g * 0.35f * brightness), 0), 0);
-    lv_obj_set_style_bg_color(ring_2, lv_color_make((uint8_t)(base_r * 0.50f * brightness), (uint8_t)(base_g * 0.50f * brightness), 0), 0);
-    lv_obj_set_style_bg_color(ring_3, lv_color_make((uint8_t)(base_r * 0.70f * brightness), (uint8_t)(base_g * 0.70f * brightness), 0), 0);
-    lv_obj_set_style_bg_color(ring_4, lv_color_make((uint8_t)(base_r * 0.85f * brightness), (uint8_t)(base_g * 0.85f * brightness), 0), 0);
-    lv_obj_set_style_bg_color(main_eye, lv_color_make((uint8_t)(base_r * brightness), (uint8_t)(base_g * brightness), 0), 0);
+    // Start in eye mode; other modes allocate their objects when entered
+    display_mode_register(MODE_EYE, &EYE_MODE);
+    display_mode_register(MODE_FACE, &FACE_MODE);
+    switch_mode(MODE_EYE);
+}
 
-    // Update border glow
-    lv_obj_set_style_border_color(main_eye, lv_color_make(255, (uint8_t)(50 + pulse * 30), 0), 0);
+// Call with the LVGL lock held
+void switch_mode(DisplayMode mode)
+{
+    display_mode_switch(mode, lv_scr_act());
+    current_mode = (DisplayMode)display_mode_current();
+}
 
-    // Subtle center yellow/white pulsing
-    uint8_t yellow_g = 180 + (uint8_t)(pulse * 40);
-    lv_obj_set_style_bg_color(center_yellow, lv_color_make(255, yellow_g, 0), 0);
+// Restart the active mode's ticks after the idle governor or the config changed its pacing
+void repace_display_mode(void)
+{
+    lvgl_port_lock(-1);
+    display_mode_repace();
+    lvgl_port_unlock();
 }
 
 void check_display_state(void)
@@ -384,32 +415,44 @@ void check_display_state(void)
     if (WiFi.status() != WL_CONNECTED) {
         return;
     }
+    TRACE_SCOPE("check_display_state");
 
     HTTPClient http;
-    String url = "http://" + api_host + ":" + String(api_port) + "/api/hal/display";
+    String url = "http://" + api_host + ":" + String(api_port) + "/api/hal/display?known=" + String(speech_envelope_id);
 
     http.begin(url);
-    http.setTimeout(2000);
+    http.setTimeout(config_get(CONFIG_HTTP_TIMEOUT_MS));
 
+    uint32_t request_sent = millis();
     int httpCode = http.GET();
+    bool scripts_changed = false;
+    bool config_changed = false;
 
     if (httpCode == 200) {
         String response = http.getString();
+        uint32_t response_received = millis();
+        boot_timing_mark(BOOT_PHASE_ONLINE);
+        backend_discovery_report(true);
 
         JsonDocument doc;
         if (!deserializeJson(doc, response)) {
+            // Every poll doubles as a clock sync exchange
+            if (doc["server_rx_ms"].is<int64_t>() && doc["server_tx_ms"].is<int64_t>()) {
+                clock_sync_sample(request_sent, response_received,
+                                  doc["server_rx_ms"].as<int64_t>(), doc["server_tx_ms"].as<int64_t>());
+            }
+
             // Get mode
             const char* mode = doc["mode"];
             DisplayMode new_mode = (strcmp(mode, "face") == 0) ? MODE_FACE : MODE_EYE;
 
             // Get state
-            if (doc["state"].is<const char*>()) {
+            bool state_changed = false;
+            if (doc["state"].is<const char*>() && hal_state != doc["state"].as<const char*>()) {
                 hal_state = doc["state"].as<String>();
-                hal_listening = hal_state.indexOf("awaiting") >= 0 ||
-                               hal_state.indexOf("listening") >= 0;
-                hal_speaking = hal_state.indexOf("asking") >= 0 ||
-                              hal_state.indexOf("confirming") >= 0 ||
-                              hal_state.indexOf("speaking") >= 0;
+                bool polled_speaking;       // Ignored, see parse_hal_state()
+                parse_hal_state(hal_state.c_str(), &hal_listening, &polled_speaking);
+                state_changed = true;
             }
 
             // Get person name
@@ -419,115 +462,384 @@ void check_display_state(void)
                 current_person = "";
             }
 
+            // Anyone in view, a state change or a scheduled event keeps the display out of idle
+            if (state_changed || new_mode == MODE_FACE || current_person.length() > 0 ||
+                doc["events"].as<JsonArray>().size() > 0) {
+                if (idle_governor_activity()) {
+                    repace_display_mode();
+                }
+            }
+
             // Switch modes if needed
             if (new_mode != current_mode) {
-                current_mode = new_mode;
                 lvgl_port_lock(-1);
-                if (current_mode == MODE_FACE) {
-                    show_face_mode();
-                } else {
-                    show_eye_mode();
-                }
+                switch_mode(new_mode);
                 lvgl_port_unlock();
             }
+            power_manager_set_streaming(current_mode == MODE_FACE);
 
-            // Update status label
+            // Note when the backend has new eye scripts; fetched after this request completes
+            scripts_changed = doc["script_version"].is<const char*>() &&
+                              eye_script_version != doc["script_version"].as<const char*>();
+            config_changed = doc["config_version"].is<const char*>() &&
+                             strcmp(config_backend_version(), doc["config_version"].as<const char*>()) != 0;
+
+            // Replace the schedule (the backend lists every pending or active event)
             lvgl_port_lock(-1);
-            if (current_mode == MODE_FACE && current_person.length() > 0) {
-                lv_label_set_text(status_label, current_person.c_str());
-            } else if (hal_listening) {
-                lv_label_set_text(status_label, "Listening...");
-            } else if (hal_speaking) {
-                lv_label_set_text(status_label, "Speaking...");
-            } else {
-                lv_label_set_text(status_label, "HAL 9000 Online");
+            scheduled_event_count = 0;
+            for (JsonObject event : doc["events"].as<JsonArray>()) {
+                if (scheduled_event_count >= MAX_SCHEDULED_EVENTS) break;
+                ScheduledEvent *ev = &scheduled_events[scheduled_event_count++];
+                ev->id = event["id"] | 0u;
+                ev->start_ms = event["start_ms"].as<int64_t>();
+                ev->end_ms = event["end_ms"].as<int64_t>();
+                parse_hal_state(event["state"] | "", &ev->listening, &ev->speaking);
+
+                // Envelopes are only sent until we acknowledge them via ?known=
+                const char *env = event["env"];
+                if (env != NULL && ev->id > speech_envelope_id) {
+                    size_t decoded = 0;
+                    int err = mbedtls_base64_decode(speech_envelope, sizeof(speech_envelope), &decoded,
+                                                    (const unsigned char *)env, strlen(env));
+                    if (err == 0) {
+                        speech_envelope_len = decoded;
+                        speech_envelope_hz = event["env_hz"] | 50;
+                    } else {
+                        // Acknowledged all the same, or the backend would resend it with every poll
+                        LOG("Envelope for event %lu not decoded (%d, %u base64 bytes)", (unsigned long)ev->id, err,
+                            (unsigned)strlen(env));
+                        speech_envelope_len = 0;
+                    }
+                    speech_envelope_id = ev->id;
+                }
             }
+
+            // Update status label
+            resolve_eye_state();
+            update_status_label();
             lvgl_port_unlock();
         }
     } else if (httpCode < 0) {
-        Serial.println("Display check failed: " + String(httpCode));
+        backend_discovery_report(false);
+        LOG_EVERY_MS(LOG_FAILURE_INTERVAL_MS, "Display check failed: %d", httpCode);
     }
 
     http.end();
+
+    if (scripts_changed) {
+        fetch_eye_scripts();
+    }
+    if (config_changed) {
+        fetch_config();
+    }
 }
 
-void show_eye_mode(void)
+// Another backend has its own clock, event ids, scripts and config: drop what came from the old one
+void forget_backend_state(void)
 {
-    // Show eye objects
-    lv_obj_clear_flag(outer_glow, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_clear_flag(ring_1, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_clear_flag(ring_2, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_clear_flag(ring_3, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_clear_flag(ring_4, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_clear_flag(main_eye, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_clear_flag(center_yellow, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_clear_flag(center_highlight, LV_OBJ_FLAG_HIDDEN);
-
-    // Hide face canvas
-    if (face_canvas) {
-        lv_obj_add_flag(face_canvas, LV_OBJ_FLAG_HIDDEN);
-    }
-
-    Serial.println("Switched to EYE mode");
+    clock_sync_reset();
+
+    lvgl_port_lock(-1);
+    scheduled_event_count = 0;
+    speech_envelope_id = 0;
+    speech_envelope_len = 0;
+    if (resolve_eye_state()) {
+        update_status_label();
+    }
+    lvgl_port_unlock();
+
+    // The next poll sees versions that differ and fetches both again
+    eye_script_version = "";
+    config_forget_backend_version();
 }
 
-void show_face_mode(void)
+void fetch_config(void)
 {
-    // Hide eye objects
-    lv_obj_add_flag(outer_glow, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_add_flag(ring_1, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_add_flag(ring_2, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_add_flag(ring_3, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_add_flag(ring_4, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_add_flag(main_eye, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_add_flag(center_yellow, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_add_flag(center_highlight, LV_OBJ_FLAG_HIDDEN);
-
-    // Show face canvas
-    if (face_canvas) {
-        lv_obj_clear_flag(face_canvas, LV_OBJ_FLAG_HIDDEN);
-    }
-
-    Serial.println("Switched to FACE mode");
+    HTTPClient http;
+    String url = "http://" + api_host + ":" + String(api_port) + "/api/hal/config";
+
+    http.begin(url);
+    http.setTimeout(config_get(CONFIG_HTTP_TIMEOUT_MS));
+
+    int httpCode = http.GET();
+
+    if (httpCode == 200) {
+        JsonDocument doc;
+        if (!deserializeJson(doc, http.getString()) && doc["version"].is<const char*>()) {
+            int rejected = config_apply_backend(doc["values"].as<JsonObjectConst>(), doc["version"]);
+            LOG("Loaded config %s (%d rejected)", config_backend_version(), rejected);
+        }
+    } else if (httpCode < 0) {
+        LOG_EVERY_MS(LOG_FAILURE_INTERVAL_MS, "Config fetch failed: %d", httpCode);
+    }
+
+    http.end();
+}
+
+// Re-apply tunables that are not simply re-read at their next use
+void apply_config_changes(void)
+{
+    uint32_t changes = config_take_changes();
+    if (changes & ((1u << CONFIG_LVGL_MIN_DELAY_MS) | (1u << CONFIG_LVGL_MAX_DELAY_MS))) {
+        if (!lvgl_port_set_task_delay(config_get(CONFIG_LVGL_MIN_DELAY_MS), config_get(CONFIG_LVGL_MAX_DELAY_MS))) {
+            LOG("LVGL delay range %lu..%lu ignored", (unsigned long)config_get(CONFIG_LVGL_MIN_DELAY_MS),
+                (unsigned long)config_get(CONFIG_LVGL_MAX_DELAY_MS));
+        }
+    }
+    if (changes & ((1u << CONFIG_EYE_VSYNC_DIVISOR) | (1u << CONFIG_EYE_FRAME_PERIOD_MS) |
+                   (1u << CONFIG_IDLE_EYE_DIVISOR) | (1u << CONFIG_IDLE_FRAME_PERIOD_MS) |
+                   (1u << CONFIG_FADE_DIVISOR) | (1u << CONFIG_FACE_DIVISOR))) {
+        repace_display_mode();
+    }
+    if (changes & ((1u << CONFIG_IDLE_CPU_MHZ) | (1u << CONFIG_BACKLIGHT) | (1u << CONFIG_IDLE_BACKLIGHT))) {
+        idle_governor_apply();
+    }
+    if (changes & (1u << CONFIG_CPU_MIN_MHZ)) {
+        power_manager_apply();
+    }
+}
+
+void fetch_eye_scripts(void)
+{
+    HTTPClient http;
+    String url = "http://" + api_host + ":" + String(api_port) + "/api/hal/eye_script";
+
+    http.begin(url);
+    http.setTimeout(config_get(CONFIG_HTTP_TIMEOUT_MS));
+
+    int httpCode = http.GET();
+
+    if (httpCode == 200) {
+        String response = http.getString();
+
+        JsonDocument doc;
+        if (!deserializeJson(doc, response)) {
+            static const char *state_names[EYE_STATE_COUNT] = { "idle", "listening", "speaking" };
+            static EyeTimeline staged[EYE_STATE_COUNT];
+
+            // Parse into a staging copy so the eye never draws a half-loaded script
+            for (int i = 0; i < EYE_STATE_COUNT; i++) {
+                JsonObject script = doc["states"][state_names[i]];
+                EyeTimeline *tl = &staged[i];
+                tl->count = 0;
+                tl->loop_start_ms = script["loop"][0] | 0;
+                tl->loop_end_ms = script["loop"][1] | 0;
+                for (JsonArray kf : script["kf"].as<JsonArray>()) {
+                    if (tl->count >= EYE_TIMELINE_MAX_KEYFRAMES || kf.size() < 7) break;
+                    EyeKeyframe *k = &tl->frames[tl->count++];
+                    k->t_ms = kf[0];
+                    k->r = kf[1];
+                    k->g = kf[2];
+                    k->b = kf[3];
+                    k->glow = kf[4];
+                    k->brightness = kf[5];
+                    k->ease = kf[6];
+                }
+            }
+
+            lvgl_port_lock(-1);
+            memcpy(eye_timelines, staged, sizeof(eye_timelines));
+            lvgl_port_unlock();
+
+            eye_script_version = doc["version"].as<String>();
+            LOG("Loaded eye scripts %s", eye_script_version.c_str());
+        }
+    } else if (httpCode < 0) {
+        LOG_EVERY_MS(LOG_FAILURE_INTERVAL_MS, "Eye script fetch failed: %d", httpCode);
+    }
+
+    http.end();
+}
+
+// Speaking only comes from scheduled events, which bracket the audio. The polled state is ignored for it:
+// the backend sets states like "asking_name" or "confirming" before generating the speech and keeps them
+// for a while after it
+void parse_hal_state(const char *state, bool *listening, bool *speaking)
+{
+    *listening = strstr(state, "awaiting") != NULL ||
+                 strstr(state, "listening") != NULL;
+    *speaking = strcmp(state, "speaking") == 0;
+}
+
+// Pick the state to draw right now; returns true if it changed. Call with the LVGL lock held.
+bool resolve_eye_state(void)
+{
+    bool listening = hal_listening;
+    bool speaking = false;
+    eye_event_id = 0;
+
+    int64_t now = clock_sync_server_ms();
+    for (int i = 0; i < scheduled_event_count; i++) {
+        if (now >= scheduled_events[i].start_ms && now < scheduled_events[i].end_ms) {
+            listening = scheduled_events[i].listening;
+            speaking = scheduled_events[i].speaking;
+            eye_event_id = scheduled_events[i].id;
+            eye_event_start_ms = scheduled_events[i].start_ms;
+        }
+    }
+
+    bool changed = (listening != eye_listening) || (speaking != eye_speaking);
+    eye_listening = listening;
+    eye_speaking = speaking;
+    return changed;
+}
+
+// Envelope level (0-255) at elapsed_ms into the active speaking event, or -1 if there is none
+int envelope_level(int64_t elapsed_ms)
+{
+    if (eye_event_id == 0 || eye_event_id != speech_envelope_id || speech_envelope_len == 0 || elapsed_ms < 0) {
+        return -1;
+    }
+
+    // Linear interpolation between 20 ms samples keeps 30 fps frames smooth
+    int64_t pos = elapsed_ms * speech_envelope_hz;
+    size_t index = (size_t)(pos / 1000);
+    int frac = (int)(pos % 1000);
+    if (index + 1 >= speech_envelope_len) {
+        return (index < speech_envelope_len) ? speech_envelope[index] : 0;
+    }
+    return speech_envelope[index] + ((speech_envelope[index + 1] - speech_envelope[index]) * frac) / 1000;
+}
+
+// Call with the LVGL lock held
+void update_status_label(void)
+{
+    if (current_mode == MODE_FACE && current_person.length() > 0) {
+        lv_label_set_text(status_label, current_person.c_str());
+    } else if (eye_listening) {
+        lv_label_set_text(status_label, "Listening...");
+    } else if (eye_speaking) {
+        lv_label_set_text(status_label, "Speaking...");
+    } else {
+        lv_label_set_text(status_label, "HAL 9000 Online");
+    }
+}
+
+// Integer response header, -1 if it is missing
+static int64_t header_int64(HTTPClient &http, const char *name)
+{
+    return http.hasHeader(name) ? atoll(http.header(name).c_str()) : -1;
 }
 
 void fetch_face_frame(void)
 {
-    if (WiFi.status() != WL_CONNECTED || face_buffer == NULL) {
+    if (WiFi.status() != WL_CONNECTED || !face_view_ready()) {
         return;
     }
+    TRACE_SCOPE("fetch_face_frame");
 
     HTTPClient http;
     String url = "http://" + api_host + ":" + String(api_port) + "/api/hal/face_frame?red=true&size=480";
 
     http.begin(url);
-    http.setTimeout(3000);
+    http.setTimeout(config_get(CONFIG_FACE_TIMEOUT_MS));
+    http.collectHeaders(FACE_LATENCY_HEADERS, FACE_LATENCY_HEADER_COUNT);
 
+    uint32_t request_sent = millis();
+    int64_t fetch_start_us = esp_timer_get_time();
+    TRACE_BEGIN(get_start_us);
     int httpCode = http.GET();
+    TRACE_END("http_get", get_start_us, httpCode);
+    uint32_t response_received = millis();
 
     if (httpCode == 200) {
+        FaceFrameStamp stamp;
+        stamp.seq = header_int64(http, "X-Frame-Seq");
+        stamp.capture_ms = header_int64(http, "X-Capture-Time");
+        stamp.server_rx_ms = header_int64(http, "X-Server-Rx-Time");
+        stamp.server_tx_ms = header_int64(http, "X-Server-Tx-Time");
+
+        // Frame fetches run 5x a second in face mode, so they double as clock sync exchanges
+        if (stamp.server_rx_ms >= 0 && stamp.server_tx_ms >= 0) {
+            clock_sync_sample(request_sent, response_received, stamp.server_rx_ms, stamp.server_tx_ms);
+        }
+
         int len = http.getSize();
-        if (len > 0 && len < 200000) {  // Sanity check
-            uint8_t *jpeg_buffer = (uint8_t *)heap_caps_malloc(len, MALLOC_CAP_SPIRAM);
+        if (len > 0 && (uint32_t)len < config_get(CONFIG_FACE_MAX_BYTES)) {  // Sanity check
+            // From the pool, so consecutive frames reuse one receive buffer
+            uint8_t *jpeg_buffer = (uint8_t *)buffer_pool_take("face_jpeg", len);
             if (jpeg_buffer) {
                 WiFiClient *stream = http.getStreamPtr();
+                TRACE_BEGIN(read_start_us);
                 int bytesRead = stream->readBytes(jpeg_buffer, len);
+                TRACE_END("jpeg_read", read_start_us, bytesRead);
 
                 if (bytesRead == len) {
-                    // Decode JPEG to canvas
+                    metrics_record(METRIC_JPEG_FETCH_MS, millis() - request_sent);
+                    metrics_record(METRIC_JPEG_BYTES, len);
+                    face_latency_received(&stamp, esp_timer_get_time());
+
+                    // Decode JPEG to canvas. While interpolating it goes to a frame the LVGL task does not
+                    // draw from, so the display keeps blending while this decodes; only the bracketing calls
+                    // need the lock
+                    bool interpolating = face_view_interpolating();
                     lvgl_port_lock(-1);
+                    power_boost_acquire();
+                    face_view_frame_begin();
+                    if (interpolating) {
+                        lvgl_port_unlock();
+                    }
+                    int64_t decode_start = esp_timer_get_time();
                     jpeg_decode_success = (TJpgDec.drawJpg(0, 0, jpeg_buffer, len) == 1);
-                    if (jpeg_decode_success && face_canvas) {
-                        lv_obj_invalidate(face_canvas);
+                    metrics_record_since_us(METRIC_JPEG_DECODE_US, decode_start);
+                    TRACE_END("jpeg_decode", decode_start, (int32_t)face_view_decoded_blocks());
+                    if (interpolating) {
+                        lvgl_port_lock(-1);
+                    }
+                    face_view_frame_end(jpeg_decode_success, esp_timer_get_time());
+                    power_boost_release();
+                    if (jpeg_decode_success) {
+                        face_latency_decoded(esp_timer_get_time(), !interpolating);
+                        // Fetch and decode have to fit the fetch interval to keep the frame rate. While
+                        // interpolating, the mode's frames are the blended ticks instead
+                        if (!interpolating) {
+                            display_mode_record_frame((uint32_t)(esp_timer_get_time() - fetch_start_us));
+                        }
                     }
                     lvgl_port_unlock();
                 }
 
-                heap_caps_free(jpeg_buffer);
+                buffer_pool_give(jpeg_buffer);
             }
         }
     } else if (httpCode < 0) {
-        Serial.println("Face frame fetch failed: " + String(httpCode));
+        LOG_EVERY_MS(LOG_FAILURE_INTERVAL_MS, "Face frame fetch failed: %d", httpCode);
+    }
+
+    http.end();
+}
+
+void report_metrics(void)
+{
+    if (WiFi.status() != WL_CONNECTED) {
+        return;
+    }
+
+    JsonDocument doc;
+    metrics_report(doc);
+    doc["dropped_frames"] = lvgl_port_get_dropped_frames();
+    doc["refresh_period_us"] = lvgl_port_get_refresh_period_us();
+    log_sink_report(doc);
+    boot_timing_report(doc);
+    wifi_manager_report(doc);
+    backend_discovery_report_json(doc);
+    config_report(doc);
+    idle_governor_report(doc);
+    power_manager_report(doc);
+    display_mode_report(doc);
+    String body;
+    serializeJson(doc, body);
+
+    HTTPClient http;
+    String url = "http://" + api_host + ":" + String(api_port) + "/api/hal/metrics";
+
+    http.begin(url);
+    http.setTimeout(config_get(CONFIG_HTTP_TIMEOUT_MS));
+    http.addHeader("Content-Type", "application/json");
+
+    int httpCode = http.POST(body);
+    if (httpCode < 0) {
+        LOG_EVERY_MS(LOG_FAILURE_INTERVAL_MS, "Metrics report failed: %d", httpCode);
     }
 
     http.end();
@@ -0,0 +1,190 @@
+/**
+ * On-device performance metrics - see metrics.h
+ */
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <esp_timer.h>
+#include <esp_heap_caps.h>
+#include "metrics.h"
+
+// Wire names, in MetricId order
+static const char *const METRIC_NAMES[] = {
+    "frame_interval_us",
+    "flush_us",
+    "lock_wait_us",
+    "lock_hold_us",
+    "jpeg_fetch_ms",
+    "jpeg_decode_us",
+    "jpeg_bytes",
+    "face_age_ms",
+    "face_encode_ms",
+    "face_transfer_ms",
+    "face_decode_us",
+    "face_scanout_us",
+    "face_glass_ms",
+    "face_seq_gap",
+    "wifi_rssi_neg_dbm",
+    "wifi_connect_ms",
+    "heap_internal_free",
+    "heap_psram_free",
+    "heap_largest_block",
+    "stack_loop_free",
+    "stack_lvgl_free",
+};
+static_assert(sizeof(METRIC_NAMES) / sizeof(METRIC_NAMES[0]) == METRIC_COUNT, "METRIC_NAMES must match MetricId");
+
+static MetricHistogram histograms[METRIC_COUNT];
+static int64_t window_start_us = 0;
+
+// Recorded from the loop and LVGL tasks; the critical section is a few instructions long
+static portMUX_TYPE metrics_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static inline int bucket_of(uint32_t value)
+{
+    return (value < 2) ? 0 : 31 - __builtin_clz(value);
+}
+
+void metrics_record(MetricId id, uint32_t value)
+{
+    MetricHistogram *h = &histograms[id];
+    int bucket = bucket_of(value);
+
+    portENTER_CRITICAL(&metrics_mux);
+    if (h->count == 0 || value < h->min) {
+        h->min = value;
+    }
+    if (value > h->max) {
+        h->max = value;
+    }
+    h->count++;
+    h->sum += value;
+    h->buckets[bucket]++;
+    portEXIT_CRITICAL(&metrics_mux);
+}
+
+void metrics_record_since_us(MetricId id, int64_t start_us)
+{
+    metrics_record(id, (uint32_t)(esp_timer_get_time() - start_us));
+}
+
+void metrics_sample_gauges(void)
+{
+    static TaskHandle_t lvgl_task = NULL;
+    if (lvgl_task == NULL) {
+        lvgl_task = xTaskGetHandle("lvgl");
+    }
+
+    if (WiFi.status() == WL_CONNECTED) {
+        metrics_record(METRIC_WIFI_RSSI_NEG_DBM, (uint32_t)(-WiFi.RSSI()));
+    }
+    metrics_record(METRIC_HEAP_INTERNAL_FREE, heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+    metrics_record(METRIC_HEAP_PSRAM_FREE, heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+    metrics_record(METRIC_HEAP_LARGEST_BLOCK, heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL));
+    // ESP-IDF reports stack high-water marks in bytes
+    metrics_record(METRIC_STACK_LOOP_FREE, uxTaskGetStackHighWaterMark(NULL));
+    if (lvgl_task != NULL) {
+        metrics_record(METRIC_STACK_LVGL_FREE, uxTaskGetStackHighWaterMark(lvgl_task));
+    }
+}
+
+// Estimate a percentile by interpolating inside the bucket that contains it
+static uint32_t percentile(const MetricHistogram *h, uint32_t per_mille)
+{
+    uint64_t rank = ((uint64_t)h->count * per_mille + 999) / 1000;
+    uint64_t seen = 0;
+    for (int i = 0; i < METRICS_BUCKETS; i++) {
+        if (h->buckets[i] == 0 || seen + h->buckets[i] < rank) {
+            seen += h->buckets[i];
+            continue;
+        }
+        uint64_t lo = (i == 0) ? 0 : (1ULL << i);
+        uint64_t hi = (1ULL << (i + 1)) - 1;
+        uint64_t value = lo + (hi - lo) * (rank - seen) / h->buckets[i];
+        if (value < h->min) {
+            value = h->min;
+        }
+        if (value > h->max) {
+            value = h->max;
+        }
+        return (uint32_t)value;
+    }
+    return h->max;
+}
+
+void metrics_report(JsonDocument &doc)
+{
+    static MetricHistogram snapshot[METRIC_COUNT];
+
+    int64_t now_us = esp_timer_get_time();
+    portENTER_CRITICAL(&metrics_mux);
+    memcpy(snapshot, histograms, sizeof(histograms));
+    memset(histograms, 0, sizeof(histograms));
+    portEXIT_CRITICAL(&metrics_mux);
+
+    uint32_t window_ms = (window_start_us == 0) ? 0 : (uint32_t)((now_us - window_start_us) / 1000);
+    window_start_us = now_us;
+
+    doc["uptime_ms"] = millis();
+    doc["window_ms"] = window_ms;
+    if (window_ms > 0) {
+        doc["fps"] = snapshot[METRIC_FRAME_INTERVAL_US].count * 1000.0f / window_ms;
+    }
+
+    JsonObject metrics = doc["metrics"].to<JsonObject>();
+    for (int i = 0; i < METRIC_COUNT; i++) {
+        const MetricHistogram *h = &snapshot[i];
+        if (h->count == 0) {
+            continue;
+        }
+        JsonObject m = metrics[METRIC_NAMES[i]].to<JsonObject>();
+        m["n"] = h->count;
+        m["min"] = h->min;
+        m["max"] = h->max;
+        m["mean"] = (uint32_t)(h->sum / h->count);
+        m["p50"] = percentile(h, 500);
+        m["p95"] = percentile(h, 950);
+        m["p99"] = percentile(h, 990);
+    }
+}
+
+void metrics_write_text(Print &out)
+{
+    // Separate from metrics_report()'s snapshot, this runs on the HTTP server task
+    static MetricHistogram snapshot[METRIC_COUNT];
+
+    int64_t now_us = esp_timer_get_time();
+    portENTER_CRITICAL(&metrics_mux);
+    memcpy(snapshot, histograms, sizeof(histograms));
+    portEXIT_CRITICAL(&metrics_mux);
+
+    uint32_t window_ms = (window_start_us == 0) ? 0 : (uint32_t)((now_us - window_start_us) / 1000);
+    out.print("# Current metrics window, reset by every report to the backend\n");
+    out.printf("hal_uptime_ms %lu\n", (unsigned long)millis());
+    out.printf("hal_window_ms %lu\n", (unsigned long)window_ms);
+
+    for (int i = 0; i < METRIC_COUNT; i++) {
+        const MetricHistogram *h = &snapshot[i];
+        const char *name = METRIC_NAMES[i];
+
+        out.printf("# TYPE hal_%s histogram\n", name);
+        uint64_t cumulative = 0;
+        for (int b = 0; b < METRICS_BUCKETS; b++) {
+            if (h->buckets[b] == 0) {
+                continue;
+            }
+            cumulative += h->buckets[b];
+            out.printf("hal_%s_bucket{le=\"%lu\"} %llu\n", name, (unsigned long)((2ULL << b) - 1),
+                       (unsigned long long)cumulative);
+        }
+        out.printf("hal_%s_bucket{le=\"+Inf\"} %lu\n", name, (unsigned long)h->count);
+        out.printf("hal_%s_sum %llu\n", name, (unsigned long long)h->sum);
+        out.printf("hal_%s_count %lu\n", name, (unsigned long)h->count);
+        if (h->count > 0) {
+            out.printf("hal_%s_min %lu\nhal_%s_max %lu\n", name, (unsigned long)h->min, name, (unsigned long)h->max);
+            out.printf("hal_%s_p50 %lu\nhal_%s_p95 %lu\nhal_%s_p99 %lu\n",
+                       name, (unsigned long)percentile(h, 500), name, (unsigned long)percentile(h, 950),
+                       name, (unsigned long)percentile(h, 990));
+        }
+    }
+}
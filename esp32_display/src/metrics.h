@@ -0,0 +1,68 @@
+/**
+ * On-device performance metrics
+ *
+ * Every metric is a fixed-size log2 histogram (count, min, max, sum and one
+ * bucket per power of two), so recording is a handful of integer ops under
+ * a spinlock and memory use never grows. The loop task periodically samples
+ * the gauges (RSSI, heap, stacks), snapshots and resets all histograms, and
+ * posts the window to the backend's /api/hal/metrics.
+ */
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stdint.h>
+#include <ArduinoJson.h>
+
+#define METRICS_BUCKETS     32      // Bucket i holds values in [2^i, 2^(i+1)), bucket 0 also holds 0
+
+enum MetricId {
+    METRIC_FRAME_INTERVAL_US,       // Time between completed LVGL frames, reported as FPS
+    METRIC_FLUSH_US,                // flush_callback duration
+    METRIC_LOCK_WAIT_US,            // Time spent waiting for the LVGL mutex
+    METRIC_LOCK_HOLD_US,            // Time the LVGL mutex is held (outermost lock only)
+    METRIC_JPEG_FETCH_MS,           // Face frame HTTP request until the body is read
+    METRIC_JPEG_DECODE_US,          // TJpgDec decode into the face canvas
+    METRIC_JPEG_BYTES,              // Face frame size
+    METRIC_FACE_AGE_MS,             // Camera capture until the backend received the frame request
+    METRIC_FACE_ENCODE_MS,          // Backend request handling (crop, resize, encode, red filter)
+    METRIC_FACE_TRANSFER_MS,        // Backend response sent until the body is read (synchronised clock)
+    METRIC_FACE_DECODE_US,          // Body read until decoded into the canvas, including the LVGL lock wait
+    METRIC_FACE_SCANOUT_US,         // Whole frame in the canvas (decoded, or blended in) until LVGL flushed it
+    METRIC_FACE_GLASS_MS,           // Camera capture until flushed to the panel, end to end, blend included
+    METRIC_FACE_SEQ_GAP,            // Camera frames skipped between two displayed face frames
+    METRIC_WIFI_RSSI_NEG_DBM,       // -RSSI, so it fits an unsigned histogram
+    METRIC_WIFI_CONNECT_MS,         // Link down (or boot) until connected again, per reconnect
+    METRIC_HEAP_INTERNAL_FREE,
+    METRIC_HEAP_PSRAM_FREE,
+    METRIC_HEAP_LARGEST_BLOCK,      // Largest free internal block
+    METRIC_STACK_LOOP_FREE,         // Stack high-water marks, in bytes
+    METRIC_STACK_LVGL_FREE,
+    METRIC_COUNT
+};
+
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t buckets[METRICS_BUCKETS];
+} MetricHistogram;
+
+// Record one value; safe from any task (not from ISRs)
+void metrics_record(MetricId id, uint32_t value);
+
+// Record the time since start_us (from esp_timer_get_time())
+void metrics_record_since_us(MetricId id, int64_t start_us);
+
+// Sample heap, RSSI and stack high-water gauges; call from the loop task
+void metrics_sample_gauges(void);
+
+// Snapshot and reset all histograms, writing the window summary into doc
+void metrics_report(JsonDocument &doc);
+
+// Write the current window as Prometheus-style text (histogram buckets plus min/max/percentile gauges)
+// without resetting it, for the on-device /metrics endpoint
+void metrics_write_text(Print &out);
+
+#endif // METRICS_H
@@ -0,0 +1,147 @@
+/**
+ * Cross-fade between display modes - see mode_transition.h
+ */
+
+#include <string.h>
+#include "mode_transition.h"
+#include "buffer_pool.h"
+#include "log_sink.h"
+#include "lvgl_v8_port.h"
+#include "pixel_blend.h"
+#include "trace.h"
+
+static lv_obj_t *screen = NULL;
+static lv_obj_t *overlay = NULL;
+static uint16_t *from_frame = NULL;         // The screen as the switch started
+static uint16_t *to_frame = NULL;           // Snapshot of the new mode, if it has no frame buffer
+static uint16_t *overlay_frame = NULL;
+static const uint16_t *to_pixels = NULL;    // to_frame or the new mode's own buffer
+static uint16_t width = 0;
+static uint16_t height = 0;
+
+// Visible disc, worked out for the screen size once
+static PixelSpan disc_spans[MODE_TRANSITION_MAX_ROWS];
+static uint16_t spans_width = 0;
+static uint16_t spans_height = 0;
+
+static size_t frame_bytes(void)
+{
+    return (size_t)width * height * sizeof(uint16_t);
+}
+
+// Render the screen's objects offscreen; the overlay must be hidden
+static bool snapshot(uint16_t *dst)
+{
+    lv_img_dsc_t dsc;
+    lv_obj_update_layout(screen);
+    return lv_snapshot_take_to_buf(screen, LV_IMG_CF_TRUE_COLOR, &dsc, dst, frame_bytes()) == LV_RES_OK;
+}
+
+// What is on the glass: a copy of the panel's frame buffer if it is CPU-visible and unrotated, otherwise a
+// snapshot (one extra render)
+static bool capture(uint16_t *dst)
+{
+#if LVGL_PORT_ROTATION_DEGREE == 0
+    uint16_t fb_width, fb_height;
+    const void *fb = lvgl_port_get_scanout_buffer(&fb_width, &fb_height);
+    if (fb != NULL && fb_width == width && fb_height == height) {
+        memcpy(dst, fb, frame_bytes());
+        return true;
+    }
+#endif
+    return snapshot(dst);
+}
+
+static void release(void)
+{
+    buffer_pool_give(from_frame);
+    buffer_pool_give(to_frame);
+    buffer_pool_give(overlay_frame);
+    from_frame = NULL;
+    to_frame = NULL;
+    overlay_frame = NULL;
+    to_pixels = NULL;
+}
+
+bool mode_transition_begin(lv_obj_t *parent)
+{
+    static_assert(sizeof(lv_color_t) == sizeof(uint16_t), "Transitions blend RGB565");
+    mode_transition_end();
+
+    screen = parent;
+    width = (uint16_t)lv_obj_get_width(parent);
+    height = (uint16_t)lv_obj_get_height(parent);
+    if (height > MODE_TRANSITION_MAX_ROWS || (width & 1)) {
+        return false;
+    }
+
+    from_frame = (uint16_t *)buffer_pool_take("fade_from", frame_bytes());
+    overlay_frame = (uint16_t *)buffer_pool_take("fade_overlay", frame_bytes());
+    if (from_frame == NULL || overlay_frame == NULL || !capture(from_frame)) {
+        LOG_EVERY_MS(10000, "No frames for a %ux%u fade, cutting", (unsigned)width, (unsigned)height);
+        release();
+        return false;
+    }
+    memcpy(overlay_frame, from_frame, frame_bytes());
+
+    if (spans_width != width || spans_height != height) {
+        pixel_disc_spans(disc_spans, width, height);
+        spans_width = width;
+        spans_height = height;
+    }
+
+    overlay = lv_canvas_create(parent);
+    lv_canvas_set_buffer(overlay, overlay_frame, width, height, LV_IMG_CF_TRUE_COLOR);
+    lv_obj_align(overlay, LV_ALIGN_CENTER, 0, 0);
+    return true;
+}
+
+bool mode_transition_target(const uint16_t *pixels)
+{
+    if (overlay == NULL) {
+        return false;
+    }
+
+    if (pixels == NULL) {
+        to_frame = (uint16_t *)buffer_pool_take("fade_to", frame_bytes());
+        if (to_frame == NULL) {
+            return false;
+        }
+        lv_obj_add_flag(overlay, LV_OBJ_FLAG_HIDDEN);
+        bool ok = snapshot(to_frame);
+        lv_obj_clear_flag(overlay, LV_OBJ_FLAG_HIDDEN);
+        if (!ok) {
+            return false;
+        }
+        pixels = to_frame;
+    }
+    to_pixels = pixels;
+
+    // Back on top of whatever the new mode created
+    lv_obj_move_foreground(overlay);
+    return true;
+}
+
+void mode_transition_draw(uint32_t alpha)
+{
+    if (overlay == NULL || to_pixels == NULL) {
+        return;
+    }
+    TRACE_SCOPE("fade_blend");
+    pixel_blend_disc(overlay_frame, from_frame, to_pixels, width, height, disc_spans, alpha);
+    lv_obj_invalidate(overlay);
+}
+
+void mode_transition_end(void)
+{
+    if (overlay != NULL) {
+        lv_obj_del(overlay);
+        overlay = NULL;
+    }
+    release();
+}
+
+bool mode_transition_active(void)
+{
+    return overlay != NULL;
+}
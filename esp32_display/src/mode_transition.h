@@ -0,0 +1,49 @@
+/**
+ * Cross-fade between display modes
+ *
+ * Without it a mode switch is a hard cut. mode_transition_begin() copies
+ * what the panel is showing and covers the screen with a full-screen canvas
+ * (the overlay) holding that copy, so the old mode can be torn down and the
+ * new one built underneath without anything changing on the glass.
+ * mode_transition_target() then picks the frame to fade to: one offscreen
+ * snapshot for modes drawn by LVGL objects (the eye), or the mode's own
+ * frame buffer, followed live, for modes that have one (the face). Every
+ * mode_transition_draw() blends the two into the overlay with the
+ * pixel_blend.h kernel, over the visible disc only.
+ *
+ * The overlay is the screen's topmost child and opaque, so LVGL draws
+ * nothing underneath it: a fade frame costs one blend and one canvas flush,
+ * whatever the modes' own objects would cost (the eye's nine translucent
+ * layers are not redrawn during a fade).
+ *
+ * The frames (three of 450 KB at 480x480) come from the buffer pool and go
+ * back at mode_transition_end(). Timing and pacing are up to the caller
+ * (display_mode.h). Call everything with the LVGL lock held.
+ */
+
+#ifndef MODE_TRANSITION_H
+#define MODE_TRANSITION_H
+
+#include <stdint.h>
+#include <lvgl.h>
+
+#define MODE_TRANSITION_MAX_ROWS    480     // Tallest screen the disc spans are kept for
+
+// Capture the screen and cover parent (the screen) with it. Returns false, with nothing taken, if the
+// frames or the capture are not available
+bool mode_transition_begin(lv_obj_t *parent);
+
+// Set the frame to fade to, once the new mode has been entered: pixels is a full-screen RGB565 buffer the
+// mode keeps drawing into, or NULL to snapshot the screen under the overlay now. False if that failed
+bool mode_transition_target(const uint16_t *pixels);
+
+// Show the blend of the two frames, alpha 0 (old) .. PIXEL_BLEND_ALPHA_MAX (new)
+void mode_transition_draw(uint32_t alpha);
+
+// Remove the overlay, uncovering the new mode, and give the frames back
+void mode_transition_end(void);
+
+// True between mode_transition_begin() and mode_transition_end()
+bool mode_transition_active(void);
+
+#endif // MODE_TRANSITION_H
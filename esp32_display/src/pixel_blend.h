@@ -0,0 +1,107 @@
+/**
+ * RGB565 blend kernels
+ *
+ * out = a + (b - a) * alpha / 32 per channel, for cross-fading one frame
+ * into another. Each pixel is spread as 0b00000gggggg00000rrrrr000000bbbbb
+ * so red, green and blue sit in one 32-bit word with room for the multiply,
+ * and all three channels blend with two multiplies (SWAR). Rows go two
+ * pixels per 32-bit load and store.
+ *
+ * Only the disc inscribed in the frame is blended - the panel is round, the
+ * corners are never seen. pixel_disc_spans() works out each row's span once.
+ *
+ * Free of LVGL so the benchmarks can time it on host and device.
+ */
+
+#ifndef PIXEL_BLEND_H
+#define PIXEL_BLEND_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define PIXEL_BLEND_ALPHA_MAX   32          // alpha is 0 (all a) .. 32 (all b)
+#define PIXEL_BLEND_SPREAD_MASK 0x07E0F81Fu
+
+typedef struct {
+    int16_t x0;                             // First pixel of the row inside the disc, even
+    int16_t x1;                             // One past the last, even unless it is the row width
+} PixelSpan;
+
+// Row spans of the disc inscribed in a w x h frame, widened to whole pixel pairs
+static inline void pixel_disc_spans(PixelSpan *spans, int w, int h)
+{
+    int d = w < h ? w : h;
+    // Doubled coordinates, so pixel centres are whole numbers
+    int64_t r2 = (int64_t)d * d;
+    for (int y = 0; y < h; y++) {
+        int64_t dy = 2 * y + 1 - h;
+        int64_t rest = r2 - dy * dy;
+        // Pixels either side of the centre line whose centres are inside the disc
+        int half = 0;
+        while (rest > 0 && (int64_t)(2 * half + 1) * (2 * half + 1) <= rest) {
+            half++;
+        }
+        int x0 = (w / 2 - half) & ~1;
+        int x1 = (w / 2 + half + 1) & ~1;
+        spans[y].x0 = (int16_t)(half == 0 ? 0 : x0 < 0 ? 0 : x0);
+        spans[y].x1 = (int16_t)(half == 0 ? 0 : x1 > w ? w : x1);
+    }
+}
+
+static inline uint32_t pixel_blend_spread(uint32_t p)
+{
+    return (p | (p << 16)) & PIXEL_BLEND_SPREAD_MASK;
+}
+
+// One pixel; alpha 0..PIXEL_BLEND_ALPHA_MAX
+static inline uint16_t pixel_blend_565(uint16_t a, uint16_t b, uint32_t alpha)
+{
+    uint32_t x = pixel_blend_spread(a) * (PIXEL_BLEND_ALPHA_MAX - alpha) + pixel_blend_spread(b) * alpha;
+    x = (x >> 5) & PIXEL_BLEND_SPREAD_MASK;
+    return (uint16_t)(x | (x >> 16));
+}
+
+// n pixels; dst may be a or b. Two pixels per word when all three rows are 4-byte aligned
+static inline void pixel_blend_row(uint16_t *dst, const uint16_t *a, const uint16_t *b, int n, uint32_t alpha)
+{
+    if (alpha == 0 || alpha >= PIXEL_BLEND_ALPHA_MAX) {
+        const uint16_t *from = alpha == 0 ? a : b;
+        if (from != dst) {
+            memcpy(dst, from, n * sizeof(uint16_t));
+        }
+        return;
+    }
+
+    int i = 0;
+    if ((((uintptr_t)dst | (uintptr_t)a | (uintptr_t)b) & 3) == 0) {
+        const uint32_t *a2 = (const uint32_t *)a;
+        const uint32_t *b2 = (const uint32_t *)b;
+        uint32_t *dst2 = (uint32_t *)dst;
+        for (; i + 1 < n; i += 2) {
+            uint32_t pa = *a2++;
+            uint32_t pb = *b2++;
+            uint32_t lo = pixel_blend_565((uint16_t)pa, (uint16_t)pb, alpha);
+            uint32_t hi = pixel_blend_565((uint16_t)(pa >> 16), (uint16_t)(pb >> 16), alpha);
+            *dst2++ = lo | (hi << 16);
+        }
+    }
+    for (; i < n; i++) {
+        dst[i] = pixel_blend_565(a[i], b[i], alpha);
+    }
+}
+
+// Blend the disc of two w-wide frames into dst; pixels outside the spans are left alone
+static inline void pixel_blend_disc(uint16_t *dst, const uint16_t *a, const uint16_t *b, int w, int h,
+                                    const PixelSpan *spans, uint32_t alpha)
+{
+    for (int y = 0; y < h; y++) {
+        int x0 = spans[y].x0;
+        int n = spans[y].x1 - x0;
+        if (n > 0) {
+            size_t offset = (size_t)y * w + x0;
+            pixel_blend_row(dst + offset, a + offset, b + offset, n, alpha);
+        }
+    }
+}
+
+#endif // PIXEL_BLEND_H
@@ -0,0 +1,219 @@
+/**
+ * CPU frequency and WiFi power-save management - see power_manager.h
+ */
+
+#include <WiFi.h>
+#include <esp32-hal-cpu.h>
+#include <esp_timer.h>
+#include "sdkconfig.h"
+#if CONFIG_PM_ENABLE
+#include <esp_pm.h>
+#endif
+#include "power_manager.h"
+#include "config.h"
+#include "log_sink.h"
+
+#define POWER_MAX_CPU_MHZ           240
+#define POWER_FREQ_COUNT            3       // 80, 160, 240 MHz
+
+static const uint32_t FREQS_MHZ[POWER_FREQ_COUNT] = { 80, 160, 240 };
+
+#if CONFIG_PM_ENABLE
+#define POWER_PM_BUILT_IN           true
+static esp_pm_lock_handle_t boost_lock = NULL;
+#else
+#define POWER_PM_BUILT_IN           false
+#endif
+
+// Shared by every task taking the boost lock, under power_mux
+static portMUX_TYPE power_mux = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t boost_depth = 0;
+static uint32_t min_mhz = POWER_MAX_CPU_MHZ;
+static uint32_t max_mhz = POWER_MAX_CPU_MHZ;
+static int64_t last_change_us = 0;
+static uint64_t us_at[POWER_FREQ_COUNT];
+
+// Loop task only
+static bool streaming = false;
+
+static uint32_t valid_mhz(uint32_t mhz)
+{
+    return mhz >= 240 ? 240 : mhz >= 160 ? 160 : 80;
+}
+
+static int freq_index(uint32_t mhz)
+{
+    return mhz >= 240 ? 2 : mhz >= 160 ? 1 : 0;
+}
+
+// Charge the time since the last transition to the frequency in effect until now. Call under power_mux
+static void account_locked(int64_t now_us)
+{
+#if CONFIG_PM_ENABLE
+    uint32_t mhz = boost_depth > 0 ? max_mhz : min_mhz;
+#else
+    uint32_t mhz = max_mhz;
+#endif
+    us_at[freq_index(mhz)] += now_us - last_change_us;
+    last_change_us = now_us;
+}
+
+// Without the boost lock there is nothing to scale up for, so the CPU stays at the ceiling
+static uint32_t floor_mhz(uint32_t ceiling)
+{
+#if CONFIG_PM_ENABLE
+    if (boost_lock != NULL) {
+        return config_get(CONFIG_CPU_MIN_MHZ);
+    }
+#endif
+    return ceiling;
+}
+
+static void configure(uint32_t new_max)
+{
+    new_max = valid_mhz(new_max);
+    uint32_t new_min = valid_mhz(floor_mhz(new_max));
+    if (new_min > new_max) {
+        new_min = new_max;
+    }
+    if (new_min == min_mhz && new_max == max_mhz) {
+        return;
+    }
+
+#if CONFIG_PM_ENABLE
+    esp_pm_config_esp32s3_t pm_config = {
+        .max_freq_mhz = (int)new_max,
+        .min_freq_mhz = (int)new_min,
+        .light_sleep_enable = false,    // The panel scans out continuously
+    };
+    if (esp_pm_configure(&pm_config) != ESP_OK) {
+        LOG("CPU range %lu..%lu MHz rejected", (unsigned long)new_min, (unsigned long)new_max);
+        return;
+    }
+#else
+    if (new_max != max_mhz && !setCpuFrequencyMhz(new_max)) {
+        LOG("CPU frequency %lu MHz rejected", (unsigned long)new_max);
+        return;
+    }
+#endif
+
+    portENTER_CRITICAL(&power_mux);
+    account_locked(esp_timer_get_time());
+    min_mhz = new_min;
+    max_mhz = new_max;
+    portEXIT_CRITICAL(&power_mux);
+}
+
+void power_manager_init(void)
+{
+#if CONFIG_PM_ENABLE
+    if (esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "boost", &boost_lock) != ESP_OK) {
+        LOG("PM lock create failed, CPU stays at the ceiling");
+    }
+#endif
+    max_mhz = valid_mhz(getCpuFrequencyMhz());
+    min_mhz = max_mhz;
+    last_change_us = esp_timer_get_time();
+    power_manager_apply();
+}
+
+void power_boost_acquire(void)
+{
+#if CONFIG_PM_ENABLE
+    if (boost_lock == NULL) {
+        return;
+    }
+    // Account before raising the clock so the time up to now stays at the lower frequency
+    portENTER_CRITICAL(&power_mux);
+    if (boost_depth++ == 0) {
+        account_locked(esp_timer_get_time());
+    }
+    portEXIT_CRITICAL(&power_mux);
+    esp_pm_lock_acquire(boost_lock);
+#endif
+}
+
+void power_boost_release(void)
+{
+#if CONFIG_PM_ENABLE
+    if (boost_lock == NULL) {
+        return;
+    }
+    esp_pm_lock_release(boost_lock);
+    portENTER_CRITICAL(&power_mux);
+    if (--boost_depth == 0) {
+        account_locked(esp_timer_get_time());
+    }
+    portEXIT_CRITICAL(&power_mux);
+#endif
+}
+
+void power_manager_set_max_mhz(uint32_t mhz)
+{
+    configure(mhz);
+}
+
+uint32_t power_manager_max_mhz(void)
+{
+    return max_mhz;
+}
+
+void power_manager_apply(void)
+{
+    configure(max_mhz);
+}
+
+void power_manager_set_streaming(bool active)
+{
+    if (active == streaming) {
+        return;
+    }
+    streaming = active;
+    if (active) {
+        power_boost_acquire();
+    } else {
+        power_boost_release();
+    }
+    // Modem sleep adds up to a DTIM interval of latency to every received frame
+    WiFi.setSleep(!active);
+}
+
+void power_manager_report(JsonDocument &doc)
+{
+    uint64_t snapshot[POWER_FREQ_COUNT];
+    portENTER_CRITICAL(&power_mux);
+    account_locked(esp_timer_get_time());
+    memcpy(snapshot, us_at, sizeof(snapshot));
+    uint32_t lo = min_mhz;
+    uint32_t hi = max_mhz;
+    portEXIT_CRITICAL(&power_mux);
+
+    JsonObject cpu = doc["cpu"].to<JsonObject>();
+    cpu["pm"] = POWER_PM_BUILT_IN;
+    cpu["min_mhz"] = lo;
+    cpu["max_mhz"] = hi;
+    cpu["wifi_ps"] = !streaming;
+    JsonObject at = cpu["ms_at_mhz"].to<JsonObject>();
+    for (int i = 0; i < POWER_FREQ_COUNT; i++) {
+        at[String(FREQS_MHZ[i])] = (uint32_t)(snapshot[i] / 1000);
+    }
+}
+
+void power_manager_write_text(Print &out)
+{
+    uint64_t snapshot[POWER_FREQ_COUNT];
+    portENTER_CRITICAL(&power_mux);
+    account_locked(esp_timer_get_time());
+    memcpy(snapshot, us_at, sizeof(snapshot));
+    uint32_t lo = min_mhz;
+    uint32_t hi = max_mhz;
+    portEXIT_CRITICAL(&power_mux);
+
+    for (int i = 0; i < POWER_FREQ_COUNT; i++) {
+        out.printf("hal_cpu_seconds_total{mhz=\"%lu\"} %.3f\n", (unsigned long)FREQS_MHZ[i],
+                   (double)snapshot[i] / 1000000.0);
+    }
+    out.printf("hal_cpu_min_mhz %lu\n", (unsigned long)lo);
+    out.printf("hal_cpu_max_mhz %lu\n", (unsigned long)hi);
+    out.printf("hal_wifi_power_save %d\n", streaming ? 0 : 1);
+}
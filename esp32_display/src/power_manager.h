@@ -0,0 +1,57 @@
+/**
+ * CPU frequency and WiFi power-save management
+ *
+ * With power management built in (CONFIG_PM_ENABLE), the CPU runs at
+ * cpu_min_mhz (config.h, 80 MHz by default) whenever nothing needs it and
+ * jumps to the ceiling for bursts of work:
+ *  - the LVGL task holds the boost lock while it renders and flushes,
+ *  - JPEG decodes take it around TJpgDec,
+ *  - a face stream holds it for as long as it is active.
+ * In eye mode the CPU therefore drops to the minimum between frames. The
+ * RGB panel driver keeps APB at 80 MHz on its own, so scanout from PSRAM is
+ * unaffected by the CPU clock. The ceiling is 240 MHz (board_build.f_cpu),
+ * lowered by the idle governor while the room is empty.
+ *
+ * WiFi modem sleep stays on except while a face stream is active, when the
+ * radio has to keep up with five or more frames a second.
+ *
+ * Time is charged to the frequency this layer asks for (the ceiling while
+ * the boost lock is held, the minimum otherwise) at every transition, so
+ * the report shows how long the CPU spent at each clock.
+ *
+ * Without CONFIG_PM_ENABLE the locks are no-ops and the CPU runs at the
+ * ceiling, set with setCpuFrequencyMhz().
+ */
+
+#ifndef POWER_MANAGER_H
+#define POWER_MANAGER_H
+
+#include <stdint.h>
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// Create the lock and apply the configured frequency range. Call once early in setup
+void power_manager_init(void);
+
+// Hold the CPU at the ceiling until the matching release; nests, any task
+void power_boost_acquire(void);
+void power_boost_release(void);
+
+// Ceiling for boosts (80, 160 or 240 MHz, rounded down); used by the idle governor
+void power_manager_set_max_mhz(uint32_t mhz);
+uint32_t power_manager_max_mhz(void);
+
+// Re-apply cpu_min_mhz after it changed
+void power_manager_apply(void);
+
+// A face stream started or stopped: keeps the CPU boosted and WiFi modem sleep off while active.
+// Call from the loop
+void power_manager_set_streaming(bool streaming);
+
+// Add {"cpu": {"pm", "min_mhz", "max_mhz", "wifi_ps", "ms_at_mhz": {...}}} to doc
+void power_manager_report(JsonDocument &doc);
+
+// Write the same as Prometheus-style text for the diagnostics server
+void power_manager_write_text(Print &out);
+
+#endif // POWER_MANAGER_H
@@ -0,0 +1,169 @@
+/**
+ * Streaming frame buffer encoders - see snapshot_encoder.h
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "snapshot_encoder.h"
+
+#define RLE_PAIRS_PER_WRITE     256
+
+/* PNG */
+
+static uint32_t crc_table[256];
+
+static void crc_table_init(void)
+{
+    if (crc_table[1] != 0) {
+        return;
+    }
+    for (uint32_t n = 0; n < 256; n++) {
+        uint32_t c = n;
+        for (int k = 0; k < 8; k++) {
+            c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        }
+        crc_table[n] = c;
+    }
+}
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t len)
+{
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++) {
+        crc = crc_table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+static uint32_t adler32_update(uint32_t adler, const uint8_t *data, size_t len)
+{
+    uint32_t a = adler & 0xFFFF;
+    uint32_t b = adler >> 16;
+    while (len > 0) {
+        // 5552 is the longest run before b can overflow 32 bits
+        size_t n = (len < 5552) ? len : 5552;
+        len -= n;
+        while (n--) {
+            a += *data++;
+            b += a;
+        }
+        a %= 65521;
+        b %= 65521;
+    }
+    return (b << 16) | a;
+}
+
+static void put_be32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+// Wrap data_len bytes already at chunk + 8 into a complete chunk (length, type, data, CRC)
+static bool write_chunk(uint8_t *chunk, const char *type, size_t data_len, snapshot_write_t write, void *ctx)
+{
+    put_be32(chunk, (uint32_t)data_len);
+    memcpy(chunk + 4, type, 4);
+    put_be32(chunk + 8 + data_len, crc32_update(0, chunk + 4, data_len + 4));
+    return write(ctx, chunk, data_len + 12);
+}
+
+bool snapshot_write_png(const uint16_t *pixels, uint16_t width, uint16_t height, snapshot_write_t write, void *ctx)
+{
+    static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    const size_t row_bytes = 1 + (size_t)width * 3;         // Filter byte + RGB
+    const size_t block_bytes = 5 + row_bytes;               // Stored deflate block header + row
+
+    crc_table_init();
+    uint8_t *chunk = (uint8_t *)malloc(8 + ((block_bytes > 13) ? block_bytes : 13) + 4);
+    if (chunk == NULL) {
+        return false;
+    }
+    uint8_t *data = chunk + 8;
+
+    // IHDR: 8-bit RGB, no interlace
+    bool ok = write(ctx, signature, sizeof(signature));
+    put_be32(data, width);
+    put_be32(data + 4, height);
+    data[8] = 8;
+    data[9] = 2;
+    data[10] = data[11] = data[12] = 0;
+    ok = ok && write_chunk(chunk, "IHDR", 13, write, ctx);
+
+    // zlib header: deflate, 32K window, no preset dictionary, check bits for 0x78
+    data[0] = 0x78;
+    data[1] = 0x01;
+    ok = ok && write_chunk(chunk, "IDAT", 2, write, ctx);
+
+    uint32_t adler = 1;
+    for (uint16_t y = 0; ok && y < height; y++) {
+        uint8_t *block = data;
+        block[0] = (y + 1 == height) ? 1 : 0;               // BFINAL on the last row, BTYPE 00 (stored)
+        block[1] = (uint8_t)row_bytes;
+        block[2] = (uint8_t)(row_bytes >> 8);
+        block[3] = (uint8_t)~row_bytes;
+        block[4] = (uint8_t)(~row_bytes >> 8);
+
+        uint8_t *row = block + 5;
+        const uint16_t *src = pixels + (size_t)y * width;
+        row[0] = 0;                                         // Filter: none
+        for (uint16_t x = 0; x < width; x++) {
+            // Expand RGB565 to 8 bits per channel, replicating the high bits
+            uint16_t c = src[x];
+            uint8_t r = (c >> 11) & 0x1F;
+            uint8_t g = (c >> 5) & 0x3F;
+            uint8_t b = c & 0x1F;
+            row[1 + x * 3 + 0] = (r << 3) | (r >> 2);
+            row[1 + x * 3 + 1] = (g << 2) | (g >> 4);
+            row[1 + x * 3 + 2] = (b << 3) | (b >> 2);
+        }
+        adler = adler32_update(adler, row, row_bytes);
+        ok = write_chunk(chunk, "IDAT", block_bytes, write, ctx);
+    }
+
+    put_be32(data, adler);
+    ok = ok && write_chunk(chunk, "IDAT", 4, write, ctx);
+    ok = ok && write_chunk(chunk, "IEND", 0, write, ctx);
+
+    free(chunk);
+    return ok;
+}
+
+/* RLE565 */
+
+bool snapshot_write_rle565(const uint16_t *pixels, uint16_t width, uint16_t height, snapshot_write_t write, void *ctx)
+{
+    uint8_t out[RLE_PAIRS_PER_WRITE * 4];
+    int len = snprintf((char *)out, sizeof(out), "RLE565\n%u %u\n", (unsigned)width, (unsigned)height);
+    if (!write(ctx, out, len)) {
+        return false;
+    }
+
+    const size_t total = (size_t)width * height;
+    size_t pairs = 0;
+    size_t i = 0;
+    while (i < total) {
+        uint16_t colour = pixels[i];
+        size_t run = 1;
+        while (i + run < total && run < 0xFFFF && pixels[i + run] == colour) {
+            run++;
+        }
+        uint8_t *pair = out + pairs * 4;
+        pair[0] = (uint8_t)run;
+        pair[1] = (uint8_t)(run >> 8);
+        pair[2] = (uint8_t)colour;
+        pair[3] = (uint8_t)(colour >> 8);
+        i += run;
+
+        if (++pairs == RLE_PAIRS_PER_WRITE) {
+            if (!write(ctx, out, sizeof(out))) {
+                return false;
+            }
+            pairs = 0;
+        }
+    }
+    return pairs == 0 || write(ctx, out, pairs * 4);
+}
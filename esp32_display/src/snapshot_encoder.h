@@ -0,0 +1,32 @@
+/**
+ * Streaming frame buffer encoders for /snapshot
+ *
+ * Both encoders walk an RGB565 frame buffer one row at a time and hand the
+ * output to a write callback, so a snapshot needs one row of scratch memory
+ * and never a copy of the frame.
+ *
+ *  - PNG: 24-bit RGB in zlib "stored" (uncompressed) deflate blocks, one
+ *    block and IDAT chunk per row. No compressor state, opens anywhere.
+ *  - RLE565: the run-length format of the golden-image tests,
+ *    "RLE565\n<w> <h>\n" then little-endian (uint16 run, uint16 colour)
+ *    pairs in row-major order. Flat eye frames shrink 20x or more.
+ *
+ * Plain C++ with no platform dependencies, so the host build can check it.
+ */
+
+#ifndef SNAPSHOT_ENCODER_H
+#define SNAPSHOT_ENCODER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Receives the next piece of the encoded image; return false to abort
+typedef bool (*snapshot_write_t)(void *ctx, const uint8_t *data, size_t len);
+
+// Encode width x height RGB565 pixels (row stride = width) as PNG; false on a write or allocation failure
+bool snapshot_write_png(const uint16_t *pixels, uint16_t width, uint16_t height, snapshot_write_t write, void *ctx);
+
+// Encode width x height RGB565 pixels as RLE565; false on a write failure
+bool snapshot_write_rle565(const uint16_t *pixels, uint16_t width, uint16_t height, snapshot_write_t write, void *ctx);
+
+#endif // SNAPSHOT_ENCODER_H
@@ -0,0 +1,58 @@
+/**
+ * Boot splash - see splash.h
+ */
+
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include "splash.h"
+#include "splash_frame.h"
+
+#define SPLASH_BAND_ROWS    16      // Rows decoded per drawBitmap() call
+
+bool splash_draw(esp_panel::drivers::LCD *lcd)
+{
+    int lcd_width = lcd->getFrameWidth();
+    int lcd_height = lcd->getFrameHeight();
+    if (lcd_width < SPLASH_WIDTH || lcd_height < SPLASH_HEIGHT) {
+        return false;
+    }
+    int x0 = (lcd_width - SPLASH_WIDTH) / 2;
+    int y0 = (lcd_height - SPLASH_HEIGHT) / 2;
+
+    // Decode one band of rows at a time into internal RAM, so the flash data never needs a full-frame copy
+    uint16_t *band = (uint16_t *)heap_caps_malloc(SPLASH_WIDTH * SPLASH_BAND_ROWS * sizeof(uint16_t),
+                                                  MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (band == NULL) {
+        return false;
+    }
+
+    bool ok = true;
+    size_t run_index = 0;
+    uint32_t run_left = 0;
+    uint16_t colour = 0;
+    for (int y = 0; ok && y < SPLASH_HEIGHT; y += SPLASH_BAND_ROWS) {
+        int rows = min(SPLASH_BAND_ROWS, SPLASH_HEIGHT - y);
+        size_t count = (size_t)rows * SPLASH_WIDTH;
+        size_t filled = 0;
+        while (filled < count) {
+            if (run_left == 0) {
+                if (run_index >= SPLASH_RUN_COUNT) {
+                    break;
+                }
+                run_left = SPLASH_RUNS[run_index * 2];
+                colour = SPLASH_RUNS[run_index * 2 + 1];
+                run_index++;
+            }
+            size_t n = min((size_t)run_left, count - filled);
+            for (size_t i = 0; i < n; i++) {
+                band[filled + i] = colour;
+            }
+            filled += n;
+            run_left -= n;
+        }
+        ok = (filled == count) && lcd->drawBitmap(x0, y0 + y, SPLASH_WIDTH, rows, (const uint8_t *)band);
+    }
+
+    heap_caps_free(band);
+    return ok;
+}
@@ -0,0 +1,18 @@
+/**
+ * Boot splash
+ *
+ * Draws the flash-resident eye frame from splash_frame.h (generated by
+ * tools/gen_splash.py) straight to the panel, before LVGL, WiFi or anything
+ * else is up, so the display shows HAL within a few hundred milliseconds of
+ * reset. LVGL's first full refresh then replaces it with the live eye.
+ */
+
+#ifndef SPLASH_H
+#define SPLASH_H
+
+#include <esp_display_panel.hpp>
+
+// Blit the splash centred on lcd; call once board->begin() has returned
+bool splash_draw(esp_panel::drivers::LCD *lcd);
+
+#endif // SPLASH_H
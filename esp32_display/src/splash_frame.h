@@ -0,0 +1,1117 @@
+/**
+ * Boot splash frame - generated by tools/gen_splash.py, do not edit
+ *
+ * Source: synthetic idle eye at pulse phase 0
+ * 480x480 RGB565 as 6581 (run, colour) pairs, 26324 bytes of flash
+ */
+
+#ifndef SPLASH_FRAME_H
+#define SPLASH_FRAME_H
+
+#include <stdint.h>
+
+#define SPLASH_WIDTH        480
+#define SPLASH_HEIGHT       480
+#define SPLASH_RUN_COUNT    6581
+
+static const uint16_t SPLASH_RUNS[SPLASH_RUN_COUNT * 2] = {
+    38624, 0x0000, 2, 0x0800, 3, 0x1000, 5, 0x1800, 12, 0x2000, 5, 0x1800,
+    3, 0x1000, 2, 0x0800, 440, 0x0000, 2, 0x0800, 1, 0x1000, 2, 0x1800,
+    38, 0x2000, 2, 0x1800, 1, 0x1000, 2, 0x0800, 426, 0x0000, 2, 0x0800,
+    1, 0x1000, 1, 0x1800, 52, 0x2000, 1, 0x1800, 1, 0x1000, 2, 0x0800,
+    415, 0x0000, 2, 0x0800, 1, 0x1000, 1, 0x1800, 62, 0x2000, 1, 0x1800,
+    1, 0x1000, 2, 0x0800, 406, 0x0000, 1, 0x0800, 1, 0x1000, 1, 0x1800,
+    72, 0x2000, 1, 0x1800, 1, 0x1000, 1, 0x0800, 398, 0x0000, 1, 0x0800,
+    1, 0x1000, 1, 0x1800, 80, 0x2000, 1, 0x1800, 1, 0x1000, 1, 0x0800,
+    391, 0x0000, 1, 0x0800, 1, 0x1000, 1, 0x1800, 86, 0x2000, 1, 0x1800,
+    1, 0x1000, 1, 0x0800, 385, 0x0000, 1, 0x0800, 1, 0x1800, 94, 0x2000,
+    1, 0x1800, 1, 0x0800, 379, 0x0000, 1, 0x0800, 1, 0x1800, 100, 0x2000,
+    1, 0x1800, 1, 0x0800, 373, 0x0000, 1, 0x0800, 1, 0x1800, 106, 0x2000,
+    1, 0x1800, 1, 0x0800, 367, 0x0000, 1, 0x0800, 1, 0x1000, 112, 0x2000,
+    1, 0x1000, 1, 0x0800, 362, 0x0000, 1, 0x1000, 1, 0x1800, 116, 0x2000,
+    1, 0x1800, 1, 0x1000, 357, 0x0000, 1, 0x0800, 1, 0x1000, 122, 0x2000,
+    1, 0x1000, 1, 0x0800, 352, 0x0000, 1, 0x0800, 1, 0x1800, 126, 0x2000,
+    1, 0x1800, 1, 0x0800, 348, 0x0000, 1, 0x1000, 1, 0x1800, 130, 0x2000,
+    1, 0x1800, 1, 0x1000, 344, 0x0000, 1, 0x1000, 136, 0x2000, 1, 0x1000,
+    340, 0x0000, 1, 0x1000, 140, 0x2000, 1, 0x1000, 336, 0x0000, 1, 0x1000,
+    144, 0x2000, 1, 0x1000, 332, 0x0000, 1, 0x1000, 148, 0x2000, 1, 0x1000,
+    328, 0x0000, 1, 0x1000, 1, 0x1800, 150, 0x2000, 1, 0x1800, 1, 0x1000,
+    324, 0x0000, 1, 0x0800, 1, 0x1800, 154, 0x2000, 1, 0x1800, 1, 0x0800,
+    320, 0x0000, 1, 0x0800, 1, 0x1800, 158, 0x2000, 1, 0x1800, 1, 0x0800,
+    317, 0x0000, 1, 0x1000, 162, 0x2000, 1, 0x1000, 314, 0x0000, 1, 0x1000,
+    1, 0x1800, 164, 0x2000, 1, 0x1800, 1, 0x1000, 310, 0x0000, 1, 0x0800,
+    1, 0x1800, 168, 0x2000, 1, 0x1800, 1, 0x0800, 307, 0x0000, 1, 0x1000,
+    172, 0x2000, 1, 0x1000, 304, 0x0000, 1, 0x0800, 1, 0x1800, 174, 0x2000,
+    1, 0x1800, 1, 0x0800, 301, 0x0000, 1, 0x1000, 178, 0x2000, 1, 0x1000,
+    298, 0x0000, 1, 0x0800, 1, 0x1800, 180, 0x2000, 1, 0x1800, 1, 0x0800,
+    295, 0x0000, 1, 0x1000, 184, 0x2000, 1, 0x1000, 293, 0x0000, 1, 0x1800,
+    80, 0x2000, 3, 0x2800, 5, 0x3000, 10, 0x3800, 5, 0x3000, 3, 0x2800,
+    80, 0x2000, 1, 0x1800, 290, 0x0000, 1, 0x0800, 1, 0x1800, 73, 0x2000,
+    2, 0x2800, 2, 0x3000, 34, 0x3800, 2, 0x3000, 2, 0x2800, 73, 0x2000,
+    1, 0x1800, 1, 0x0800, 287, 0x0000, 1, 0x1000, 70, 0x2000, 1, 0x2800,
+    2, 0x3000, 46, 0x3800, 2, 0x3000, 1, 0x2800, 70, 0x2000, 1, 0x1000,
+    285, 0x0000, 1, 0x1800, 66, 0x2000, 2, 0x2800, 1, 0x3000, 56, 0x3800,
+    1, 0x3000, 2, 0x2800, 66, 0x2000, 1, 0x1800, 282, 0x0000, 1, 0x0800,
+    1, 0x1800, 64, 0x2000, 1, 0x2800, 1, 0x3000, 64, 0x3800, 1, 0x3000,
+    1, 0x2800, 64, 0x2000, 1, 0x1800, 1, 0x0800, 279, 0x0000, 1, 0x1000,
+    62, 0x2000, 1, 0x2800, 1, 0x3000, 72, 0x3800, 1, 0x3000, 1, 0x2800,
+    62, 0x2000, 1, 0x1000, 277, 0x0000, 1, 0x1000, 60, 0x2000, 1, 0x2800,
+    1, 0x3000, 78, 0x3800, 1, 0x3000, 1, 0x2800, 60, 0x2000, 1, 0x1000,
+    275, 0x0000, 1, 0x1800, 58, 0x2000, 1, 0x2800, 1, 0x3000, 84, 0x3800,
+    1, 0x3000, 1, 0x2800, 58, 0x2000, 1, 0x1800, 273, 0x0000, 1, 0x1800,
+    56, 0x2000, 1, 0x2800, 1, 0x3000, 90, 0x3800, 1, 0x3000, 1, 0x2800,
+    56, 0x2000, 1, 0x1800, 270, 0x0000, 1, 0x0800, 1, 0x1800, 55, 0x2000,
+    1, 0x2800, 1, 0x3000, 94, 0x3800, 1, 0x3000, 1, 0x2800, 55, 0x2000,
+    1, 0x1800, 1, 0x0800, 267, 0x0000, 1, 0x0800, 54, 0x2000, 1, 0x2800,
+    1, 0x3000, 100, 0x3800, 1, 0x3000, 1, 0x2800, 54, 0x2000, 1, 0x0800,
+    265, 0x0000, 1, 0x1000, 53, 0x2000, 1, 0x2800, 1, 0x3000, 104, 0x3800,
+    1, 0x3000, 1, 0x2800, 53, 0x2000, 1, 0x1000, 263, 0x0000, 1, 0x1000,
+    52, 0x2000, 1, 0x2800, 1, 0x3000, 42, 0x3800, 3, 0x4000, 4, 0x4800,
+    10, 0x5000, 4, 0x4800, 3, 0x4000, 42, 0x3800, 1, 0x3000, 1, 0x2800,
+    52, 0x2000, 1, 0x1000, 261, 0x0000, 1, 0x1000, 51, 0x2000, 1, 0x2800,
+    37, 0x3800, 2, 0x4000, 2, 0x4800, 32, 0x5000, 2, 0x4800, 2, 0x4000,
+    37, 0x3800, 1, 0x2800, 51, 0x2000, 1, 0x1000, 259, 0x0000, 1, 0x1000,
+    50, 0x2000, 1, 0x2800, 34, 0x3800, 2, 0x4000, 1, 0x4800, 44, 0x5000,
+    1, 0x4800, 2, 0x4000, 34, 0x3800, 1, 0x2800, 50, 0x2000, 1, 0x1000,
+    257, 0x0000, 1, 0x1800, 49, 0x2000, 1, 0x2800, 1, 0x3000, 31, 0x3800,
+    1, 0x4000, 1, 0x4800, 54, 0x5000, 1, 0x4800, 1, 0x4000, 31, 0x3800,
+    1, 0x3000, 1, 0x2800, 49, 0x2000, 1, 0x1800, 255, 0x0000, 1, 0x1800,
+    48, 0x2000, 1, 0x2800, 1, 0x3000, 29, 0x3800, 1, 0x4000, 1, 0x4800,
+    62, 0x5000, 1, 0x4800, 1, 0x4000, 29, 0x3800, 1, 0x3000, 1, 0x2800,
+    48, 0x2000, 1, 0x1800, 253, 0x0000, 1, 0x1800, 48, 0x2000, 1, 0x3000,
+    28, 0x3800, 1, 0x4000, 1, 0x4800, 68, 0x5000, 1, 0x4800, 1, 0x4000,
+    28, 0x3800, 1, 0x3000, 48, 0x2000, 1, 0x1800, 251, 0x0000, 1, 0x1800,
+    47, 0x2000, 1, 0x3000, 27, 0x3800, 1, 0x4000, 1, 0x4800, 74, 0x5000,
+    1, 0x4800, 1, 0x4000, 27, 0x3800, 1, 0x3000, 47, 0x2000, 1, 0x1800,
+    249, 0x0000, 1, 0x1000, 46, 0x2000, 1, 0x2800, 1, 0x3000, 25, 0x3800,
+    1, 0x4000, 1, 0x4800, 80, 0x5000, 1, 0x4800, 1, 0x4000, 25, 0x3800,
+    1, 0x3000, 1, 0x2800, 46, 0x2000, 1, 0x1000, 247, 0x0000, 1, 0x1000,
+    46, 0x2000, 1, 0x3000, 25, 0x3800, 1, 0x4800, 86, 0x5000, 1, 0x4800,
+    25, 0x3800, 1, 0x3000, 46, 0x2000, 1, 0x1000, 245, 0x0000, 1, 0x1000,
+    45, 0x2000, 1, 0x2800, 24, 0x3800, 1, 0x4000, 1, 0x4800, 90, 0x5000,
+    1, 0x4800, 1, 0x4000, 24, 0x3800, 1, 0x2800, 45, 0x2000, 1, 0x1000,
+    243, 0x0000, 1, 0x1000, 45, 0x2000, 1, 0x3000, 23, 0x3800, 1, 0x4000,
+    1, 0x4800, 94, 0x5000, 1, 0x4800, 1, 0x4000, 23, 0x3800, 1, 0x3000,
+    45, 0x2000, 1, 0x1000, 241, 0x0000, 1, 0x0800, 44, 0x2000, 1, 0x2800,
+    23, 0x3800, 1, 0x4000, 100, 0x5000, 1, 0x4000, 23, 0x3800, 1, 0x2800,
+    44, 0x2000, 1, 0x0800, 239, 0x0000, 1, 0x0800, 44, 0x2000, 1, 0x3000,
+    22, 0x3800, 1, 0x4000, 104, 0x5000, 1, 0x4000, 22, 0x3800, 1, 0x3000,
+    44, 0x2000, 1, 0x0800, 238, 0x0000, 1, 0x1800, 42, 0x2000, 1, 0x2800,
+    1, 0x3000, 21, 0x3800, 1, 0x4000, 41, 0x5000, 2, 0x5800, 2, 0x6000,
+    4, 0x6800, 10, 0x7800, 4, 0x6800, 2, 0x6000, 2, 0x5800, 41, 0x5000,
+    1, 0x4000, 21, 0x3800, 1, 0x3000, 1, 0x2800, 42, 0x2000, 1, 0x1800,
+    237, 0x0000, 1, 0x1800, 42, 0x2000, 1, 0x2800, 21, 0x3800, 1, 0x4000,
+    37, 0x5000, 1, 0x5800, 1, 0x6000, 1, 0x6800, 1, 0x7000, 30, 0x7800,
+    1, 0x7000, 1, 0x6800, 1, 0x6000, 1, 0x5800, 37, 0x5000, 1, 0x4000,
+    21, 0x3800, 1, 0x2800, 42, 0x2000, 1, 0x1800, 235, 0x0000, 1, 0x1800,
+    42, 0x2000, 1, 0x3000, 20, 0x3800, 1, 0x4000, 1, 0x4800, 33, 0x5000,
+    1, 0x5800, 1, 0x6000, 1, 0x6800, 42, 0x7800, 1, 0x6800, 1, 0x6000,
+    1, 0x5800, 33, 0x5000, 1, 0x4800, 1, 0x4000, 20, 0x3800, 1, 0x3000,
+    42, 0x2000, 1, 0x1800, 233, 0x0000, 1, 0x1000, 42, 0x2000, 1, 0x3000,
+    20, 0x3800, 1, 0x4800, 31, 0x5000, 1, 0x5800, 1, 0x6800, 1, 0x7000,
+    50, 0x7800, 1, 0x7000, 1, 0x6800, 1, 0x5800, 31, 0x5000, 1, 0x4800,
+    20, 0x3800, 1, 0x3000, 42, 0x2000, 1, 0x1000, 231, 0x0000, 1, 0x1000,
+    41, 0x2000, 1, 0x2800, 20, 0x3800, 1, 0x4800, 30, 0x5000, 1, 0x6000,
+    1, 0x7000, 58, 0x7800, 1, 0x7000, 1, 0x6000, 30, 0x5000, 1, 0x4800,
+    20, 0x3800, 1, 0x2800, 41, 0x2000, 1, 0x1000, 229, 0x0000, 1, 0x0800,
+    41, 0x2000, 1, 0x2800, 19, 0x3800, 1, 0x4000, 1, 0x4800, 28, 0x5000,
+    1, 0x6000, 1, 0x7000, 64, 0x7800, 1, 0x7000, 1, 0x6000, 28, 0x5000,
+    1, 0x4800, 1, 0x4000, 19, 0x3800, 1, 0x2800, 41, 0x2000, 1, 0x0800,
+    228, 0x0000, 1, 0x1800, 40, 0x2000, 1, 0x3000, 19, 0x3800, 1, 0x4800,
+    27, 0x5000, 1, 0x6000, 1, 0x7000, 70, 0x7800, 1, 0x7000, 1, 0x6000,
+    27, 0x5000, 1, 0x4800, 19, 0x3800, 1, 0x3000, 40, 0x2000, 1, 0x1800,
+    227, 0x0000, 1, 0x1800, 40, 0x2000, 1, 0x3000, 18, 0x3800, 1, 0x4000,
+    26, 0x5000, 1, 0x5800, 1, 0x6800, 76, 0x7800, 1, 0x6800, 1, 0x5800,
+    26, 0x5000, 1, 0x4000, 18, 0x3800, 1, 0x3000, 40, 0x2000, 1, 0x1800,
+    225, 0x0000, 1, 0x1000, 40, 0x2000, 1, 0x3000, 18, 0x3800, 1, 0x4800,
+    25, 0x5000, 1, 0x6000, 1, 0x7000, 80, 0x7800, 1, 0x7000, 1, 0x6000,
+    25, 0x5000, 1, 0x4800, 18, 0x3800, 1, 0x3000, 40, 0x2000, 1, 0x1000,
+    223, 0x0000, 1, 0x0800, 40, 0x2000, 1, 0x3000, 17, 0x3800, 1, 0x4000,
+    1, 0x4800, 24, 0x5000, 1, 0x6000, 1, 0x7000, 84, 0x7800, 1, 0x7000,
+    1, 0x6000, 24, 0x5000, 1, 0x4800, 1, 0x4000, 17, 0x3800, 1, 0x3000,
+    40, 0x2000, 1, 0x0800, 222, 0x0000, 1, 0x1800, 38, 0x2000, 1, 0x2800,
+    1, 0x3000, 17, 0x3800, 1, 0x4000, 24, 0x5000, 1, 0x6800, 90, 0x7800,
+    1, 0x6800, 24, 0x5000, 1, 0x4000, 17, 0x3800, 1, 0x3000, 1, 0x2800,
+    38, 0x2000, 1, 0x1800, 221, 0x0000, 1, 0x1800, 38, 0x2000, 1, 0x2800,
+    18, 0x3800, 1, 0x4800, 23, 0x5000, 1, 0x6800, 94, 0x7800, 1, 0x6800,
+    23, 0x5000, 1, 0x4800, 18, 0x3800, 1, 0x2800, 38, 0x2000, 1, 0x1800,
+    219, 0x0000, 1, 0x1000, 38, 0x2000, 1, 0x2800, 18, 0x3800, 1, 0x4800,
+    22, 0x5000, 1, 0x6800, 98, 0x7800, 1, 0x6800, 22, 0x5000, 1, 0x4800,
+    18, 0x3800, 1, 0x2800, 38, 0x2000, 1, 0x1000, 217, 0x0000, 1, 0x0800,
+    38, 0x2000, 1, 0x2800, 17, 0x3800, 1, 0x4000, 22, 0x5000, 1, 0x6000,
+    1, 0x7000, 100, 0x7800, 1, 0x7000, 1, 0x6000, 22, 0x5000, 1, 0x4000,
+    17, 0x3800, 1, 0x2800, 38, 0x2000, 1, 0x0800, 216, 0x0000, 1, 0x1800,
+    37, 0x2000, 1, 0x2800, 17, 0x3800, 1, 0x4000, 21, 0x5000, 1, 0x5800,
+    1, 0x7000, 104, 0x7800, 1, 0x7000, 1, 0x5800, 21, 0x5000, 1, 0x4000,
+    17, 0x3800, 1, 0x2800, 37, 0x2000, 1, 0x1800, 215, 0x0000, 1, 0x1000,
+    37, 0x2000, 1, 0x2800, 17, 0x3800, 1, 0x4800, 21, 0x5000, 1, 0x6800,
+    43, 0x7800, 3, 0x8000, 4, 0x8800, 8, 0x9000, 4, 0x8800, 3, 0x8000,
+    43, 0x7800, 1, 0x6800, 21, 0x5000, 1, 0x4800, 17, 0x3800, 1, 0x2800,
+    37, 0x2000, 1, 0x1000, 213, 0x0000, 1, 0x0800, 38, 0x2000, 1, 0x3000,
+    16, 0x3800, 1, 0x4800, 20, 0x5000, 1, 0x6000, 39, 0x7800, 1, 0x8000,
+    2, 0x8800, 28, 0x9000, 2, 0x8800, 1, 0x8000, 39, 0x7800, 1, 0x6000,
+    20, 0x5000, 1, 0x4800, 16, 0x3800, 1, 0x3000, 38, 0x2000, 1, 0x0800,
+    212, 0x0000, 1, 0x1800, 37, 0x2000, 1, 0x3000, 16, 0x3800, 1, 0x4800,
+    20, 0x5000, 1, 0x7000, 35, 0x7800, 2, 0x8000, 1, 0x8800, 38, 0x9000,
+    1, 0x8800, 2, 0x8000, 35, 0x7800, 1, 0x7000, 20, 0x5000, 1, 0x4800,
+    16, 0x3800, 1, 0x3000, 37, 0x2000, 1, 0x1800, 211, 0x0000, 1, 0x1000,
+    37, 0x2000, 1, 0x3000, 15, 0x3800, 1, 0x4000, 1, 0x4800, 19, 0x5000,
+    1, 0x6000, 34, 0x7800, 1, 0x8000, 1, 0x8800, 46, 0x9000, 1, 0x8800,
+    1, 0x8000, 34, 0x7800, 1, 0x6000, 19, 0x5000, 1, 0x4800, 1, 0x4000,
+    15, 0x3800, 1, 0x3000, 37, 0x2000, 1, 0x1000, 209, 0x0000, 1, 0x0800,
+    37, 0x2000, 1, 0x3000, 15, 0x3800, 1, 0x4000, 20, 0x5000, 1, 0x7000,
+    31, 0x7800, 1, 0x8000, 1, 0x8800, 54, 0x9000, 1, 0x8800, 1, 0x8000,
+    31, 0x7800, 1, 0x7000, 20, 0x5000, 1, 0x4000, 15, 0x3800, 1, 0x3000,
+    37, 0x2000, 1, 0x0800, 208, 0x0000, 1, 0x1800, 36, 0x2000, 1, 0x3000,
+    15, 0x3800, 1, 0x4000, 19, 0x5000, 1, 0x5800, 1, 0x7000, 30, 0x7800,
+    1, 0x8800, 60, 0x9000, 1, 0x8800, 30, 0x7800, 1, 0x7000, 1, 0x5800,
+    19, 0x5000, 1, 0x4000, 15, 0x3800, 1, 0x3000, 36, 0x2000, 1, 0x1800,
+    207, 0x0000, 1, 0x1000, 36, 0x2000, 1, 0x2800, 15, 0x3800, 1, 0x4000,
+    19, 0x5000, 1, 0x6800, 29, 0x7800, 1, 0x8000, 1, 0x8800, 64, 0x9000,
+    1, 0x8800, 1, 0x8000, 29, 0x7800, 1, 0x6800, 19, 0x5000, 1, 0x4000,
+    15, 0x3800, 1, 0x2800, 36, 0x2000, 1, 0x1000, 206, 0x0000, 1, 0x1800,
+    35, 0x2000, 1, 0x2800, 15, 0x3800, 1, 0x4000, 19, 0x5000, 1, 0x7000,
+    28, 0x7800, 1, 0x8800, 70, 0x9000, 1, 0x8800, 28, 0x7800, 1, 0x7000,
+    19, 0x5000, 1, 0x4000, 15, 0x3800, 1, 0x2800, 35, 0x2000, 1, 0x1800,
+    205, 0x0000, 1, 0x1000, 36, 0x2000, 15, 0x3800, 1, 0x4000, 18, 0x5000,
+    1, 0x5800, 1, 0x7000, 26, 0x7800, 1, 0x8000, 1, 0x8800, 74, 0x9000,
+    1, 0x8800, 1, 0x8000, 26, 0x7800, 1, 0x7000, 1, 0x5800, 18, 0x5000,
+    1, 0x4000, 15, 0x3800, 36, 0x2000, 1, 0x1000, 203, 0x0000, 1, 0x0800,
+    36, 0x2000, 1, 0x3000, 14, 0x3800, 1, 0x4000, 18, 0x5000, 1, 0x5800,
+    26, 0x7800, 1, 0x8000, 1, 0x8800, 78, 0x9000, 1, 0x8800, 1, 0x8000,
+    26, 0x7800, 1, 0x5800, 18, 0x5000, 1, 0x4000, 14, 0x3800, 1, 0x3000,
+    36, 0x2000, 1, 0x0800, 202, 0x0000, 1, 0x1800, 35, 0x2000, 1, 0x3000,
+    15, 0x3800, 1, 0x4800, 17, 0x5000, 1, 0x6800, 25, 0x7800, 1, 0x8000,
+    1, 0x8800, 82, 0x9000, 1, 0x8800, 1, 0x8000, 25, 0x7800, 1, 0x6800,
+    17, 0x5000, 1, 0x4800, 15, 0x3800, 1, 0x3000, 35, 0x2000, 1, 0x1800,
+    201, 0x0000, 1, 0x0800, 35, 0x2000, 1, 0x2800, 15, 0x3800, 1, 0x4800,
+    17, 0x5000, 1, 0x6800, 25, 0x7800, 1, 0x8800, 86, 0x9000, 1, 0x8800,
+    25, 0x7800, 1, 0x6800, 17, 0x5000, 1, 0x4800, 15, 0x3800, 1, 0x2800,
+    35, 0x2000, 1, 0x0800, 200, 0x0000, 1, 0x1800, 34, 0x2000, 1, 0x2800,
+    15, 0x3800, 1, 0x4800, 17, 0x5000, 1, 0x7000, 24, 0x7800, 1, 0x8000,
+    90, 0x9000, 1, 0x8000, 24, 0x7800, 1, 0x7000, 17, 0x5000, 1, 0x4800,
+    15, 0x3800, 1, 0x2800, 34, 0x2000, 1, 0x1800, 199, 0x0000, 1, 0x1000,
+    35, 0x2000, 1, 0x3000, 14, 0x3800, 1, 0x4800, 17, 0x5000, 1, 0x7000,
+    23, 0x7800, 1, 0x8000, 1, 0x8800, 92, 0x9000, 1, 0x8800, 1, 0x8000,
+    23, 0x7800, 1, 0x7000, 17, 0x5000, 1, 0x4800, 14, 0x3800, 1, 0x3000,
+    35, 0x2000, 1, 0x1000, 198, 0x0000, 1, 0x1800, 34, 0x2000, 1, 0x3000,
+    14, 0x3800, 1, 0x4000, 17, 0x5000, 1, 0x7000, 23, 0x7800, 1, 0x8800,
+    96, 0x9000, 1, 0x8800, 23, 0x7800, 1, 0x7000, 17, 0x5000, 1, 0x4000,
+    14, 0x3800, 1, 0x3000, 34, 0x2000, 1, 0x1800, 197, 0x0000, 1, 0x1000,
+    34, 0x2000, 1, 0x2800, 14, 0x3800, 1, 0x4000, 17, 0x5000, 1, 0x7000,
+    22, 0x7800, 1, 0x8000, 38, 0x9000, 1, 0x9840, 1, 0xA880, 1, 0xB8E0,
+    1, 0xC100, 1, 0xD140, 2, 0xD980, 1, 0xE1A0, 8, 0xFA00, 1, 0xE1A0,
+    2, 0xD980, 1, 0xD140, 1, 0xC100, 1, 0xB8E0, 1, 0xA880, 1, 0x9840,
+    38, 0x9000, 1, 0x8000, 22, 0x7800, 1, 0x7000, 17, 0x5000, 1, 0x4000,
+    14, 0x3800, 1, 0x2800, 34, 0x2000, 1, 0x1000, 196, 0x0000, 35, 0x2000,
+    15, 0x3800, 17, 0x5000, 1, 0x7000, 22, 0x7800, 1, 0x8800, 34, 0x9000,
+    1, 0xA060, 1, 0xB0C0, 1, 0xC920, 1, 0xD980, 26, 0xFA00, 1, 0xD980,
+    1, 0xC920, 1, 0xB0C0, 1, 0xA060, 34, 0x9000, 1, 0x8800, 22, 0x7800,
+    1, 0x7000, 17, 0x5000, 15, 0x3800, 35, 0x2000, 195, 0x0000, 1, 0x1000,
+    34, 0x2000, 1, 0x3000, 14, 0x3800, 1, 0x4800, 16, 0x5000, 1, 0x7000,
+    21, 0x7800, 1, 0x8000, 1, 0x8800, 31, 0x9000, 1, 0x9840, 1, 0xB8E0,
+    1, 0xD160, 1, 0xF1E0, 5, 0xFA00, 1, 0xF1E0, 1, 0xE180, 1, 0xD940,
+    1, 0xD100, 1, 0xC0C0, 2, 0xB880, 1, 0xB060, 8, 0xA800, 1, 0xB060,
+    2, 0xB880, 1, 0xC0C0, 1, 0xD100, 1, 0xD940, 1, 0xE180, 1, 0xF1E0,
+    5, 0xFA00, 1, 0xF1E0, 1, 0xD160, 1, 0xB8E0, 1, 0x9840, 31, 0x9000,
+    1, 0x8800, 1, 0x8000, 21, 0x7800, 1, 0x7000, 16, 0x5000, 1, 0x4800,
+    14, 0x3800, 1, 0x3000, 34, 0x2000, 1, 0x1000, 194, 0x0000, 34, 0x2000,
+    1, 0x2800, 14, 0x3800, 1, 0x4800, 16, 0x5000, 1, 0x7000, 21, 0x7800,
+    1, 0x8000, 30, 0x9000, 1, 0xA060, 1, 0xC920, 1, 0xE9C0, 4, 0xFA00,
+    1, 0xE9C0, 1, 0xD960, 1, 0xD100, 1, 0xB880, 1, 0xA820, 24, 0xA800,
+    1, 0xA820, 1, 0xB880, 1, 0xD100, 1, 0xD960, 1, 0xE9C0, 4, 0xFA00,
+    1, 0xE9C0, 1, 0xC920, 1, 0xA060, 30, 0x9000, 1, 0x8000, 21, 0x7800,
+    1, 0x7000, 16, 0x5000, 1, 0x4800, 14, 0x3800, 1, 0x2800, 34, 0x2000,
+    193, 0x0000, 1, 0x1000, 34, 0x2000, 14, 0x3800, 1, 0x4000, 16, 0x5000,
+    1, 0x7000, 21, 0x7800, 1, 0x8800, 28, 0x9000, 1, 0x9840, 1, 0xC920,
+    1, 0xE9C0, 3, 0xFA00, 1, 0xF1E0, 1, 0xD940, 1, 0xC0C0, 1, 0xB040,
+    34, 0xA800, 1, 0xB040, 1, 0xC0C0, 1, 0xD940, 1, 0xF1E0, 3, 0xFA00,
+    1, 0xE9C0, 1, 0xC920, 1, 0x9840, 28, 0x9000, 1, 0x8800, 21, 0x7800,
+    1, 0x7000, 16, 0x5000, 1, 0x4000, 14, 0x3800, 34, 0x2000, 1, 0x1000,
+    192, 0x0000, 34, 0x2000, 1, 0x3000, 13, 0x3800, 1, 0x4000, 16, 0x5000,
+    1, 0x6800, 21, 0x7800, 1, 0x8800, 27, 0x9000, 1, 0xB0C0, 1, 0xE1A0,
+    3, 0xFA00, 1, 0xE9C0, 1, 0xD120, 1, 0xB060, 42, 0xA800, 1, 0xB060,
+    1, 0xD120, 1, 0xE9C0, 3, 0xFA00, 1, 0xE1A0, 1, 0xB0C0, 27, 0x9000,
+    1, 0x8800, 21, 0x7800, 1, 0x6800, 16, 0x5000, 1, 0x4000, 13, 0x3800,
+    1, 0x3000, 34, 0x2000, 191, 0x0000, 1, 0x1000, 33, 0x2000, 1, 0x2800,
+    14, 0x3800, 1, 0x4800, 15, 0x5000, 1, 0x6800, 20, 0x7800, 1, 0x8000,
+    26, 0x9000, 1, 0x9020, 1, 0xC100, 1, 0xF1E0, 2, 0xFA00, 1, 0xF1E0,
+    1, 0xD940, 1, 0xB060, 48, 0xA800, 1, 0xB060, 1, 0xD940, 1, 0xF1E0,
+    2, 0xFA00, 1, 0xF1E0, 1, 0xC100, 1, 0x9020, 26, 0x9000, 1, 0x8000,
+    20, 0x7800, 1, 0x6800, 15, 0x5000, 1, 0x4800, 14, 0x3800, 1, 0x2800,
+    33, 0x2000, 1, 0x1000, 190, 0x0000, 34, 0x2000, 1, 0x3000, 13, 0x3800,
+    1, 0x4800, 15, 0x5000, 1, 0x5800, 20, 0x7800, 1, 0x8000, 25, 0x9000,
+    1, 0x9840, 1, 0xD140, 3, 0xFA00, 1, 0xE9A0, 1, 0xC0C0, 1, 0xA820,
+    52, 0xA800, 1, 0xA820, 1, 0xC0C0, 1, 0xE9A0, 3, 0xFA00, 1, 0xD140,
+    1, 0x9840, 25, 0x9000, 1, 0x8000, 20, 0x7800, 1, 0x5800, 15, 0x5000,
+    1, 0x4800, 13, 0x3800, 1, 0x3000, 34, 0x2000, 189, 0x0000, 1, 0x1000,
+    33, 0x2000, 1, 0x3000, 13, 0x3800, 1, 0x4000, 15, 0x5000, 1, 0x5800,
+    20, 0x7800, 1, 0x8000, 24, 0x9000, 1, 0x9840, 1, 0xD140, 3, 0xFA00,
+    1, 0xD940, 1, 0xB880, 58, 0xA800, 1, 0xB880, 1, 0xD940, 3, 0xFA00,
+    1, 0xD140, 1, 0x9840, 24, 0x9000, 1, 0x8000, 20, 0x7800, 1, 0x5800,
+    15, 0x5000, 1, 0x4000, 13, 0x3800, 1, 0x3000, 33, 0x2000, 1, 0x1000,
+    188, 0x0000, 1, 0x1800, 33, 0x2000, 14, 0x3800, 16, 0x5000, 1, 0x7000,
+    19, 0x7800, 1, 0x8000, 23, 0x9000, 1, 0x9020, 1, 0xC100, 1, 0xF1E0,
+    2, 0xFA00, 1, 0xD940, 1, 0xB040, 62, 0xA800, 1, 0xB040, 1, 0xD940,
+    2, 0xFA00, 1, 0xF1E0, 1, 0xC100, 1, 0x9020, 23, 0x9000, 1, 0x8000,
+    19, 0x7800, 1, 0x7000, 16, 0x5000, 14, 0x3800, 33, 0x2000, 1, 0x1800,
+    187, 0x0000, 1, 0x0800, 33, 0x2000, 1, 0x3000, 13, 0x3800, 1, 0x4800,
+    15, 0x5000, 1, 0x7000, 19, 0x7800, 1, 0x8800, 23, 0x9000, 1, 0xB0C0,
+    1, 0xF1E0, 2, 0xFA00, 1, 0xD940, 1, 0xB040, 66, 0xA800, 1, 0xB040,
+    1, 0xD940, 2, 0xFA00, 1, 0xF1E0, 1, 0xB0C0, 23, 0x9000, 1, 0x8800,
+    19, 0x7800, 1, 0x7000, 15, 0x5000, 1, 0x4800, 13, 0x3800, 1, 0x3000,
+    33, 0x2000, 1, 0x0800, 186, 0x0000, 1, 0x1800, 32, 0x2000, 1, 0x2800,
+    13, 0x3800, 1, 0x4000, 15, 0x5000, 1, 0x6800, 19, 0x7800, 1, 0x8800,
+    22, 0x9000, 1, 0x9840, 1, 0xD980, 2, 0xFA00, 1, 0xE180, 1, 0xB880,
+    70, 0xA800, 1, 0xB880, 1, 0xE180, 2, 0xFA00, 1, 0xD980, 1, 0x9840,
+    22, 0x9000, 1, 0x8800, 19, 0x7800, 1, 0x6800, 15, 0x5000, 1, 0x4000,
+    13, 0x3800, 1, 0x2800, 32, 0x2000, 1, 0x1800, 185, 0x0000, 1, 0x0800,
+    33, 0x2000, 1, 0x3000, 13, 0x3800, 1, 0x4800, 14, 0x5000, 1, 0x5800,
+    19, 0x7800, 1, 0x8800, 22, 0x9000, 1, 0xC100, 2, 0xFA00, 1, 0xF1E0,
+    1, 0xC0C0, 74, 0xA800, 1, 0xC0C0, 1, 0xF1E0, 2, 0xFA00, 1, 0xC100,
+    22, 0x9000, 1, 0x8800, 19, 0x7800, 1, 0x5800, 14, 0x5000, 1, 0x4800,
+    13, 0x3800, 1, 0x3000, 33, 0x2000, 1, 0x0800, 184, 0x0000, 1, 0x1000,
+    32, 0x2000, 1, 0x2800, 13, 0x3800, 1, 0x4800, 15, 0x5000, 1, 0x7000,
+    18, 0x7800, 1, 0x8000, 21, 0x9000, 1, 0x9840, 1, 0xE1A0, 2, 0xFA00,
+    1, 0xD120, 1, 0xA820, 76, 0xA800, 1, 0xA820, 1, 0xD120, 2, 0xFA00,
+    1, 0xE1A0, 1, 0x9840, 21, 0x9000, 1, 0x8000, 18, 0x7800, 1, 0x7000,
+    15, 0x5000, 1, 0x4800, 13, 0x3800, 1, 0x2800, 32, 0x2000, 1, 0x1000,
+    184, 0x0000, 33, 0x2000, 1, 0x3000, 13, 0x3800, 15, 0x5000, 1, 0x7000,
+    18, 0x7800, 1, 0x8000, 21, 0x9000, 1, 0xB0C0, 1, 0xF1E0, 1, 0xFA00,
+    1, 0xE9C0, 1, 0xB880, 80, 0xA800, 1, 0xB880, 1, 0xE9C0, 1, 0xFA00,
+    1, 0xF1E0, 1, 0xB0C0, 21, 0x9000, 1, 0x8000, 18, 0x7800, 1, 0x7000,
+    15, 0x5000, 13, 0x3800, 1, 0x3000, 33, 0x2000, 183, 0x0000, 1, 0x1000,
+    32, 0x2000, 1, 0x2800, 13, 0x3800, 1, 0x4800, 14, 0x5000, 1, 0x6000,
+    18, 0x7800, 1, 0x8000, 20, 0x9000, 1, 0x9020, 1, 0xD140, 2, 0xFA00,
+    1, 0xD960, 1, 0xA820, 82, 0xA800, 1, 0xA820, 1, 0xD960, 2, 0xFA00,
+    1, 0xD140, 1, 0x9020, 20, 0x9000, 1, 0x8000, 18, 0x7800, 1, 0x6000,
+    14, 0x5000, 1, 0x4800, 13, 0x3800, 1, 0x2800, 32, 0x2000, 1, 0x1000,
+    182, 0x0000, 1, 0x1800, 32, 0x2000, 13, 0x3800, 1, 0x4000, 15, 0x5000,
+    18, 0x7800, 1, 0x8000, 20, 0x9000, 1, 0x9840, 1, 0xE1A0, 1, 0xFA00,
+    1, 0xF1E0, 1, 0xC0C0, 86, 0xA800, 1, 0xC0C0, 1, 0xF1E0, 1, 0xFA00,
+    1, 0xE1A0, 1, 0x9840, 20, 0x9000, 1, 0x8000, 18, 0x7800, 15, 0x5000,
+    1, 0x4000, 13, 0x3800, 32, 0x2000, 1, 0x1800, 181, 0x0000, 1, 0x0800,
+    32, 0x2000, 1, 0x2800, 13, 0x3800, 1, 0x4800, 14, 0x5000, 1, 0x7000,
+    18, 0x7800, 20, 0x9000, 1, 0xA060, 1, 0xF1E0, 1, 0xFA00, 1, 0xE9A0,
+    1, 0xB060, 88, 0xA800, 1, 0xB060, 1, 0xE9A0, 1, 0xFA00, 1, 0xF1E0,
+    1, 0xA060, 20, 0x9000, 18, 0x7800, 1, 0x7000, 14, 0x5000, 1, 0x4800,
+    13, 0x3800, 1, 0x2800, 32, 0x2000, 1, 0x0800, 180, 0x0000, 1, 0x1000,
+    32, 0x2000, 13, 0x3800, 1, 0x4000, 14, 0x5000, 1, 0x6000, 18, 0x7800,
+    1, 0x8800, 19, 0x9000, 1, 0xB0C0, 2, 0xFA00, 1, 0xD960, 1, 0xA820,
+    90, 0xA800, 1, 0xA820, 1, 0xD960, 2, 0xFA00, 1, 0xB0C0, 19, 0x9000,
+    1, 0x8800, 18, 0x7800, 1, 0x6000, 14, 0x5000, 1, 0x4000, 13, 0x3800,
+    32, 0x2000, 1, 0x1000, 180, 0x0000, 32, 0x2000, 1, 0x2800, 13, 0x3800,
+    15, 0x5000, 18, 0x7800, 1, 0x8800, 19, 0x9000, 1, 0xB0C0, 2, 0xFA00,
+    1, 0xD940, 94, 0xA800, 1, 0xD940, 2, 0xFA00, 1, 0xB0C0, 19, 0x9000,
+    1, 0x8800, 18, 0x7800, 15, 0x5000, 13, 0x3800, 1, 0x2800, 32, 0x2000,
+    179, 0x0000, 1, 0x0800, 32, 0x2000, 1, 0x3000, 12, 0x3800, 1, 0x4000,
+    14, 0x5000, 1, 0x6800, 17, 0x7800, 1, 0x8000, 19, 0x9000, 1, 0xC920,
+    2, 0xFA00, 1, 0xC0C0, 96, 0xA800, 1, 0xC0C0, 2, 0xFA00, 1, 0xC920,
+    19, 0x9000, 1, 0x8000, 17, 0x7800, 1, 0x6800, 14, 0x5000, 1, 0x4000,
+    12, 0x3800, 1, 0x3000, 32, 0x2000, 1, 0x0800, 178, 0x0000, 1, 0x1800,
+    31, 0x2000, 1, 0x2800, 13, 0x3800, 14, 0x5000, 1, 0x5800, 17, 0x7800,
+    1, 0x8000, 19, 0x9000, 1, 0xD140, 2, 0xFA00, 1, 0xC0C0, 98, 0xA800,
+    1, 0xC0C0, 2, 0xFA00, 1, 0xD140, 19, 0x9000, 1, 0x8000, 17, 0x7800,
+    1, 0x5800, 14, 0x5000, 13, 0x3800, 1, 0x2800, 31, 0x2000, 1, 0x1800,
+    178, 0x0000, 32, 0x2000, 1, 0x3000, 12, 0x3800, 1, 0x4000, 14, 0x5000,
+    1, 0x7000, 17, 0x7800, 1, 0x8800, 18, 0x9000, 1, 0xD140, 2, 0xFA00,
+    1, 0xC0C0, 100, 0xA800, 1, 0xC0C0, 2, 0xFA00, 1, 0xD140, 18, 0x9000,
+    1, 0x8800, 17, 0x7800, 1, 0x7000, 14, 0x5000, 1, 0x4000, 12, 0x3800,
+    1, 0x3000, 32, 0x2000, 177, 0x0000, 1, 0x0800, 31, 0x2000, 1, 0x2800,
+    13, 0x3800, 14, 0x5000, 1, 0x6000, 17, 0x7800, 1, 0x8800, 18, 0x9000,
+    1, 0xC920, 2, 0xFA00, 1, 0xC0C0, 102, 0xA800, 1, 0xC0C0, 2, 0xFA00,
+    1, 0xC920, 18, 0x9000, 1, 0x8800, 17, 0x7800, 1, 0x6000, 14, 0x5000,
+    13, 0x3800, 1, 0x2800, 31, 0x2000, 1, 0x0800, 176, 0x0000, 1, 0x1800,
+    31, 0x2000, 1, 0x3000, 12, 0x3800, 1, 0x4000, 14, 0x5000, 1, 0x7000,
+    16, 0x7800, 1, 0x8000, 18, 0x9000, 1, 0xB0C0, 2, 0xFA00, 1, 0xC0C0,
+    104, 0xA800, 1, 0xC0C0, 2, 0xFA00, 1, 0xB0C0, 18, 0x9000, 1, 0x8000,
+    16, 0x7800, 1, 0x7000, 14, 0x5000, 1, 0x4000, 12, 0x3800, 1, 0x3000,
+    31, 0x2000, 1, 0x1800, 176, 0x0000, 32, 0x2000, 13, 0x3800, 14, 0x5000,
+    1, 0x6800, 17, 0x7800, 18, 0x9000, 1, 0xB0C0, 2, 0xFA00, 1, 0xC0C0,
+    106, 0xA800, 1, 0xC0C0, 2, 0xFA00, 1, 0xB0C0, 18, 0x9000, 17, 0x7800,
+    1, 0x6800, 14, 0x5000, 13, 0x3800, 32, 0x2000, 175, 0x0000, 1, 0x0800,
+    31, 0x2000, 1, 0x2800, 12, 0x3800, 1, 0x4000, 14, 0x5000, 17, 0x7800,
+    1, 0x8800, 17, 0x9000, 1, 0xA060, 2, 0xFA00, 1, 0xC0C0, 108, 0xA800,
+    1, 0xC0C0, 2, 0xFA00, 1, 0xA060, 17, 0x9000, 1, 0x8800, 17, 0x7800,
+    14, 0x5000, 1, 0x4000, 12, 0x3800, 1, 0x2800, 31, 0x2000, 1, 0x0800,
+    174, 0x0000, 1, 0x1800, 31, 0x2000, 1, 0x3000, 12, 0x3800, 1, 0x4800,
+    13, 0x5000, 1, 0x6800, 16, 0x7800, 1, 0x8000, 17, 0x9000, 1, 0x9840,
+    1, 0xF1E0, 1, 0xFA00, 1, 0xD940, 110, 0xA800, 1, 0xD940, 1, 0xFA00,
+    1, 0xF1E0, 1, 0x9840, 17, 0x9000, 1, 0x8000, 16, 0x7800, 1, 0x6800,
+    13, 0x5000, 1, 0x4800, 12, 0x3800, 1, 0x3000, 31, 0x2000, 1, 0x1800,
+    174, 0x0000, 31, 0x2000, 1, 0x2800, 12, 0x3800, 1, 0x4000, 14, 0x5000,
+    17, 0x7800, 1, 0x8800, 16, 0x9000, 1, 0x9020, 1, 0xE1A0, 1, 0xFA00,
+    1, 0xD960, 112, 0xA800, 1, 0xD960, 1, 0xFA00, 1, 0xE1A0, 1, 0x9020,
+    16, 0x9000, 1, 0x8800, 17, 0x7800, 14, 0x5000, 1, 0x4000, 12, 0x3800,
+    1, 0x2800, 31, 0x2000, 173, 0x0000, 1, 0x0800, 31, 0x2000, 1, 0x3000,
+    12, 0x3800, 1, 0x4800, 13, 0x5000, 1, 0x6800, 16, 0x7800, 1, 0x8000,
+    17, 0x9000, 1, 0xD140, 1, 0xFA00, 1, 0xE9A0, 1, 0xA820, 112, 0xA800,
+    1, 0xA820, 1, 0xE9A0, 1, 0xFA00, 1, 0xD140, 17, 0x9000, 1, 0x8000,
+    16, 0x7800, 1, 0x6800, 13, 0x5000, 1, 0x4800, 12, 0x3800, 1, 0x3000,
+    31, 0x2000, 1, 0x0800, 172, 0x0000, 1, 0x1000, 31, 0x2000, 13, 0x3800,
+    14, 0x5000, 17, 0x7800, 17, 0x9000, 1, 0xB0C0, 1, 0xFA00, 1, 0xF1E0,
+    1, 0xB060, 114, 0xA800, 1, 0xB060, 1, 0xF1E0, 1, 0xFA00, 1, 0xB0C0,
+    17, 0x9000, 17, 0x7800, 14, 0x5000, 13, 0x3800, 31, 0x2000, 1, 0x1000,
+    172, 0x0000, 1, 0x1800, 30, 0x2000, 1, 0x2800, 12, 0x3800, 1, 0x4800,
+    13, 0x5000, 1, 0x6000, 16, 0x7800, 1, 0x8800, 16, 0x9000, 1, 0x9840,
+    1, 0xF1E0, 1, 0xFA00, 1, 0xC0C0, 116, 0xA800, 1, 0xC0C0, 1, 0xFA00,
+    1, 0xF1E0, 1, 0x9840, 16, 0x9000, 1, 0x8800, 16, 0x7800, 1, 0x6000,
+    13, 0x5000, 1, 0x4800, 12, 0x3800, 1, 0x2800, 30, 0x2000, 1, 0x1800,
+    171, 0x0000, 1, 0x0800, 31, 0x2000, 1, 0x3000, 12, 0x3800, 14, 0x5000,
+    1, 0x7000, 15, 0x7800, 1, 0x8000, 17, 0x9000, 1, 0xE1A0, 1, 0xFA00,
+    1, 0xD960, 118, 0xA800, 1, 0xD960, 1, 0xFA00, 1, 0xE1A0, 17, 0x9000,
+    1, 0x8000, 15, 0x7800, 1, 0x7000, 14, 0x5000, 12, 0x3800, 1, 0x3000,
+    31, 0x2000, 1, 0x0800, 170, 0x0000, 1, 0x1000, 31, 0x2000, 12, 0x3800,
+    1, 0x4000, 13, 0x5000, 1, 0x6000, 16, 0x7800, 1, 0x8800, 16, 0x9000,
+    1, 0xC100, 1, 0xFA00, 1, 0xE9C0, 1, 0xA820, 118, 0xA800, 1, 0xA820,
+    1, 0xE9C0, 1, 0xFA00, 1, 0xC100, 16, 0x9000, 1, 0x8800, 16, 0x7800,
+    1, 0x6000, 13, 0x5000, 1, 0x4000, 12, 0x3800, 31, 0x2000, 1, 0x1000,
+    170, 0x0000, 1, 0x1800, 30, 0x2000, 1, 0x2800, 12, 0x3800, 1, 0x4800,
+    13, 0x5000, 1, 0x7000, 15, 0x7800, 1, 0x8000, 16, 0x9000, 1, 0x9840,
+    2, 0xFA00, 1, 0xB880, 120, 0xA800, 1, 0xB880, 2, 0xFA00, 1, 0x9840,
+    16, 0x9000, 1, 0x8000, 15, 0x7800, 1, 0x7000, 13, 0x5000, 1, 0x4800,
+    12, 0x3800, 1, 0x2800, 30, 0x2000, 1, 0x1800, 170, 0x0000, 31, 0x2000,
+    1, 0x3000, 12, 0x3800, 13, 0x5000, 1, 0x5800, 16, 0x7800, 1, 0x8800,
+    16, 0x9000, 1, 0xD980, 1, 0xFA00, 1, 0xD120, 122, 0xA800, 1, 0xD120,
+    1, 0xFA00, 1, 0xD980, 16, 0x9000, 1, 0x8800, 16, 0x7800, 1, 0x5800,
+    13, 0x5000, 12, 0x3800, 1, 0x3000, 31, 0x2000, 169, 0x0000, 1, 0x0800,
+    31, 0x2000, 12, 0x3800, 1, 0x4000, 13, 0x5000, 1, 0x6800, 15, 0x7800,
+    1, 0x8000, 16, 0x9000, 1, 0xB0C0, 1, 0xFA00, 1, 0xF1E0, 1, 0xA820,
+    122, 0xA800, 1, 0xA820, 1, 0xF1E0, 1, 0xFA00, 1, 0xB0C0, 16, 0x9000,
+    1, 0x8000, 15, 0x7800, 1, 0x6800, 13, 0x5000, 1, 0x4000, 12, 0x3800,
+    31, 0x2000, 1, 0x0800, 168, 0x0000, 1, 0x1000, 30, 0x2000, 1, 0x2800,
+    12, 0x3800, 1, 0x4800, 13, 0x5000, 16, 0x7800, 1, 0x8800, 15, 0x9000,
+    1, 0x9020, 1, 0xF1E0, 1, 0xFA00, 1, 0xC0C0, 124, 0xA800, 1, 0xC0C0,
+    1, 0xFA00, 1, 0xF1E0, 1, 0x9020, 15, 0x9000, 1, 0x8800, 16, 0x7800,
+    13, 0x5000, 1, 0x4800, 12, 0x3800, 1, 0x2800, 30, 0x2000, 1, 0x1000,
+    168, 0x0000, 1, 0x1800, 30, 0x2000, 1, 0x3000, 12, 0x3800, 13, 0x5000,
+    1, 0x6000, 16, 0x7800, 16, 0x9000, 1, 0xC100, 1, 0xFA00, 1, 0xE180,
+    126, 0xA800, 1, 0xE180, 1, 0xFA00, 1, 0xC100, 16, 0x9000, 16, 0x7800,
+    1, 0x6000, 13, 0x5000, 12, 0x3800, 1, 0x3000, 30, 0x2000, 1, 0x1800,
+    168, 0x0000, 31, 0x2000, 12, 0x3800, 1, 0x4000, 13, 0x5000, 1, 0x7000,
+    15, 0x7800, 1, 0x8800, 15, 0x9000, 1, 0x9840, 1, 0xF1E0, 1, 0xFA00,
+    1, 0xB880, 126, 0xA800, 1, 0xB880, 1, 0xFA00, 1, 0xF1E0, 1, 0x9840,
+    15, 0x9000, 1, 0x8800, 15, 0x7800, 1, 0x7000, 13, 0x5000, 1, 0x4000,
+    12, 0x3800, 31, 0x2000, 167, 0x0000, 1, 0x0800, 31, 0x2000, 12, 0x3800,
+    1, 0x4800, 13, 0x5000, 16, 0x7800, 16, 0x9000, 1, 0xD140, 1, 0xFA00,
+    1, 0xD940, 128, 0xA800, 1, 0xD940, 1, 0xFA00, 1, 0xD140, 16, 0x9000,
+    16, 0x7800, 13, 0x5000, 1, 0x4800, 12, 0x3800, 31, 0x2000, 1, 0x0800,
+    166, 0x0000, 1, 0x0800, 30, 0x2000, 1, 0x2800, 12, 0x3800, 13, 0x5000,
+    1, 0x6000, 15, 0x7800, 1, 0x8000, 15, 0x9000, 1, 0x9840, 2, 0xFA00,
+    1, 0xB040, 128, 0xA800, 1, 0xB040, 2, 0xFA00, 1, 0x9840, 15, 0x9000,
+    1, 0x8000, 15, 0x7800, 1, 0x6000, 13, 0x5000, 12, 0x3800, 1, 0x2800,
+    30, 0x2000, 1, 0x0800, 166, 0x0000, 1, 0x1000, 30, 0x2000, 1, 0x3000,
+    11, 0x3800, 1, 0x4000, 13, 0x5000, 1, 0x7000, 15, 0x7800, 1, 0x8800,
+    15, 0x9000, 1, 0xD140, 1, 0xFA00, 1, 0xD940, 130, 0xA800, 1, 0xD940,
+    1, 0xFA00, 1, 0xD140, 15, 0x9000, 1, 0x8800, 15, 0x7800, 1, 0x7000,
+    13, 0x5000, 1, 0x4000, 11, 0x3800, 1, 0x3000, 30, 0x2000, 1, 0x1000,
+    166, 0x0000, 1, 0x1800, 30, 0x2000, 12, 0x3800, 1, 0x4800, 13, 0x5000,
+    16, 0x7800, 15, 0x9000, 1, 0x9020, 2, 0xFA00, 1, 0xB040, 130, 0xA800,
+    1, 0xB040, 2, 0xFA00, 1, 0x9020, 15, 0x9000, 16, 0x7800, 13, 0x5000,
+    1, 0x4800, 12, 0x3800, 30, 0x2000, 1, 0x1800, 166, 0x0000, 30, 0x2000,
+    1, 0x2800, 12, 0x3800, 13, 0x5000, 1, 0x6000, 15, 0x7800, 1, 0x8800,
+    15, 0x9000, 1, 0xC100, 1, 0xFA00, 1, 0xD940, 132, 0xA800, 1, 0xD940,
+    1, 0xFA00, 1, 0xC100, 15, 0x9000, 1, 0x8800, 15, 0x7800, 1, 0x6000,
+    13, 0x5000, 12, 0x3800, 1, 0x2800, 30, 0x2000, 165, 0x0000, 1, 0x0800,
+    30, 0x2000, 1, 0x2800, 12, 0x3800, 13, 0x5000, 1, 0x7000, 15, 0x7800,
+    16, 0x9000, 1, 0xF1E0, 1, 0xFA00, 1, 0xB880, 58, 0xA800, 1, 0xA860,
+    1, 0xB980, 1, 0xD320, 1, 0xDC40, 1, 0xE4A0, 1, 0xF5C0, 4, 0xFE40,
+    1, 0xF5C0, 1, 0xE4A0, 1, 0xDC40, 1, 0xD320, 1, 0xB980, 1, 0xA860,
+    58, 0xA800, 1, 0xB880, 1, 0xFA00, 1, 0xF1E0, 16, 0x9000, 15, 0x7800,
+    1, 0x7000, 13, 0x5000, 12, 0x3800, 1, 0x2800, 30, 0x2000, 1, 0x0800,
+    164, 0x0000, 1, 0x0800, 30, 0x2000, 1, 0x3000, 11, 0x3800, 1, 0x4000,
+    13, 0x5000, 15, 0x7800, 1, 0x8000, 15, 0x9000, 1, 0xB0C0, 1, 0xFA00,
+    1, 0xE9A0, 56, 0xA800, 1, 0xB0C0, 1, 0xCAA0, 1, 0xED00, 16, 0xFE40,
+    1, 0xED00, 1, 0xCAA0, 1, 0xB0C0, 56, 0xA800, 1, 0xE9A0, 1, 0xFA00,
+    1, 0xB0C0, 15, 0x9000, 1, 0x8000, 15, 0x7800, 13, 0x5000, 1, 0x4000,
+    11, 0x3800, 1, 0x3000, 30, 0x2000, 1, 0x0800, 164, 0x0000, 1, 0x1000,
+    30, 0x2000, 12, 0x3800, 1, 0x4800, 12, 0x5000, 1, 0x5800, 15, 0x7800,
+    1, 0x8800, 15, 0x9000, 1, 0xE1A0, 1, 0xFA00, 1, 0xC0C0, 54, 0xA800,
+    1, 0xB980, 1, 0xDC40, 22, 0xFE40, 1, 0xDC40, 1, 0xB980, 54, 0xA800,
+    1, 0xC0C0, 1, 0xFA00, 1, 0xE1A0, 15, 0x9000, 1, 0x8800, 15, 0x7800,
+    1, 0x5800, 12, 0x5000, 1, 0x4800, 12, 0x3800, 30, 0x2000, 1, 0x1000,
+    164, 0x0000, 1, 0x1800, 30, 0x2000, 12, 0x3800, 13, 0x5000, 1, 0x6800,
+    15, 0x7800, 15, 0x9000, 1, 0x9840, 1, 0xFA00, 1, 0xF1E0, 1, 0xA820,
+    52, 0xA800, 1, 0xB980, 1, 0xE4A0, 26, 0xFE40, 1, 0xE4A0, 1, 0xB980,
+    52, 0xA800, 1, 0xA820, 1, 0xF1E0, 1, 0xFA00, 1, 0x9840, 15, 0x9000,
+    15, 0x7800, 1, 0x6800, 13, 0x5000, 12, 0x3800, 30, 0x2000, 1, 0x1800,
+    164, 0x0000, 30, 0x2000, 1, 0x2800, 12, 0x3800, 13, 0x5000, 1, 0x7000,
+    15, 0x7800, 15, 0x9000, 1, 0xC920, 1, 0xFA00, 1, 0xD940, 51, 0xA800,
+    1, 0xB0C0, 1, 0xDC40, 30, 0xFE40, 1, 0xDC40, 1, 0xB0C0, 51, 0xA800,
+    1, 0xD940, 1, 0xFA00, 1, 0xC920, 15, 0x9000, 15, 0x7800, 1, 0x7000,
+    13, 0x5000, 12, 0x3800, 1, 0x2800, 30, 0x2000, 164, 0x0000, 30, 0x2000,
+    1, 0x3000, 11, 0x3800, 1, 0x4000, 13, 0x5000, 15, 0x7800, 1, 0x8000,
+    15, 0x9000, 1, 0xE9C0, 1, 0xFA00, 1, 0xB060, 50, 0xA800, 1, 0xC240,
+    1, 0xF5C0, 32, 0xFE40, 1, 0xF5C0, 1, 0xC240, 50, 0xA800, 1, 0xB060,
+    1, 0xFA00, 1, 0xE9C0, 15, 0x9000, 1, 0x8000, 15, 0x7800, 13, 0x5000,
+    1, 0x4000, 11, 0x3800, 1, 0x3000, 30, 0x2000, 163, 0x0000, 1, 0x0800,
+    30, 0x2000, 1, 0x3000, 11, 0x3800, 1, 0x4000, 12, 0x5000, 1, 0x5800,
+    15, 0x7800, 1, 0x8800, 14, 0x9000, 1, 0xA060, 1, 0xFA00, 1, 0xE9C0,
+    50, 0xA800, 1, 0xDBE0, 36, 0xFE40, 1, 0xDBE0, 50, 0xA800, 1, 0xE9C0,
+    1, 0xFA00, 1, 0xA060, 14, 0x9000, 1, 0x8800, 15, 0x7800, 1, 0x5800,
+    12, 0x5000, 1, 0x4000, 11, 0x3800, 1, 0x3000, 30, 0x2000, 1, 0x0800,
+    162, 0x0000, 1, 0x0800, 30, 0x2000, 12, 0x3800, 1, 0x4800, 12, 0x5000,
+    1, 0x6000, 15, 0x7800, 15, 0x9000, 1, 0xC920, 1, 0xFA00, 1, 0xD120,
+    48, 0xA800, 1, 0xA860, 1, 0xED00, 38, 0xFE40, 1, 0xED00, 1, 0xA860,
+    48, 0xA800, 1, 0xD120, 1, 0xFA00, 1, 0xC920, 15, 0x9000, 15, 0x7800,
+    1, 0x6000, 12, 0x5000, 1, 0x4800, 12, 0x3800, 30, 0x2000, 1, 0x0800,
+    162, 0x0000, 1, 0x1000, 30, 0x2000, 12, 0x3800, 13, 0x5000, 1, 0x6800,
+    14, 0x7800, 1, 0x8000, 15, 0x9000, 1, 0xE9C0, 1, 0xFA00, 1, 0xB060,
+    47, 0xA800, 1, 0xA860, 1, 0xED00, 40, 0xFE40, 1, 0xED00, 1, 0xA860,
+    47, 0xA800, 1, 0xB060, 1, 0xFA00, 1, 0xE9C0, 15, 0x9000, 1, 0x8000,
+    14, 0x7800, 1, 0x6800, 13, 0x5000, 12, 0x3800, 30, 0x2000, 1, 0x1000,
+    162, 0x0000, 1, 0x1800, 29, 0x2000, 1, 0x2800, 12, 0x3800, 13, 0x5000,
+    15, 0x7800, 1, 0x8000, 14, 0x9000, 1, 0x9840, 1, 0xFA00, 1, 0xF1E0,
+    47, 0xA800, 1, 0xA860, 1, 0xED00, 42, 0xFE40, 1, 0xED00, 1, 0xA860,
+    47, 0xA800, 1, 0xF1E0, 1, 0xFA00, 1, 0x9840, 14, 0x9000, 1, 0x8000,
+    15, 0x7800, 13, 0x5000, 12, 0x3800, 1, 0x2800, 29, 0x2000, 1, 0x1800,
+    162, 0x0000, 1, 0x1800, 29, 0x2000, 1, 0x2800, 11, 0x3800, 1, 0x4000,
+    13, 0x5000, 15, 0x7800, 1, 0x8800, 14, 0x9000, 1, 0xB8E0, 1, 0xFA00,
+    1, 0xD940, 47, 0xA800, 1, 0xED00, 44, 0xFE40, 1, 0xED00, 47, 0xA800,
+    1, 0xD940, 1, 0xFA00, 1, 0xB8E0, 14, 0x9000, 1, 0x8800, 15, 0x7800,
+    13, 0x5000, 1, 0x4000, 11, 0x3800, 1, 0x2800, 29, 0x2000, 1, 0x1800,
+    162, 0x0000, 30, 0x2000, 1, 0x3000, 11, 0x3800, 1, 0x4000, 12, 0x5000,
+    1, 0x5800, 15, 0x7800, 15, 0x9000, 1, 0xD160, 1, 0xFA00, 1, 0xC0C0,
+    46, 0xA800, 1, 0xDBE0, 46, 0xFE40, 1, 0xDBE0, 46, 0xA800, 1, 0xC0C0,
+    1, 0xFA00, 1, 0xD160, 15, 0x9000, 15, 0x7800, 1, 0x5800, 12, 0x5000,
+    1, 0x4000, 11, 0x3800, 1, 0x3000, 30, 0x2000, 162, 0x0000, 30, 0x2000,
+    1, 0x3000, 11, 0x3800, 1, 0x4800, 12, 0x5000, 1, 0x6000, 15, 0x7800,
+    15, 0x9000, 1, 0xF1E0, 1, 0xFA00, 1, 0xB040, 45, 0xA800, 1, 0xC240,
+    48, 0xFE40, 1, 0xC240, 45, 0xA800, 1, 0xB040, 1, 0xFA00, 1, 0xF1E0,
+    15, 0x9000, 15, 0x7800, 1, 0x6000, 12, 0x5000, 1, 0x4800, 11, 0x3800,
+    1, 0x3000, 30, 0x2000, 162, 0x0000, 30, 0x2000, 12, 0x3800, 1, 0x4800,
+    12, 0x5000, 1, 0x6800, 14, 0x7800, 1, 0x8000, 14, 0x9000, 1, 0xA060,
+    1, 0xFA00, 1, 0xE9C0, 45, 0xA800, 1, 0xB0C0, 1, 0xF5C0, 48, 0xFE40,
+    1, 0xF5C0, 1, 0xB0C0, 45, 0xA800, 1, 0xE9C0, 1, 0xFA00, 1, 0xA060,
+    14, 0x9000, 1, 0x8000, 14, 0x7800, 1, 0x6800, 12, 0x5000, 1, 0x4800,
+    12, 0x3800, 30, 0x2000, 161, 0x0000, 1, 0x0800, 30, 0x2000, 12, 0x3800,
+    13, 0x5000, 1, 0x7000, 14, 0x7800, 1, 0x8800, 14, 0x9000, 1, 0xB0C0,
+    1, 0xFA00, 1, 0xD960, 45, 0xA800, 1, 0xDC40, 16, 0xFE40, 1, 0xFE63,
+    1, 0xFECA, 1, 0xFF32, 1, 0xFF77, 2, 0xFF98, 1, 0xFF77, 1, 0xFF32,
+    1, 0xFECA, 1, 0xFE63, 24, 0xFE40, 1, 0xDC40, 45, 0xA800, 1, 0xD960,
+    1, 0xFA00, 1, 0xB0C0, 14, 0x9000, 1, 0x8800, 14, 0x7800, 1, 0x7000,
+    13, 0x5000, 12, 0x3800, 30, 0x2000, 1, 0x0800, 160, 0x0000, 1, 0x0800,
+    30, 0x2000, 12, 0x3800, 13, 0x5000, 15, 0x7800, 1, 0x8800, 14, 0x9000,
+    1, 0xC920, 1, 0xFA00, 1, 0xD100, 44, 0xA800, 1, 0xB980, 15, 0xFE40,
+    1, 0xFE63, 1, 0xFF0F, 10, 0xFF98, 1, 0xFF0F, 1, 0xFE63, 23, 0xFE40,
+    1, 0xB980, 44, 0xA800, 1, 0xD100, 1, 0xFA00, 1, 0xC920, 14, 0x9000,
+    1, 0x8800, 15, 0x7800, 13, 0x5000, 12, 0x3800, 30, 0x2000, 1, 0x0800,
+    160, 0x0000, 1, 0x1000, 30, 0x2000, 12, 0x3800, 13, 0x5000, 15, 0x7800,
+    15, 0x9000, 1, 0xD980, 1, 0xFA00, 1, 0xB880, 44, 0xA800, 1, 0xE4A0,
+    14, 0xFE40, 1, 0xFEA9, 1, 0xFF77, 12, 0xFF98, 1, 0xFF77, 1, 0xFEA9,
+    22, 0xFE40, 1, 0xE4A0, 44, 0xA800, 1, 0xB880, 1, 0xFA00, 1, 0xD980,
+    15, 0x9000, 15, 0x7800, 13, 0x5000, 12, 0x3800, 30, 0x2000, 1, 0x1000,
+    160, 0x0000, 1, 0x1000, 29, 0x2000, 1, 0x2800, 12, 0x3800, 12, 0x5000,
+    1, 0x5800, 15, 0x7800, 15, 0x9000, 2, 0xFA00, 1, 0xA820, 43, 0xA800,
+    1, 0xB980, 14, 0xFE40, 1, 0xFEA9, 16, 0xFF98, 1, 0xFEA9, 22, 0xFE40,
+    1, 0xB980, 43, 0xA800, 1, 0xA820, 2, 0xFA00, 15, 0x9000, 15, 0x7800,
+    1, 0x5800, 12, 0x5000, 12, 0x3800, 1, 0x2800, 29, 0x2000, 1, 0x1000,
+    160, 0x0000, 1, 0x1000, 29, 0x2000, 1, 0x2800, 11, 0x3800, 1, 0x4000,
+    12, 0x5000, 1, 0x5800, 15, 0x7800, 14, 0x9000, 1, 0x9840, 1, 0xFA00,
+    1, 0xF1E0, 44, 0xA800, 1, 0xDC40, 13, 0xFE40, 1, 0xFEA9, 18, 0xFF98,
+    1, 0xFEA9, 21, 0xFE40, 1, 0xDC40, 44, 0xA800, 1, 0xF1E0, 1, 0xFA00,
+    1, 0x9840, 14, 0x9000, 15, 0x7800, 1, 0x5800, 12, 0x5000, 1, 0x4000,
+    11, 0x3800, 1, 0x2800, 29, 0x2000, 1, 0x1000, 160, 0x0000, 1, 0x1800,
+    29, 0x2000, 1, 0x2800, 11, 0x3800, 1, 0x4000, 12, 0x5000, 1, 0x6000,
+    14, 0x7800, 1, 0x8000, 14, 0x9000, 1, 0xA880, 1, 0xFA00, 1, 0xE180,
+    43, 0xA800, 1, 0xB0C0, 13, 0xFE40, 1, 0xFE63, 1, 0xFF77, 18, 0xFF98,
+    1, 0xFF77, 1, 0xFE63, 21, 0xFE40, 1, 0xB0C0, 43, 0xA800, 1, 0xE180,
+    1, 0xFA00, 1, 0xA880, 14, 0x9000, 1, 0x8000, 14, 0x7800, 1, 0x6000,
+    12, 0x5000, 1, 0x4000, 11, 0x3800, 1, 0x2800, 29, 0x2000, 1, 0x1800,
+    160, 0x0000, 1, 0x1800, 29, 0x2000, 1, 0x3000, 11, 0x3800, 1, 0x4000,
+    12, 0x5000, 1, 0x6000, 14, 0x7800, 1, 0x8000, 14, 0x9000, 1, 0xB8E0,
+    1, 0xFA00, 1, 0xD940, 43, 0xA800, 1, 0xCAA0, 13, 0xFE40, 1, 0xFF0F,
+    20, 0xFF98, 1, 0xFF0F, 21, 0xFE40, 1, 0xCAA0, 43, 0xA800, 1, 0xD940,
+    1, 0xFA00, 1, 0xB8E0, 14, 0x9000, 1, 0x8000, 14, 0x7800, 1, 0x6000,
+    12, 0x5000, 1, 0x4000, 11, 0x3800, 1, 0x3000, 29, 0x2000, 1, 0x1800,
+    160, 0x0000, 1, 0x1800, 29, 0x2000, 1, 0x3000, 11, 0x3800, 1, 0x4800,
+    12, 0x5000, 1, 0x6800, 14, 0x7800, 1, 0x8000, 14, 0x9000, 1, 0xC100,
+    1, 0xFA00, 1, 0xD100, 43, 0xA800, 1, 0xED00, 12, 0xFE40, 1, 0xFE63,
+    22, 0xFF98, 1, 0xFE63, 20, 0xFE40, 1, 0xED00, 43, 0xA800, 1, 0xD100,
+    1, 0xFA00, 1, 0xC100, 14, 0x9000, 1, 0x8000, 14, 0x7800, 1, 0x6800,
+    12, 0x5000, 1, 0x4800, 11, 0x3800, 1, 0x3000, 29, 0x2000, 1, 0x1800,
+    160, 0x0000, 1, 0x1800, 29, 0x2000, 1, 0x3000, 11, 0x3800, 1, 0x4800,
+    12, 0x5000, 1, 0x6800, 14, 0x7800, 1, 0x8800, 14, 0x9000, 1, 0xD140,
+    1, 0xFA00, 1, 0xC0C0, 42, 0xA800, 1, 0xA860, 13, 0xFE40, 1, 0xFECA,
+    22, 0xFF98, 1, 0xFECA, 21, 0xFE40, 1, 0xA860, 42, 0xA800, 1, 0xC0C0,
+    1, 0xFA00, 1, 0xD140, 14, 0x9000, 1, 0x8800, 14, 0x7800, 1, 0x6800,
+    12, 0x5000, 1, 0x4800, 11, 0x3800, 1, 0x3000, 29, 0x2000, 1, 0x1800,
+    160, 0x0000, 1, 0x1800, 29, 0x2000, 1, 0x3000, 11, 0x3800, 1, 0x4800,
+    12, 0x5000, 1, 0x6800, 14, 0x7800, 1, 0x8800, 14, 0x9000, 1, 0xD980,
+    1, 0xFA00, 1, 0xB880, 42, 0xA800, 1, 0xB980, 13, 0xFE40, 1, 0xFF32,
+    22, 0xFF98, 1, 0xFF32, 21, 0xFE40, 1, 0xB980, 42, 0xA800, 1, 0xB880,
+    1, 0xFA00, 1, 0xD980, 14, 0x9000, 1, 0x8800, 14, 0x7800, 1, 0x6800,
+    12, 0x5000, 1, 0x4800, 11, 0x3800, 1, 0x3000, 29, 0x2000, 1, 0x1800,
+    160, 0x0000, 30, 0x2000, 1, 0x3000, 11, 0x3800, 1, 0x4800, 12, 0x5000,
+    1, 0x6800, 14, 0x7800, 1, 0x8800, 14, 0x9000, 1, 0xD980, 1, 0xFA00,
+    1, 0xB880, 42, 0xA800, 1, 0xD320, 13, 0xFE40, 1, 0xFF77, 22, 0xFF98,
+    1, 0xFF77, 21, 0xFE40, 1, 0xD320, 42, 0xA800, 1, 0xB880, 1, 0xFA00,
+    1, 0xD980, 14, 0x9000, 1, 0x8800, 14, 0x7800, 1, 0x6800, 12, 0x5000,
+    1, 0x4800, 11, 0x3800, 1, 0x3000, 30, 0x2000, 160, 0x0000, 30, 0x2000,
+    12, 0x3800, 13, 0x5000, 15, 0x7800, 1, 0x8800, 14, 0x9000, 1, 0xE1A0,
+    1, 0xFA00, 1, 0xB060, 42, 0xA800, 1, 0xDC40, 13, 0xFE40, 24, 0xFF98,
+    21, 0xFE40, 1, 0xDC40, 42, 0xA800, 1, 0xB060, 1, 0xFA00, 1, 0xE1A0,
+    14, 0x9000, 1, 0x8800, 15, 0x7800, 13, 0x5000, 12, 0x3800, 30, 0x2000,
+    160, 0x0000, 30, 0x2000, 12, 0x3800, 13, 0x5000, 15, 0x7800, 15, 0x9000,
+    2, 0xFA00, 43, 0xA800, 1, 0xE4A0, 13, 0xFE40, 24, 0xFF98, 21, 0xFE40,
+    1, 0xE4A0, 43, 0xA800, 2, 0xFA00, 15, 0x9000, 15, 0x7800, 13, 0x5000,
+    12, 0x3800, 30, 0x2000, 160, 0x0000, 30, 0x2000, 12, 0x3800, 13, 0x5000,
+    15, 0x7800, 15, 0x9000, 2, 0xFA00, 43, 0xA800, 1, 0xF5C0, 13, 0xFE40,
+    1, 0xFF77, 22, 0xFF98, 1, 0xFF77, 21, 0xFE40, 1, 0xF5C0, 43, 0xA800,
+    2, 0xFA00, 15, 0x9000, 15, 0x7800, 13, 0x5000, 12, 0x3800, 30, 0x2000,
+    160, 0x0000, 30, 0x2000, 12, 0x3800, 13, 0x5000, 15, 0x7800, 15, 0x9000,
+    2, 0xFA00, 43, 0xA800, 14, 0xFE40, 1, 0xFF32, 22, 0xFF98, 1, 0xFF32,
+    22, 0xFE40, 43, 0xA800, 2, 0xFA00, 15, 0x9000, 15, 0x7800, 13, 0x5000,
+    12, 0x3800, 30, 0x2000, 160, 0x0000, 30, 0x2000, 12, 0x3800, 13, 0x5000,
+    15, 0x7800, 15, 0x9000, 2, 0xFA00, 43, 0xA800, 14, 0xFE40, 1, 0xFECA,
+    22, 0xFF98, 1, 0xFECA, 22, 0xFE40, 43, 0xA800, 2, 0xFA00, 15, 0x9000,
+    15, 0x7800, 13, 0x5000, 12, 0x3800, 30, 0x2000, 160, 0x0000, 30, 0x2000,
+    12, 0x3800, 13, 0x5000, 15, 0x7800, 15, 0x9000, 2, 0xFA00, 43, 0xA800,
+    14, 0xFE40, 1, 0xFE63, 22, 0xFF98, 1, 0xFE63, 22, 0xFE40, 43, 0xA800,
+    2, 0xFA00, 15, 0x9000, 15, 0x7800, 13, 0x5000, 12, 0x3800, 30, 0x2000,
+    160, 0x0000, 30, 0x2000, 12, 0x3800, 13, 0x5000, 15, 0x7800, 15, 0x9000,
+    2, 0xFA00, 43, 0xA800, 15, 0xFE40, 1, 0xFF0F, 20, 0xFF98, 1, 0xFF0F,
+    23, 0xFE40, 43, 0xA800, 2, 0xFA00, 15, 0x9000, 15, 0x7800, 13, 0x5000,
+    12, 0x3800, 30, 0x2000, 160, 0x0000, 30, 0x2000, 12, 0x3800, 13, 0x5000,
+    15, 0x7800, 15, 0x9000, 2, 0xFA00, 43, 0xA800, 1, 0xF5C0, 14, 0xFE40,
+    1, 0xFE63, 1, 0xFF77, 18, 0xFF98, 1, 0xFF77, 1, 0xFE63, 22, 0xFE40,
+    1, 0xF5C0, 43, 0xA800, 2, 0xFA00, 15, 0x9000, 15, 0x7800, 13, 0x5000,
+    12, 0x3800, 30, 0x2000, 160, 0x0000, 30, 0x2000, 12, 0x3800, 13, 0x5000,
+    15, 0x7800, 15, 0x9000, 2, 0xFA00, 43, 0xA800, 1, 0xE4A0, 15, 0xFE40,
+    1, 0xFEA9, 18, 0xFF98, 1, 0xFEA9, 23, 0xFE40, 1, 0xE4A0, 43, 0xA800,
+    2, 0xFA00, 15, 0x9000, 15, 0x7800, 13, 0x5000, 12, 0x3800, 30, 0x2000,
+    160, 0x0000, 30, 0x2000, 12, 0x3800, 13, 0x5000, 15, 0x7800, 1, 0x8800,
+    14, 0x9000, 1, 0xE1A0, 1, 0xFA00, 1, 0xB060, 42, 0xA800, 1, 0xDC40,
+    16, 0xFE40, 1, 0xFEA9, 16, 0xFF98, 1, 0xFEA9, 24, 0xFE40, 1, 0xDC40,
+    42, 0xA800, 1, 0xB060, 1, 0xFA00, 1, 0xE1A0, 14, 0x9000, 1, 0x8800,
+    15, 0x7800, 13, 0x5000, 12, 0x3800, 30, 0x2000, 160, 0x0000, 30, 0x2000,
+    1, 0x3000, 11, 0x3800, 1, 0x4800, 12, 0x5000, 1, 0x6800, 14, 0x7800,
+    1, 0x8800, 14, 0x9000, 1, 0xD980, 1, 0xFA00, 1, 0xB880, 42, 0xA800,
+    1, 0xD320, 17, 0xFE40, 1, 0xFEA9, 1, 0xFF77, 12, 0xFF98, 1, 0xFF77,
+    1, 0xFEA9, 25, 0xFE40, 1, 0xD320, 42, 0xA800, 1, 0xB880, 1, 0xFA00,
+    1, 0xD980, 14, 0x9000, 1, 0x8800, 14, 0x7800, 1, 0x6800, 12, 0x5000,
+    1, 0x4800, 11, 0x3800, 1, 0x3000, 30, 0x2000, 160, 0x0000, 1, 0x1800,
+    29, 0x2000, 1, 0x3000, 11, 0x3800, 1, 0x4800, 12, 0x5000, 1, 0x6800,
+    14, 0x7800, 1, 0x8800, 14, 0x9000, 1, 0xD980, 1, 0xFA00, 1, 0xB880,
+    42, 0xA800, 1, 0xB980, 18, 0xFE40, 1, 0xFE63, 1, 0xFF0F, 10, 0xFF98,
+    1, 0xFF0F, 1, 0xFE63, 26, 0xFE40, 1, 0xB980, 42, 0xA800, 1, 0xB880,
+    1, 0xFA00, 1, 0xD980, 14, 0x9000, 1, 0x8800, 14, 0x7800, 1, 0x6800,
+    12, 0x5000, 1, 0x4800, 11, 0x3800, 1, 0x3000, 29, 0x2000, 1, 0x1800,
+    160, 0x0000, 1, 0x1800, 29, 0x2000, 1, 0x3000, 11, 0x3800, 1, 0x4800,
+    12, 0x5000, 1, 0x6800, 14, 0x7800, 1, 0x8800, 14, 0x9000, 1, 0xD140,
+    1, 0xFA00, 1, 0xC0C0, 42, 0xA800, 1, 0xA860, 20, 0xFE40, 1, 0xFE63,
+    1, 0xFECA, 1, 0xFF32, 1, 0xFF77, 2, 0xFF98, 1, 0xFF77, 1, 0xFF32,
+    1, 0xFECA, 1, 0xFE63, 28, 0xFE40, 1, 0xA860, 42, 0xA800, 1, 0xC0C0,
+    1, 0xFA00, 1, 0xD140, 14, 0x9000, 1, 0x8800, 14, 0x7800, 1, 0x6800,
+    12, 0x5000, 1, 0x4800, 11, 0x3800, 1, 0x3000, 29, 0x2000, 1, 0x1800,
+    160, 0x0000, 1, 0x1800, 29, 0x2000, 1, 0x3000, 11, 0x3800, 1, 0x4800,
+    12, 0x5000, 1, 0x6800, 14, 0x7800, 1, 0x8000, 14, 0x9000, 1, 0xC100,
+    1, 0xFA00, 1, 0xD100, 43, 0xA800, 1, 0xED00, 56, 0xFE40, 1, 0xED00,
+    43, 0xA800, 1, 0xD100, 1, 0xFA00, 1, 0xC100, 14, 0x9000, 1, 0x8000,
+    14, 0x7800, 1, 0x6800, 12, 0x5000, 1, 0x4800, 11, 0x3800, 1, 0x3000,
+    29, 0x2000, 1, 0x1800, 160, 0x0000, 1, 0x1800, 29, 0x2000, 1, 0x3000,
+    11, 0x3800, 1, 0x4000, 12, 0x5000, 1, 0x6000, 14, 0x7800, 1, 0x8000,
+    14, 0x9000, 1, 0xB8E0, 1, 0xFA00, 1, 0xD940, 43, 0xA800, 1, 0xCAA0,
+    56, 0xFE40, 1, 0xCAA0, 43, 0xA800, 1, 0xD940, 1, 0xFA00, 1, 0xB8E0,
+    14, 0x9000, 1, 0x8000, 14, 0x7800, 1, 0x6000, 12, 0x5000, 1, 0x4000,
+    11, 0x3800, 1, 0x3000, 29, 0x2000, 1, 0x1800, 160, 0x0000, 1, 0x1800,
+    29, 0x2000, 1, 0x2800, 11, 0x3800, 1, 0x4000, 12, 0x5000, 1, 0x6000,
+    14, 0x7800, 1, 0x8000, 14, 0x9000, 1, 0xA880, 1, 0xFA00, 1, 0xE180,
+    43, 0xA800, 1, 0xB0C0, 56, 0xFE40, 1, 0xB0C0, 43, 0xA800, 1, 0xE180,
+    1, 0xFA00, 1, 0xA880, 14, 0x9000, 1, 0x8000, 14, 0x7800, 1, 0x6000,
+    12, 0x5000, 1, 0x4000, 11, 0x3800, 1, 0x2800, 29, 0x2000, 1, 0x1800,
+    160, 0x0000, 1, 0x1000, 29, 0x2000, 1, 0x2800, 11, 0x3800, 1, 0x4000,
+    12, 0x5000, 1, 0x5800, 15, 0x7800, 14, 0x9000, 1, 0x9840, 1, 0xFA00,
+    1, 0xF1E0, 44, 0xA800, 1, 0xDC40, 54, 0xFE40, 1, 0xDC40, 44, 0xA800,
+    1, 0xF1E0, 1, 0xFA00, 1, 0x9840, 14, 0x9000, 15, 0x7800, 1, 0x5800,
+    12, 0x5000, 1, 0x4000, 11, 0x3800, 1, 0x2800, 29, 0x2000, 1, 0x1000,
+    160, 0x0000, 1, 0x1000, 29, 0x2000, 1, 0x2800, 12, 0x3800, 12, 0x5000,
+    1, 0x5800, 15, 0x7800, 15, 0x9000, 2, 0xFA00, 1, 0xA820, 43, 0xA800,
+    1, 0xB980, 54, 0xFE40, 1, 0xB980, 43, 0xA800, 1, 0xA820, 2, 0xFA00,
+    15, 0x9000, 15, 0x7800, 1, 0x5800, 12, 0x5000, 12, 0x3800, 1, 0x2800,
+    29, 0x2000, 1, 0x1000, 160, 0x0000, 1, 0x1000, 30, 0x2000, 12, 0x3800,
+    13, 0x5000, 15, 0x7800, 15, 0x9000, 1, 0xD980, 1, 0xFA00, 1, 0xB880,
+    44, 0xA800, 1, 0xE4A0, 52, 0xFE40, 1, 0xE4A0, 44, 0xA800, 1, 0xB880,
+    1, 0xFA00, 1, 0xD980, 15, 0x9000, 15, 0x7800, 13, 0x5000, 12, 0x3800,
+    30, 0x2000, 1, 0x1000, 160, 0x0000, 1, 0x0800, 30, 0x2000, 12, 0x3800,
+    13, 0x5000, 15, 0x7800, 1, 0x8800, 14, 0x9000, 1, 0xC920, 1, 0xFA00,
+    1, 0xD100, 44, 0xA800, 1, 0xB980, 52, 0xFE40, 1, 0xB980, 44, 0xA800,
+    1, 0xD100, 1, 0xFA00, 1, 0xC920, 14, 0x9000, 1, 0x8800, 15, 0x7800,
+    13, 0x5000, 12, 0x3800, 30, 0x2000, 1, 0x0800, 160, 0x0000, 1, 0x0800,
+    30, 0x2000, 12, 0x3800, 13, 0x5000, 1, 0x7000, 14, 0x7800, 1, 0x8800,
+    14, 0x9000, 1, 0xB0C0, 1, 0xFA00, 1, 0xD960, 45, 0xA800, 1, 0xDC40,
+    50, 0xFE40, 1, 0xDC40, 45, 0xA800, 1, 0xD960, 1, 0xFA00, 1, 0xB0C0,
+    14, 0x9000, 1, 0x8800, 14, 0x7800, 1, 0x7000, 13, 0x5000, 12, 0x3800,
+    30, 0x2000, 1, 0x0800, 161, 0x0000, 30, 0x2000, 12, 0x3800, 1, 0x4800,
+    12, 0x5000, 1, 0x6800, 14, 0x7800, 1, 0x8000, 14, 0x9000, 1, 0xA060,
+    1, 0xFA00, 1, 0xE9C0, 45, 0xA800, 1, 0xB0C0, 1, 0xF5C0, 48, 0xFE40,
+    1, 0xF5C0, 1, 0xB0C0, 45, 0xA800, 1, 0xE9C0, 1, 0xFA00, 1, 0xA060,
+    14, 0x9000, 1, 0x8000, 14, 0x7800, 1, 0x6800, 12, 0x5000, 1, 0x4800,
+    12, 0x3800, 30, 0x2000, 162, 0x0000, 30, 0x2000, 1, 0x3000, 11, 0x3800,
+    1, 0x4800, 12, 0x5000, 1, 0x6000, 15, 0x7800, 15, 0x9000, 1, 0xF1E0,
+    1, 0xFA00, 1, 0xB040, 45, 0xA800, 1, 0xC240, 48, 0xFE40, 1, 0xC240,
+    45, 0xA800, 1, 0xB040, 1, 0xFA00, 1, 0xF1E0, 15, 0x9000, 15, 0x7800,
+    1, 0x6000, 12, 0x5000, 1, 0x4800, 11, 0x3800, 1, 0x3000, 30, 0x2000,
+    162, 0x0000, 30, 0x2000, 1, 0x3000, 11, 0x3800, 1, 0x4000, 12, 0x5000,
+    1, 0x5800, 15, 0x7800, 15, 0x9000, 1, 0xD160, 1, 0xFA00, 1, 0xC0C0,
+    46, 0xA800, 1, 0xDBE0, 46, 0xFE40, 1, 0xDBE0, 46, 0xA800, 1, 0xC0C0,
+    1, 0xFA00, 1, 0xD160, 15, 0x9000, 15, 0x7800, 1, 0x5800, 12, 0x5000,
+    1, 0x4000, 11, 0x3800, 1, 0x3000, 30, 0x2000, 162, 0x0000, 1, 0x1800,
+    29, 0x2000, 1, 0x2800, 11, 0x3800, 1, 0x4000, 13, 0x5000, 15, 0x7800,
+    1, 0x8800, 14, 0x9000, 1, 0xB8E0, 1, 0xFA00, 1, 0xD940, 47, 0xA800,
+    1, 0xED00, 44, 0xFE40, 1, 0xED00, 47, 0xA800, 1, 0xD940, 1, 0xFA00,
+    1, 0xB8E0, 14, 0x9000, 1, 0x8800, 15, 0x7800, 13, 0x5000, 1, 0x4000,
+    11, 0x3800, 1, 0x2800, 29, 0x2000, 1, 0x1800, 162, 0x0000, 1, 0x1800,
+    29, 0x2000, 1, 0x2800, 12, 0x3800, 13, 0x5000, 15, 0x7800, 1, 0x8000,
+    14, 0x9000, 1, 0x9840, 1, 0xFA00, 1, 0xF1E0, 47, 0xA800, 1, 0xA860,
+    1, 0xED00, 42, 0xFE40, 1, 0xED00, 1, 0xA860, 47, 0xA800, 1, 0xF1E0,
+    1, 0xFA00, 1, 0x9840, 14, 0x9000, 1, 0x8000, 15, 0x7800, 13, 0x5000,
+    12, 0x3800, 1, 0x2800, 29, 0x2000, 1, 0x1800, 162, 0x0000, 1, 0x1000,
+    30, 0x2000, 12, 0x3800, 13, 0x5000, 1, 0x6800, 14, 0x7800, 1, 0x8000,
+    15, 0x9000, 1, 0xE9C0, 1, 0xFA00, 1, 0xB060, 47, 0xA800, 1, 0xA860,
+    1, 0xED00, 40, 0xFE40, 1, 0xED00, 1, 0xA860, 47, 0xA800, 1, 0xB060,
+    1, 0xFA00, 1, 0xE9C0, 15, 0x9000, 1, 0x8000, 14, 0x7800, 1, 0x6800,
+    13, 0x5000, 12, 0x3800, 30, 0x2000, 1, 0x1000, 162, 0x0000, 1, 0x0800,
+    30, 0x2000, 12, 0x3800, 1, 0x4800, 12, 0x5000, 1, 0x6000, 15, 0x7800,
+    15, 0x9000, 1, 0xC920, 1, 0xFA00, 1, 0xD120, 48, 0xA800, 1, 0xA860,
+    1, 0xED00, 38, 0xFE40, 1, 0xED00, 1, 0xA860, 48, 0xA800, 1, 0xD120,
+    1, 0xFA00, 1, 0xC920, 15, 0x9000, 15, 0x7800, 1, 0x6000, 12, 0x5000,
+    1, 0x4800, 12, 0x3800, 30, 0x2000, 1, 0x0800, 162, 0x0000, 1, 0x0800,
+    30, 0x2000, 1, 0x3000, 11, 0x3800, 1, 0x4000, 12, 0x5000, 1, 0x5800,
+    15, 0x7800, 1, 0x8800, 14, 0x9000, 1, 0xA060, 1, 0xFA00, 1, 0xE9C0,
+    50, 0xA800, 1, 0xDBE0, 36, 0xFE40, 1, 0xDBE0, 50, 0xA800, 1, 0xE9C0,
+    1, 0xFA00, 1, 0xA060, 14, 0x9000, 1, 0x8800, 15, 0x7800, 1, 0x5800,
+    12, 0x5000, 1, 0x4000, 11, 0x3800, 1, 0x3000, 30, 0x2000, 1, 0x0800,
+    163, 0x0000, 30, 0x2000, 1, 0x3000, 11, 0x3800, 1, 0x4000, 13, 0x5000,
+    15, 0x7800, 1, 0x8000, 15, 0x9000, 1, 0xE9C0, 1, 0xFA00, 1, 0xB060,
+    50, 0xA800, 1, 0xC240, 1, 0xF5C0, 32, 0xFE40, 1, 0xF5C0, 1, 0xC240,
+    50, 0xA800, 1, 0xB060, 1, 0xFA00, 1, 0xE9C0, 15, 0x9000, 1, 0x8000,
+    15, 0x7800, 13, 0x5000, 1, 0x4000, 11, 0x3800, 1, 0x3000, 30, 0x2000,
+    164, 0x0000, 30, 0x2000, 1, 0x2800, 12, 0x3800, 13, 0x5000, 1, 0x7000,
+    15, 0x7800, 15, 0x9000, 1, 0xC920, 1, 0xFA00, 1, 0xD940, 51, 0xA800,
+    1, 0xB0C0, 1, 0xDC40, 30, 0xFE40, 1, 0xDC40, 1, 0xB0C0, 51, 0xA800,
+    1, 0xD940, 1, 0xFA00, 1, 0xC920, 15, 0x9000, 15, 0x7800, 1, 0x7000,
+    13, 0x5000, 12, 0x3800, 1, 0x2800, 30, 0x2000, 164, 0x0000, 1, 0x1800,
+    30, 0x2000, 12, 0x3800, 13, 0x5000, 1, 0x6800, 15, 0x7800, 15, 0x9000,
+    1, 0x9840, 1, 0xFA00, 1, 0xF1E0, 1, 0xA820, 52, 0xA800, 1, 0xB980,
+    1, 0xE4A0, 26, 0xFE40, 1, 0xE4A0, 1, 0xB980, 52, 0xA800, 1, 0xA820,
+    1, 0xF1E0, 1, 0xFA00, 1, 0x9840, 15, 0x9000, 15, 0x7800, 1, 0x6800,
+    13, 0x5000, 12, 0x3800, 30, 0x2000, 1, 0x1800, 164, 0x0000, 1, 0x1000,
+    30, 0x2000, 12, 0x3800, 1, 0x4800, 12, 0x5000, 1, 0x5800, 15, 0x7800,
+    1, 0x8800, 15, 0x9000, 1, 0xE1A0, 1, 0xFA00, 1, 0xC0C0, 54, 0xA800,
+    1, 0xB980, 1, 0xDC40, 22, 0xFE40, 1, 0xDC40, 1, 0xB980, 54, 0xA800,
+    1, 0xC0C0, 1, 0xFA00, 1, 0xE1A0, 15, 0x9000, 1, 0x8800, 15, 0x7800,
+    1, 0x5800, 12, 0x5000, 1, 0x4800, 12, 0x3800, 30, 0x2000, 1, 0x1000,
+    164, 0x0000, 1, 0x0800, 30, 0x2000, 1, 0x3000, 11, 0x3800, 1, 0x4000,
+    13, 0x5000, 15, 0x7800, 1, 0x8000, 15, 0x9000, 1, 0xB0C0, 1, 0xFA00,
+    1, 0xE9A0, 56, 0xA800, 1, 0xB0C0, 1, 0xCAA0, 1, 0xED00, 16, 0xFE40,
+    1, 0xED00, 1, 0xCAA0, 1, 0xB0C0, 56, 0xA800, 1, 0xE9A0, 1, 0xFA00,
+    1, 0xB0C0, 15, 0x9000, 1, 0x8000, 15, 0x7800, 13, 0x5000, 1, 0x4000,
+    11, 0x3800, 1, 0x3000, 30, 0x2000, 1, 0x0800, 164, 0x0000, 1, 0x0800,
+    30, 0x2000, 1, 0x2800, 12, 0x3800, 13, 0x5000, 1, 0x7000, 15, 0x7800,
+    16, 0x9000, 1, 0xF1E0, 1, 0xFA00, 1, 0xB880, 58, 0xA800, 1, 0xA860,
+    1, 0xB980, 1, 0xD320, 1, 0xDC40, 1, 0xE4A0, 1, 0xF5C0, 4, 0xFE40,
+    1, 0xF5C0, 1, 0xE4A0, 1, 0xDC40, 1, 0xD320, 1, 0xB980, 1, 0xA860,
+    58, 0xA800, 1, 0xB880, 1, 0xFA00, 1, 0xF1E0, 16, 0x9000, 15, 0x7800,
+    1, 0x7000, 13, 0x5000, 12, 0x3800, 1, 0x2800, 30, 0x2000, 1, 0x0800,
+    165, 0x0000, 30, 0x2000, 1, 0x2800, 12, 0x3800, 13, 0x5000, 1, 0x6000,
+    15, 0x7800, 1, 0x8800, 15, 0x9000, 1, 0xC100, 1, 0xFA00, 1, 0xD940,
+    132, 0xA800, 1, 0xD940, 1, 0xFA00, 1, 0xC100, 15, 0x9000, 1, 0x8800,
+    15, 0x7800, 1, 0x6000, 13, 0x5000, 12, 0x3800, 1, 0x2800, 30, 0x2000,
+    166, 0x0000, 1, 0x1800, 30, 0x2000, 12, 0x3800, 1, 0x4800, 13, 0x5000,
+    16, 0x7800, 15, 0x9000, 1, 0x9020, 2, 0xFA00, 1, 0xB040, 130, 0xA800,
+    1, 0xB040, 2, 0xFA00, 1, 0x9020, 15, 0x9000, 16, 0x7800, 13, 0x5000,
+    1, 0x4800, 12, 0x3800, 30, 0x2000, 1, 0x1800, 166, 0x0000, 1, 0x1000,
+    30, 0x2000, 1, 0x3000, 11, 0x3800, 1, 0x4000, 13, 0x5000, 1, 0x7000,
+    15, 0x7800, 1, 0x8800, 15, 0x9000, 1, 0xD140, 1, 0xFA00, 1, 0xD940,
+    130, 0xA800, 1, 0xD940, 1, 0xFA00, 1, 0xD140, 15, 0x9000, 1, 0x8800,
+    15, 0x7800, 1, 0x7000, 13, 0x5000, 1, 0x4000, 11, 0x3800, 1, 0x3000,
+    30, 0x2000, 1, 0x1000, 166, 0x0000, 1, 0x0800, 30, 0x2000, 1, 0x2800,
+    12, 0x3800, 13, 0x5000, 1, 0x6000, 15, 0x7800, 1, 0x8000, 15, 0x9000,
+    1, 0x9840, 2, 0xFA00, 1, 0xB040, 128, 0xA800, 1, 0xB040, 2, 0xFA00,
+    1, 0x9840, 15, 0x9000, 1, 0x8000, 15, 0x7800, 1, 0x6000, 13, 0x5000,
+    12, 0x3800, 1, 0x2800, 30, 0x2000, 1, 0x0800, 166, 0x0000, 1, 0x0800,
+    31, 0x2000, 12, 0x3800, 1, 0x4800, 13, 0x5000, 16, 0x7800, 16, 0x9000,
+    1, 0xD140, 1, 0xFA00, 1, 0xD940, 128, 0xA800, 1, 0xD940, 1, 0xFA00,
+    1, 0xD140, 16, 0x9000, 16, 0x7800, 13, 0x5000, 1, 0x4800, 12, 0x3800,
+    31, 0x2000, 1, 0x0800, 167, 0x0000, 31, 0x2000, 12, 0x3800, 1, 0x4000,
+    13, 0x5000, 1, 0x7000, 15, 0x7800, 1, 0x8800, 15, 0x9000, 1, 0x9840,
+    1, 0xF1E0, 1, 0xFA00, 1, 0xB880, 126, 0xA800, 1, 0xB880, 1, 0xFA00,
+    1, 0xF1E0, 1, 0x9840, 15, 0x9000, 1, 0x8800, 15, 0x7800, 1, 0x7000,
+    13, 0x5000, 1, 0x4000, 12, 0x3800, 31, 0x2000, 168, 0x0000, 1, 0x1800,
+    30, 0x2000, 1, 0x3000, 12, 0x3800, 13, 0x5000, 1, 0x6000, 16, 0x7800,
+    16, 0x9000, 1, 0xC100, 1, 0xFA00, 1, 0xE180, 126, 0xA800, 1, 0xE180,
+    1, 0xFA00, 1, 0xC100, 16, 0x9000, 16, 0x7800, 1, 0x6000, 13, 0x5000,
+    12, 0x3800, 1, 0x3000, 30, 0x2000, 1, 0x1800, 168, 0x0000, 1, 0x1000,
+    30, 0x2000, 1, 0x2800, 12, 0x3800, 1, 0x4800, 13, 0x5000, 16, 0x7800,
+    1, 0x8800, 15, 0x9000, 1, 0x9020, 1, 0xF1E0, 1, 0xFA00, 1, 0xC0C0,
+    124, 0xA800, 1, 0xC0C0, 1, 0xFA00, 1, 0xF1E0, 1, 0x9020, 15, 0x9000,
+    1, 0x8800, 16, 0x7800, 13, 0x5000, 1, 0x4800, 12, 0x3800, 1, 0x2800,
+    30, 0x2000, 1, 0x1000, 168, 0x0000, 1, 0x0800, 31, 0x2000, 12, 0x3800,
+    1, 0x4000, 13, 0x5000, 1, 0x6800, 15, 0x7800, 1, 0x8000, 16, 0x9000,
+    1, 0xB0C0, 1, 0xFA00, 1, 0xF1E0, 1, 0xA820, 122, 0xA800, 1, 0xA820,
+    1, 0xF1E0, 1, 0xFA00, 1, 0xB0C0, 16, 0x9000, 1, 0x8000, 15, 0x7800,
+    1, 0x6800, 13, 0x5000, 1, 0x4000, 12, 0x3800, 31, 0x2000, 1, 0x0800,
+    169, 0x0000, 31, 0x2000, 1, 0x3000, 12, 0x3800, 13, 0x5000, 1, 0x5800,
+    16, 0x7800, 1, 0x8800, 16, 0x9000, 1, 0xD980, 1, 0xFA00, 1, 0xD120,
+    122, 0xA800, 1, 0xD120, 1, 0xFA00, 1, 0xD980, 16, 0x9000, 1, 0x8800,
+    16, 0x7800, 1, 0x5800, 13, 0x5000, 12, 0x3800, 1, 0x3000, 31, 0x2000,
+    170, 0x0000, 1, 0x1800, 30, 0x2000, 1, 0x2800, 12, 0x3800, 1, 0x4800,
+    13, 0x5000, 1, 0x7000, 15, 0x7800, 1, 0x8000, 16, 0x9000, 1, 0x9840,
+    2, 0xFA00, 1, 0xB880, 120, 0xA800, 1, 0xB880, 2, 0xFA00, 1, 0x9840,
+    16, 0x9000, 1, 0x8000, 15, 0x7800, 1, 0x7000, 13, 0x5000, 1, 0x4800,
+    12, 0x3800, 1, 0x2800, 30, 0x2000, 1, 0x1800, 170, 0x0000, 1, 0x1000,
+    31, 0x2000, 12, 0x3800, 1, 0x4000, 13, 0x5000, 1, 0x6000, 16, 0x7800,
+    1, 0x8800, 16, 0x9000, 1, 0xC100, 1, 0xFA00, 1, 0xE9C0, 1, 0xA820,
+    118, 0xA800, 1, 0xA820, 1, 0xE9C0, 1, 0xFA00, 1, 0xC100, 16, 0x9000,
+    1, 0x8800, 16, 0x7800, 1, 0x6000, 13, 0x5000, 1, 0x4000, 12, 0x3800,
+    31, 0x2000, 1, 0x1000, 170, 0x0000, 1, 0x0800, 31, 0x2000, 1, 0x3000,
+    12, 0x3800, 14, 0x5000, 1, 0x7000, 15, 0x7800, 1, 0x8000, 17, 0x9000,
+    1, 0xE1A0, 1, 0xFA00, 1, 0xD960, 118, 0xA800, 1, 0xD960, 1, 0xFA00,
+    1, 0xE1A0, 17, 0x9000, 1, 0x8000, 15, 0x7800, 1, 0x7000, 14, 0x5000,
+    12, 0x3800, 1, 0x3000, 31, 0x2000, 1, 0x0800, 171, 0x0000, 1, 0x1800,
+    30, 0x2000, 1, 0x2800, 12, 0x3800, 1, 0x4800, 13, 0x5000, 1, 0x6000,
+    16, 0x7800, 1, 0x8800, 16, 0x9000, 1, 0x9840, 1, 0xF1E0, 1, 0xFA00,
+    1, 0xC0C0, 116, 0xA800, 1, 0xC0C0, 1, 0xFA00, 1, 0xF1E0, 1, 0x9840,
+    16, 0x9000, 1, 0x8800, 16, 0x7800, 1, 0x6000, 13, 0x5000, 1, 0x4800,
+    12, 0x3800, 1, 0x2800, 30, 0x2000, 1, 0x1800, 172, 0x0000, 1, 0x1000,
+    31, 0x2000, 13, 0x3800, 14, 0x5000, 17, 0x7800, 17, 0x9000, 1, 0xB0C0,
+    1, 0xFA00, 1, 0xF1E0, 1, 0xB060, 114, 0xA800, 1, 0xB060, 1, 0xF1E0,
+    1, 0xFA00, 1, 0xB0C0, 17, 0x9000, 17, 0x7800, 14, 0x5000, 13, 0x3800,
+    31, 0x2000, 1, 0x1000, 172, 0x0000, 1, 0x0800, 31, 0x2000, 1, 0x3000,
+    12, 0x3800, 1, 0x4800, 13, 0x5000, 1, 0x6800, 16, 0x7800, 1, 0x8000,
+    17, 0x9000, 1, 0xD140, 1, 0xFA00, 1, 0xE9A0, 1, 0xA820, 112, 0xA800,
+    1, 0xA820, 1, 0xE9A0, 1, 0xFA00, 1, 0xD140, 17, 0x9000, 1, 0x8000,
+    16, 0x7800, 1, 0x6800, 13, 0x5000, 1, 0x4800, 12, 0x3800, 1, 0x3000,
+    31, 0x2000, 1, 0x0800, 173, 0x0000, 31, 0x2000, 1, 0x2800, 12, 0x3800,
+    1, 0x4000, 14, 0x5000, 17, 0x7800, 1, 0x8800, 16, 0x9000, 1, 0x9020,
+    1, 0xE1A0, 1, 0xFA00, 1, 0xD960, 112, 0xA800, 1, 0xD960, 1, 0xFA00,
+    1, 0xE1A0, 1, 0x9020, 16, 0x9000, 1, 0x8800, 17, 0x7800, 14, 0x5000,
+    1, 0x4000, 12, 0x3800, 1, 0x2800, 31, 0x2000, 174, 0x0000, 1, 0x1800,
+    31, 0x2000, 1, 0x3000, 12, 0x3800, 1, 0x4800, 13, 0x5000, 1, 0x6800,
+    16, 0x7800, 1, 0x8000, 17, 0x9000, 1, 0x9840, 1, 0xF1E0, 1, 0xFA00,
+    1, 0xD940, 110, 0xA800, 1, 0xD940, 1, 0xFA00, 1, 0xF1E0, 1, 0x9840,
+    17, 0x9000, 1, 0x8000, 16, 0x7800, 1, 0x6800, 13, 0x5000, 1, 0x4800,
+    12, 0x3800, 1, 0x3000, 31, 0x2000, 1, 0x1800, 174, 0x0000, 1, 0x0800,
+    31, 0x2000, 1, 0x2800, 12, 0x3800, 1, 0x4000, 14, 0x5000, 17, 0x7800,
+    1, 0x8800, 17, 0x9000, 1, 0xA060, 2, 0xFA00, 1, 0xC0C0, 108, 0xA800,
+    1, 0xC0C0, 2, 0xFA00, 1, 0xA060, 17, 0x9000, 1, 0x8800, 17, 0x7800,
+    14, 0x5000, 1, 0x4000, 12, 0x3800, 1, 0x2800, 31, 0x2000, 1, 0x0800,
+    175, 0x0000, 32, 0x2000, 13, 0x3800, 14, 0x5000, 1, 0x6800, 17, 0x7800,
+    18, 0x9000, 1, 0xB0C0, 2, 0xFA00, 1, 0xC0C0, 106, 0xA800, 1, 0xC0C0,
+    2, 0xFA00, 1, 0xB0C0, 18, 0x9000, 17, 0x7800, 1, 0x6800, 14, 0x5000,
+    13, 0x3800, 32, 0x2000, 176, 0x0000, 1, 0x1800, 31, 0x2000, 1, 0x3000,
+    12, 0x3800, 1, 0x4000, 14, 0x5000, 1, 0x7000, 16, 0x7800, 1, 0x8000,
+    18, 0x9000, 1, 0xB0C0, 2, 0xFA00, 1, 0xC0C0, 104, 0xA800, 1, 0xC0C0,
+    2, 0xFA00, 1, 0xB0C0, 18, 0x9000, 1, 0x8000, 16, 0x7800, 1, 0x7000,
+    14, 0x5000, 1, 0x4000, 12, 0x3800, 1, 0x3000, 31, 0x2000, 1, 0x1800,
+    176, 0x0000, 1, 0x0800, 31, 0x2000, 1, 0x2800, 13, 0x3800, 14, 0x5000,
+    1, 0x6000, 17, 0x7800, 1, 0x8800, 18, 0x9000, 1, 0xC920, 2, 0xFA00,
+    1, 0xC0C0, 102, 0xA800, 1, 0xC0C0, 2, 0xFA00, 1, 0xC920, 18, 0x9000,
+    1, 0x8800, 17, 0x7800, 1, 0x6000, 14, 0x5000, 13, 0x3800, 1, 0x2800,
+    31, 0x2000, 1, 0x0800, 177, 0x0000, 32, 0x2000, 1, 0x3000, 12, 0x3800,
+    1, 0x4000, 14, 0x5000, 1, 0x7000, 17, 0x7800, 1, 0x8800, 18, 0x9000,
+    1, 0xD140, 2, 0xFA00, 1, 0xC0C0, 100, 0xA800, 1, 0xC0C0, 2, 0xFA00,
+    1, 0xD140, 18, 0x9000, 1, 0x8800, 17, 0x7800, 1, 0x7000, 14, 0x5000,
+    1, 0x4000, 12, 0x3800, 1, 0x3000, 32, 0x2000, 178, 0x0000, 1, 0x1800,
+    31, 0x2000, 1, 0x2800, 13, 0x3800, 14, 0x5000, 1, 0x5800, 17, 0x7800,
+    1, 0x8000, 19, 0x9000, 1, 0xD140, 2, 0xFA00, 1, 0xC0C0, 98, 0xA800,
+    1, 0xC0C0, 2, 0xFA00, 1, 0xD140, 19, 0x9000, 1, 0x8000, 17, 0x7800,
+    1, 0x5800, 14, 0x5000, 13, 0x3800, 1, 0x2800, 31, 0x2000, 1, 0x1800,
+    178, 0x0000, 1, 0x0800, 32, 0x2000, 1, 0x3000, 12, 0x3800, 1, 0x4000,
+    14, 0x5000, 1, 0x6800, 17, 0x7800, 1, 0x8000, 19, 0x9000, 1, 0xC920,
+    2, 0xFA00, 1, 0xC0C0, 96, 0xA800, 1, 0xC0C0, 2, 0xFA00, 1, 0xC920,
+    19, 0x9000, 1, 0x8000, 17, 0x7800, 1, 0x6800, 14, 0x5000, 1, 0x4000,
+    12, 0x3800, 1, 0x3000, 32, 0x2000, 1, 0x0800, 179, 0x0000, 32, 0x2000,
+    1, 0x2800, 13, 0x3800, 15, 0x5000, 18, 0x7800, 1, 0x8800, 19, 0x9000,
+    1, 0xB0C0, 2, 0xFA00, 1, 0xD940, 94, 0xA800, 1, 0xD940, 2, 0xFA00,
+    1, 0xB0C0, 19, 0x9000, 1, 0x8800, 18, 0x7800, 15, 0x5000, 13, 0x3800,
+    1, 0x2800, 32, 0x2000, 180, 0x0000, 1, 0x1000, 32, 0x2000, 13, 0x3800,
+    1, 0x4000, 14, 0x5000, 1, 0x6000, 18, 0x7800, 1, 0x8800, 19, 0x9000,
+    1, 0xB0C0, 2, 0xFA00, 1, 0xD960, 1, 0xA820, 90, 0xA800, 1, 0xA820,
+    1, 0xD960, 2, 0xFA00, 1, 0xB0C0, 19, 0x9000, 1, 0x8800, 18, 0x7800,
+    1, 0x6000, 14, 0x5000, 1, 0x4000, 13, 0x3800, 32, 0x2000, 1, 0x1000,
+    180, 0x0000, 1, 0x0800, 32, 0x2000, 1, 0x2800, 13, 0x3800, 1, 0x4800,
+    14, 0x5000, 1, 0x7000, 18, 0x7800, 20, 0x9000, 1, 0xA060, 1, 0xF1E0,
+    1, 0xFA00, 1, 0xE9A0, 1, 0xB060, 88, 0xA800, 1, 0xB060, 1, 0xE9A0,
+    1, 0xFA00, 1, 0xF1E0, 1, 0xA060, 20, 0x9000, 18, 0x7800, 1, 0x7000,
+    14, 0x5000, 1, 0x4800, 13, 0x3800, 1, 0x2800, 32, 0x2000, 1, 0x0800,
+    181, 0x0000, 1, 0x1800, 32, 0x2000, 13, 0x3800, 1, 0x4000, 15, 0x5000,
+    18, 0x7800, 1, 0x8000, 20, 0x9000, 1, 0x9840, 1, 0xE1A0, 1, 0xFA00,
+    1, 0xF1E0, 1, 0xC0C0, 86, 0xA800, 1, 0xC0C0, 1, 0xF1E0, 1, 0xFA00,
+    1, 0xE1A0, 1, 0x9840, 20, 0x9000, 1, 0x8000, 18, 0x7800, 15, 0x5000,
+    1, 0x4000, 13, 0x3800, 32, 0x2000, 1, 0x1800, 182, 0x0000, 1, 0x1000,
+    32, 0x2000, 1, 0x2800, 13, 0x3800, 1, 0x4800, 14, 0x5000, 1, 0x6000,
+    18, 0x7800, 1, 0x8000, 20, 0x9000, 1, 0x9020, 1, 0xD140, 2, 0xFA00,
+    1, 0xD960, 1, 0xA820, 82, 0xA800, 1, 0xA820, 1, 0xD960, 2, 0xFA00,
+    1, 0xD140, 1, 0x9020, 20, 0x9000, 1, 0x8000, 18, 0x7800, 1, 0x6000,
+    14, 0x5000, 1, 0x4800, 13, 0x3800, 1, 0x2800, 32, 0x2000, 1, 0x1000,
+    183, 0x0000, 33, 0x2000, 1, 0x3000, 13, 0x3800, 15, 0x5000, 1, 0x7000,
+    18, 0x7800, 1, 0x8000, 21, 0x9000, 1, 0xB0C0, 1, 0xF1E0, 1, 0xFA00,
+    1, 0xE9C0, 1, 0xB880, 80, 0xA800, 1, 0xB880, 1, 0xE9C0, 1, 0xFA00,
+    1, 0xF1E0, 1, 0xB0C0, 21, 0x9000, 1, 0x8000, 18, 0x7800, 1, 0x7000,
+    15, 0x5000, 13, 0x3800, 1, 0x3000, 33, 0x2000, 184, 0x0000, 1, 0x1000,
+    32, 0x2000, 1, 0x2800, 13, 0x3800, 1, 0x4800, 15, 0x5000, 1, 0x7000,
+    18, 0x7800, 1, 0x8000, 21, 0x9000, 1, 0x9840, 1, 0xE1A0, 2, 0xFA00,
+    1, 0xD120, 1, 0xA820, 76, 0xA800, 1, 0xA820, 1, 0xD120, 2, 0xFA00,
+    1, 0xE1A0, 1, 0x9840, 21, 0x9000, 1, 0x8000, 18, 0x7800, 1, 0x7000,
+    15, 0x5000, 1, 0x4800, 13, 0x3800, 1, 0x2800, 32, 0x2000, 1, 0x1000,
+    184, 0x0000, 1, 0x0800, 33, 0x2000, 1, 0x3000, 13, 0x3800, 1, 0x4800,
+    14, 0x5000, 1, 0x5800, 19, 0x7800, 1, 0x8800, 22, 0x9000, 1, 0xC100,
+    2, 0xFA00, 1, 0xF1E0, 1, 0xC0C0, 74, 0xA800, 1, 0xC0C0, 1, 0xF1E0,
+    2, 0xFA00, 1, 0xC100, 22, 0x9000, 1, 0x8800, 19, 0x7800, 1, 0x5800,
+    14, 0x5000, 1, 0x4800, 13, 0x3800, 1, 0x3000, 33, 0x2000, 1, 0x0800,
+    185, 0x0000, 1, 0x1800, 32, 0x2000, 1, 0x2800, 13, 0x3800, 1, 0x4000,
+    15, 0x5000, 1, 0x6800, 19, 0x7800, 1, 0x8800, 22, 0x9000, 1, 0x9840,
+    1, 0xD980, 2, 0xFA00, 1, 0xE180, 1, 0xB880, 70, 0xA800, 1, 0xB880,
+    1, 0xE180, 2, 0xFA00, 1, 0xD980, 1, 0x9840, 22, 0x9000, 1, 0x8800,
+    19, 0x7800, 1, 0x6800, 15, 0x5000, 1, 0x4000, 13, 0x3800, 1, 0x2800,
+    32, 0x2000, 1, 0x1800, 186, 0x0000, 1, 0x0800, 33, 0x2000, 1, 0x3000,
+    13, 0x3800, 1, 0x4800, 15, 0x5000, 1, 0x7000, 19, 0x7800, 1, 0x8800,
+    23, 0x9000, 1, 0xB0C0, 1, 0xF1E0, 2, 0xFA00, 1, 0xD940, 1, 0xB040,
+    66, 0xA800, 1, 0xB040, 1, 0xD940, 2, 0xFA00, 1, 0xF1E0, 1, 0xB0C0,
+    23, 0x9000, 1, 0x8800, 19, 0x7800, 1, 0x7000, 15, 0x5000, 1, 0x4800,
+    13, 0x3800, 1, 0x3000, 33, 0x2000, 1, 0x0800, 187, 0x0000, 1, 0x1800,
+    33, 0x2000, 14, 0x3800, 16, 0x5000, 1, 0x7000, 19, 0x7800, 1, 0x8000,
+    23, 0x9000, 1, 0x9020, 1, 0xC100, 1, 0xF1E0, 2, 0xFA00, 1, 0xD940,
+    1, 0xB040, 62, 0xA800, 1, 0xB040, 1, 0xD940, 2, 0xFA00, 1, 0xF1E0,
+    1, 0xC100, 1, 0x9020, 23, 0x9000, 1, 0x8000, 19, 0x7800, 1, 0x7000,
+    16, 0x5000, 14, 0x3800, 33, 0x2000, 1, 0x1800, 188, 0x0000, 1, 0x1000,
+    33, 0x2000, 1, 0x3000, 13, 0x3800, 1, 0x4000, 15, 0x5000, 1, 0x5800,
+    20, 0x7800, 1, 0x8000, 24, 0x9000, 1, 0x9840, 1, 0xD140, 3, 0xFA00,
+    1, 0xD940, 1, 0xB880, 58, 0xA800, 1, 0xB880, 1, 0xD940, 3, 0xFA00,
+    1, 0xD140, 1, 0x9840, 24, 0x9000, 1, 0x8000, 20, 0x7800, 1, 0x5800,
+    15, 0x5000, 1, 0x4000, 13, 0x3800, 1, 0x3000, 33, 0x2000, 1, 0x1000,
+    189, 0x0000, 34, 0x2000, 1, 0x3000, 13, 0x3800, 1, 0x4800, 15, 0x5000,
+    1, 0x5800, 20, 0x7800, 1, 0x8000, 25, 0x9000, 1, 0x9840, 1, 0xD140,
+    3, 0xFA00, 1, 0xE9A0, 1, 0xC0C0, 1, 0xA820, 52, 0xA800, 1, 0xA820,
+    1, 0xC0C0, 1, 0xE9A0, 3, 0xFA00, 1, 0xD140, 1, 0x9840, 25, 0x9000,
+    1, 0x8000, 20, 0x7800, 1, 0x5800, 15, 0x5000, 1, 0x4800, 13, 0x3800,
+    1, 0x3000, 34, 0x2000, 190, 0x0000, 1, 0x1000, 33, 0x2000, 1, 0x2800,
+    14, 0x3800, 1, 0x4800, 15, 0x5000, 1, 0x6800, 20, 0x7800, 1, 0x8000,
+    26, 0x9000, 1, 0x9020, 1, 0xC100, 1, 0xF1E0, 2, 0xFA00, 1, 0xF1E0,
+    1, 0xD940, 1, 0xB060, 48, 0xA800, 1, 0xB060, 1, 0xD940, 1, 0xF1E0,
+    2, 0xFA00, 1, 0xF1E0, 1, 0xC100, 1, 0x9020, 26, 0x9000, 1, 0x8000,
+    20, 0x7800, 1, 0x6800, 15, 0x5000, 1, 0x4800, 14, 0x3800, 1, 0x2800,
+    33, 0x2000, 1, 0x1000, 191, 0x0000, 34, 0x2000, 1, 0x3000, 13, 0x3800,
+    1, 0x4000, 16, 0x5000, 1, 0x6800, 21, 0x7800, 1, 0x8800, 27, 0x9000,
+    1, 0xB0C0, 1, 0xE1A0, 3, 0xFA00, 1, 0xE9C0, 1, 0xD120, 1, 0xB060,
+    42, 0xA800, 1, 0xB060, 1, 0xD120, 1, 0xE9C0, 3, 0xFA00, 1, 0xE1A0,
+    1, 0xB0C0, 27, 0x9000, 1, 0x8800, 21, 0x7800, 1, 0x6800, 16, 0x5000,
+    1, 0x4000, 13, 0x3800, 1, 0x3000, 34, 0x2000, 192, 0x0000, 1, 0x1000,
+    34, 0x2000, 14, 0x3800, 1, 0x4000, 16, 0x5000, 1, 0x7000, 21, 0x7800,
+    1, 0x8800, 28, 0x9000, 1, 0x9840, 1, 0xC920, 1, 0xE9C0, 3, 0xFA00,
+    1, 0xF1E0, 1, 0xD940, 1, 0xC0C0, 1, 0xB040, 34, 0xA800, 1, 0xB040,
+    1, 0xC0C0, 1, 0xD940, 1, 0xF1E0, 3, 0xFA00, 1, 0xE9C0, 1, 0xC920,
+    1, 0x9840, 28, 0x9000, 1, 0x8800, 21, 0x7800, 1, 0x7000, 16, 0x5000,
+    1, 0x4000, 14, 0x3800, 34, 0x2000, 1, 0x1000, 193, 0x0000, 34, 0x2000,
+    1, 0x2800, 14, 0x3800, 1, 0x4800, 16, 0x5000, 1, 0x7000, 21, 0x7800,
+    1, 0x8000, 30, 0x9000, 1, 0xA060, 1, 0xC920, 1, 0xE9C0, 4, 0xFA00,
+    1, 0xE9C0, 1, 0xD960, 1, 0xD100, 1, 0xB880, 1, 0xA820, 24, 0xA800,
+    1, 0xA820, 1, 0xB880, 1, 0xD100, 1, 0xD960, 1, 0xE9C0, 4, 0xFA00,
+    1, 0xE9C0, 1, 0xC920, 1, 0xA060, 30, 0x9000, 1, 0x8000, 21, 0x7800,
+    1, 0x7000, 16, 0x5000, 1, 0x4800, 14, 0x3800, 1, 0x2800, 34, 0x2000,
+    194, 0x0000, 1, 0x1000, 34, 0x2000, 1, 0x3000, 14, 0x3800, 1, 0x4800,
+    16, 0x5000, 1, 0x7000, 21, 0x7800, 1, 0x8000, 1, 0x8800, 31, 0x9000,
+    1, 0x9840, 1, 0xB8E0, 1, 0xD160, 1, 0xF1E0, 5, 0xFA00, 1, 0xF1E0,
+    1, 0xE180, 1, 0xD940, 1, 0xD100, 1, 0xC0C0, 2, 0xB880, 1, 0xB060,
+    8, 0xA800, 1, 0xB060, 2, 0xB880, 1, 0xC0C0, 1, 0xD100, 1, 0xD940,
+    1, 0xE180, 1, 0xF1E0, 5, 0xFA00, 1, 0xF1E0, 1, 0xD160, 1, 0xB8E0,
+    1, 0x9840, 31, 0x9000, 1, 0x8800, 1, 0x8000, 21, 0x7800, 1, 0x7000,
+    16, 0x5000, 1, 0x4800, 14, 0x3800, 1, 0x3000, 34, 0x2000, 1, 0x1000,
+    195, 0x0000, 35, 0x2000, 15, 0x3800, 17, 0x5000, 1, 0x7000, 22, 0x7800,
+    1, 0x8800, 34, 0x9000, 1, 0xA060, 1, 0xB0C0, 1, 0xC920, 1, 0xD980,
+    26, 0xFA00, 1, 0xD980, 1, 0xC920, 1, 0xB0C0, 1, 0xA060, 34, 0x9000,
+    1, 0x8800, 22, 0x7800, 1, 0x7000, 17, 0x5000, 15, 0x3800, 35, 0x2000,
+    196, 0x0000, 1, 0x1000, 34, 0x2000, 1, 0x2800, 14, 0x3800, 1, 0x4000,
+    17, 0x5000, 1, 0x7000, 22, 0x7800, 1, 0x8000, 38, 0x9000, 1, 0x9840,
+    1, 0xA880, 1, 0xB8E0, 1, 0xC100, 1, 0xD140, 2, 0xD980, 1, 0xE1A0,
+    8, 0xFA00, 1, 0xE1A0, 2, 0xD980, 1, 0xD140, 1, 0xC100, 1, 0xB8E0,
+    1, 0xA880, 1, 0x9840, 38, 0x9000, 1, 0x8000, 22, 0x7800, 1, 0x7000,
+    17, 0x5000, 1, 0x4000, 14, 0x3800, 1, 0x2800, 34, 0x2000, 1, 0x1000,
+    197, 0x0000, 1, 0x1800, 34, 0x2000, 1, 0x3000, 14, 0x3800, 1, 0x4000,
+    17, 0x5000, 1, 0x7000, 23, 0x7800, 1, 0x8800, 96, 0x9000, 1, 0x8800,
+    23, 0x7800, 1, 0x7000, 17, 0x5000, 1, 0x4000, 14, 0x3800, 1, 0x3000,
+    34, 0x2000, 1, 0x1800, 198, 0x0000, 1, 0x1000, 35, 0x2000, 1, 0x3000,
+    14, 0x3800, 1, 0x4800, 17, 0x5000, 1, 0x7000, 23, 0x7800, 1, 0x8000,
+    1, 0x8800, 92, 0x9000, 1, 0x8800, 1, 0x8000, 23, 0x7800, 1, 0x7000,
+    17, 0x5000, 1, 0x4800, 14, 0x3800, 1, 0x3000, 35, 0x2000, 1, 0x1000,
+    199, 0x0000, 1, 0x1800, 34, 0x2000, 1, 0x2800, 15, 0x3800, 1, 0x4800,
+    17, 0x5000, 1, 0x7000, 24, 0x7800, 1, 0x8000, 90, 0x9000, 1, 0x8000,
+    24, 0x7800, 1, 0x7000, 17, 0x5000, 1, 0x4800, 15, 0x3800, 1, 0x2800,
+    34, 0x2000, 1, 0x1800, 200, 0x0000, 1, 0x0800, 35, 0x2000, 1, 0x2800,
+    15, 0x3800, 1, 0x4800, 17, 0x5000, 1, 0x6800, 25, 0x7800, 1, 0x8800,
+    86, 0x9000, 1, 0x8800, 25, 0x7800, 1, 0x6800, 17, 0x5000, 1, 0x4800,
+    15, 0x3800, 1, 0x2800, 35, 0x2000, 1, 0x0800, 201, 0x0000, 1, 0x1800,
+    35, 0x2000, 1, 0x3000, 15, 0x3800, 1, 0x4800, 17, 0x5000, 1, 0x6800,
+    25, 0x7800, 1, 0x8000, 1, 0x8800, 82, 0x9000, 1, 0x8800, 1, 0x8000,
+    25, 0x7800, 1, 0x6800, 17, 0x5000, 1, 0x4800, 15, 0x3800, 1, 0x3000,
+    35, 0x2000, 1, 0x1800, 202, 0x0000, 1, 0x0800, 36, 0x2000, 1, 0x3000,
+    14, 0x3800, 1, 0x4000, 18, 0x5000, 1, 0x5800, 26, 0x7800, 1, 0x8000,
+    1, 0x8800, 78, 0x9000, 1, 0x8800, 1, 0x8000, 26, 0x7800, 1, 0x5800,
+    18, 0x5000, 1, 0x4000, 14, 0x3800, 1, 0x3000, 36, 0x2000, 1, 0x0800,
+    203, 0x0000, 1, 0x1000, 36, 0x2000, 15, 0x3800, 1, 0x4000, 18, 0x5000,
+    1, 0x5800, 1, 0x7000, 26, 0x7800, 1, 0x8000, 1, 0x8800, 74, 0x9000,
+    1, 0x8800, 1, 0x8000, 26, 0x7800, 1, 0x7000, 1, 0x5800, 18, 0x5000,
+    1, 0x4000, 15, 0x3800, 36, 0x2000, 1, 0x1000, 205, 0x0000, 1, 0x1800,
+    35, 0x2000, 1, 0x2800, 15, 0x3800, 1, 0x4000, 19, 0x5000, 1, 0x7000,
+    28, 0x7800, 1, 0x8800, 70, 0x9000, 1, 0x8800, 28, 0x7800, 1, 0x7000,
+    19, 0x5000, 1, 0x4000, 15, 0x3800, 1, 0x2800, 35, 0x2000, 1, 0x1800,
+    206, 0x0000, 1, 0x1000, 36, 0x2000, 1, 0x2800, 15, 0x3800, 1, 0x4000,
+    19, 0x5000, 1, 0x6800, 29, 0x7800, 1, 0x8000, 1, 0x8800, 64, 0x9000,
+    1, 0x8800, 1, 0x8000, 29, 0x7800, 1, 0x6800, 19, 0x5000, 1, 0x4000,
+    15, 0x3800, 1, 0x2800, 36, 0x2000, 1, 0x1000, 207, 0x0000, 1, 0x1800,
+    36, 0x2000, 1, 0x3000, 15, 0x3800, 1, 0x4000, 19, 0x5000, 1, 0x5800,
+    1, 0x7000, 30, 0x7800, 1, 0x8800, 60, 0x9000, 1, 0x8800, 30, 0x7800,
+    1, 0x7000, 1, 0x5800, 19, 0x5000, 1, 0x4000, 15, 0x3800, 1, 0x3000,
+    36, 0x2000, 1, 0x1800, 208, 0x0000, 1, 0x0800, 37, 0x2000, 1, 0x3000,
+    15, 0x3800, 1, 0x4000, 20, 0x5000, 1, 0x7000, 31, 0x7800, 1, 0x8000,
+    1, 0x8800, 54, 0x9000, 1, 0x8800, 1, 0x8000, 31, 0x7800, 1, 0x7000,
+    20, 0x5000, 1, 0x4000, 15, 0x3800, 1, 0x3000, 37, 0x2000, 1, 0x0800,
+    209, 0x0000, 1, 0x1000, 37, 0x2000, 1, 0x3000, 15, 0x3800, 1, 0x4000,
+    1, 0x4800, 19, 0x5000, 1, 0x6000, 34, 0x7800, 1, 0x8000, 1, 0x8800,
+    46, 0x9000, 1, 0x8800, 1, 0x8000, 34, 0x7800, 1, 0x6000, 19, 0x5000,
+    1, 0x4800, 1, 0x4000, 15, 0x3800, 1, 0x3000, 37, 0x2000, 1, 0x1000,
+    211, 0x0000, 1, 0x1800, 37, 0x2000, 1, 0x3000, 16, 0x3800, 1, 0x4800,
+    20, 0x5000, 1, 0x7000, 35, 0x7800, 2, 0x8000, 1, 0x8800, 38, 0x9000,
+    1, 0x8800, 2, 0x8000, 35, 0x7800, 1, 0x7000, 20, 0x5000, 1, 0x4800,
+    16, 0x3800, 1, 0x3000, 37, 0x2000, 1, 0x1800, 212, 0x0000, 1, 0x0800,
+    38, 0x2000, 1, 0x3000, 16, 0x3800, 1, 0x4800, 20, 0x5000, 1, 0x6000,
+    39, 0x7800, 1, 0x8000, 2, 0x8800, 28, 0x9000, 2, 0x8800, 1, 0x8000,
+    39, 0x7800, 1, 0x6000, 20, 0x5000, 1, 0x4800, 16, 0x3800, 1, 0x3000,
+    38, 0x2000, 1, 0x0800, 213, 0x0000, 1, 0x1000, 37, 0x2000, 1, 0x2800,
+    17, 0x3800, 1, 0x4800, 21, 0x5000, 1, 0x6800, 43, 0x7800, 3, 0x8000,
+    4, 0x8800, 8, 0x9000, 4, 0x8800, 3, 0x8000, 43, 0x7800, 1, 0x6800,
+    21, 0x5000, 1, 0x4800, 17, 0x3800, 1, 0x2800, 37, 0x2000, 1, 0x1000,
+    215, 0x0000, 1, 0x1800, 37, 0x2000, 1, 0x2800, 17, 0x3800, 1, 0x4000,
+    21, 0x5000, 1, 0x5800, 1, 0x7000, 104, 0x7800, 1, 0x7000, 1, 0x5800,
+    21, 0x5000, 1, 0x4000, 17, 0x3800, 1, 0x2800, 37, 0x2000, 1, 0x1800,
+    216, 0x0000, 1, 0x0800, 38, 0x2000, 1, 0x2800, 17, 0x3800, 1, 0x4000,
+    22, 0x5000, 1, 0x6000, 1, 0x7000, 100, 0x7800, 1, 0x7000, 1, 0x6000,
+    22, 0x5000, 1, 0x4000, 17, 0x3800, 1, 0x2800, 38, 0x2000, 1, 0x0800,
+    217, 0x0000, 1, 0x1000, 38, 0x2000, 1, 0x2800, 18, 0x3800, 1, 0x4800,
+    22, 0x5000, 1, 0x6800, 98, 0x7800, 1, 0x6800, 22, 0x5000, 1, 0x4800,
+    18, 0x3800, 1, 0x2800, 38, 0x2000, 1, 0x1000, 219, 0x0000, 1, 0x1800,
+    38, 0x2000, 1, 0x2800, 18, 0x3800, 1, 0x4800, 23, 0x5000, 1, 0x6800,
+    94, 0x7800, 1, 0x6800, 23, 0x5000, 1, 0x4800, 18, 0x3800, 1, 0x2800,
+    38, 0x2000, 1, 0x1800, 221, 0x0000, 1, 0x1800, 38, 0x2000, 1, 0x2800,
+    1, 0x3000, 17, 0x3800, 1, 0x4000, 24, 0x5000, 1, 0x6800, 90, 0x7800,
+    1, 0x6800, 24, 0x5000, 1, 0x4000, 17, 0x3800, 1, 0x3000, 1, 0x2800,
+    38, 0x2000, 1, 0x1800, 222, 0x0000, 1, 0x0800, 40, 0x2000, 1, 0x3000,
+    17, 0x3800, 1, 0x4000, 1, 0x4800, 24, 0x5000, 1, 0x6000, 1, 0x7000,
+    84, 0x7800, 1, 0x7000, 1, 0x6000, 24, 0x5000, 1, 0x4800, 1, 0x4000,
+    17, 0x3800, 1, 0x3000, 40, 0x2000, 1, 0x0800, 223, 0x0000, 1, 0x1000,
+    40, 0x2000, 1, 0x3000, 18, 0x3800, 1, 0x4800, 25, 0x5000, 1, 0x6000,
+    1, 0x7000, 80, 0x7800, 1, 0x7000, 1, 0x6000, 25, 0x5000, 1, 0x4800,
+    18, 0x3800, 1, 0x3000, 40, 0x2000, 1, 0x1000, 225, 0x0000, 1, 0x1800,
+    40, 0x2000, 1, 0x3000, 18, 0x3800, 1, 0x4000, 26, 0x5000, 1, 0x5800,
+    1, 0x6800, 76, 0x7800, 1, 0x6800, 1, 0x5800, 26, 0x5000, 1, 0x4000,
+    18, 0x3800, 1, 0x3000, 40, 0x2000, 1, 0x1800, 227, 0x0000, 1, 0x1800,
+    40, 0x2000, 1, 0x3000, 19, 0x3800, 1, 0x4800, 27, 0x5000, 1, 0x6000,
+    1, 0x7000, 70, 0x7800, 1, 0x7000, 1, 0x6000, 27, 0x5000, 1, 0x4800,
+    19, 0x3800, 1, 0x3000, 40, 0x2000, 1, 0x1800, 228, 0x0000, 1, 0x0800,
+    41, 0x2000, 1, 0x2800, 19, 0x3800, 1, 0x4000, 1, 0x4800, 28, 0x5000,
+    1, 0x6000, 1, 0x7000, 64, 0x7800, 1, 0x7000, 1, 0x6000, 28, 0x5000,
+    1, 0x4800, 1, 0x4000, 19, 0x3800, 1, 0x2800, 41, 0x2000, 1, 0x0800,
+    229, 0x0000, 1, 0x1000, 41, 0x2000, 1, 0x2800, 20, 0x3800, 1, 0x4800,
+    30, 0x5000, 1, 0x6000, 1, 0x7000, 58, 0x7800, 1, 0x7000, 1, 0x6000,
+    30, 0x5000, 1, 0x4800, 20, 0x3800, 1, 0x2800, 41, 0x2000, 1, 0x1000,
+    231, 0x0000, 1, 0x1000, 42, 0x2000, 1, 0x3000, 20, 0x3800, 1, 0x4800,
+    31, 0x5000, 1, 0x5800, 1, 0x6800, 1, 0x7000, 50, 0x7800, 1, 0x7000,
+    1, 0x6800, 1, 0x5800, 31, 0x5000, 1, 0x4800, 20, 0x3800, 1, 0x3000,
+    42, 0x2000, 1, 0x1000, 233, 0x0000, 1, 0x1800, 42, 0x2000, 1, 0x3000,
+    20, 0x3800, 1, 0x4000, 1, 0x4800, 33, 0x5000, 1, 0x5800, 1, 0x6000,
+    1, 0x6800, 42, 0x7800, 1, 0x6800, 1, 0x6000, 1, 0x5800, 33, 0x5000,
+    1, 0x4800, 1, 0x4000, 20, 0x3800, 1, 0x3000, 42, 0x2000, 1, 0x1800,
+    235, 0x0000, 1, 0x1800, 42, 0x2000, 1, 0x2800, 21, 0x3800, 1, 0x4000,
+    37, 0x5000, 1, 0x5800, 1, 0x6000, 1, 0x6800, 1, 0x7000, 30, 0x7800,
+    1, 0x7000, 1, 0x6800, 1, 0x6000, 1, 0x5800, 37, 0x5000, 1, 0x4000,
+    21, 0x3800, 1, 0x2800, 42, 0x2000, 1, 0x1800, 237, 0x0000, 1, 0x1800,
+    42, 0x2000, 1, 0x2800, 1, 0x3000, 21, 0x3800, 1, 0x4000, 41, 0x5000,
+    2, 0x5800, 2, 0x6000, 4, 0x6800, 10, 0x7800, 4, 0x6800, 2, 0x6000,
+    2, 0x5800, 41, 0x5000, 1, 0x4000, 21, 0x3800, 1, 0x3000, 1, 0x2800,
+    42, 0x2000, 1, 0x1800, 238, 0x0000, 1, 0x0800, 44, 0x2000, 1, 0x3000,
+    22, 0x3800, 1, 0x4000, 104, 0x5000, 1, 0x4000, 22, 0x3800, 1, 0x3000,
+    44, 0x2000, 1, 0x0800, 239, 0x0000, 1, 0x0800, 44, 0x2000, 1, 0x2800,
+    23, 0x3800, 1, 0x4000, 100, 0x5000, 1, 0x4000, 23, 0x3800, 1, 0x2800,
+    44, 0x2000, 1, 0x0800, 241, 0x0000, 1, 0x1000, 45, 0x2000, 1, 0x3000,
+    23, 0x3800, 1, 0x4000, 1, 0x4800, 94, 0x5000, 1, 0x4800, 1, 0x4000,
+    23, 0x3800, 1, 0x3000, 45, 0x2000, 1, 0x1000, 243, 0x0000, 1, 0x1000,
+    45, 0x2000, 1, 0x2800, 24, 0x3800, 1, 0x4000, 1, 0x4800, 90, 0x5000,
+    1, 0x4800, 1, 0x4000, 24, 0x3800, 1, 0x2800, 45, 0x2000, 1, 0x1000,
+    245, 0x0000, 1, 0x1000, 46, 0x2000, 1, 0x3000, 25, 0x3800, 1, 0x4800,
+    86, 0x5000, 1, 0x4800, 25, 0x3800, 1, 0x3000, 46, 0x2000, 1, 0x1000,
+    247, 0x0000, 1, 0x1000, 46, 0x2000, 1, 0x2800, 1, 0x3000, 25, 0x3800,
+    1, 0x4000, 1, 0x4800, 80, 0x5000, 1, 0x4800, 1, 0x4000, 25, 0x3800,
+    1, 0x3000, 1, 0x2800, 46, 0x2000, 1, 0x1000, 249, 0x0000, 1, 0x1800,
+    47, 0x2000, 1, 0x3000, 27, 0x3800, 1, 0x4000, 1, 0x4800, 74, 0x5000,
+    1, 0x4800, 1, 0x4000, 27, 0x3800, 1, 0x3000, 47, 0x2000, 1, 0x1800,
+    251, 0x0000, 1, 0x1800, 48, 0x2000, 1, 0x3000, 28, 0x3800, 1, 0x4000,
+    1, 0x4800, 68, 0x5000, 1, 0x4800, 1, 0x4000, 28, 0x3800, 1, 0x3000,
+    48, 0x2000, 1, 0x1800, 253, 0x0000, 1, 0x1800, 48, 0x2000, 1, 0x2800,
+    1, 0x3000, 29, 0x3800, 1, 0x4000, 1, 0x4800, 62, 0x5000, 1, 0x4800,
+    1, 0x4000, 29, 0x3800, 1, 0x3000, 1, 0x2800, 48, 0x2000, 1, 0x1800,
+    255, 0x0000, 1, 0x1800, 49, 0x2000, 1, 0x2800, 1, 0x3000, 31, 0x3800,
+    1, 0x4000, 1, 0x4800, 54, 0x5000, 1, 0x4800, 1, 0x4000, 31, 0x3800,
+    1, 0x3000, 1, 0x2800, 49, 0x2000, 1, 0x1800, 257, 0x0000, 1, 0x1000,
+    50, 0x2000, 1, 0x2800, 34, 0x3800, 2, 0x4000, 1, 0x4800, 44, 0x5000,
+    1, 0x4800, 2, 0x4000, 34, 0x3800, 1, 0x2800, 50, 0x2000, 1, 0x1000,
+    259, 0x0000, 1, 0x1000, 51, 0x2000, 1, 0x2800, 37, 0x3800, 2, 0x4000,
+    2, 0x4800, 32, 0x5000, 2, 0x4800, 2, 0x4000, 37, 0x3800, 1, 0x2800,
+    51, 0x2000, 1, 0x1000, 261, 0x0000, 1, 0x1000, 52, 0x2000, 1, 0x2800,
+    1, 0x3000, 42, 0x3800, 3, 0x4000, 4, 0x4800, 10, 0x5000, 4, 0x4800,
+    3, 0x4000, 42, 0x3800, 1, 0x3000, 1, 0x2800, 52, 0x2000, 1, 0x1000,
+    263, 0x0000, 1, 0x1000, 53, 0x2000, 1, 0x2800, 1, 0x3000, 104, 0x3800,
+    1, 0x3000, 1, 0x2800, 53, 0x2000, 1, 0x1000, 265, 0x0000, 1, 0x0800,
+    54, 0x2000, 1, 0x2800, 1, 0x3000, 100, 0x3800, 1, 0x3000, 1, 0x2800,
+    54, 0x2000, 1, 0x0800, 267, 0x0000, 1, 0x0800, 1, 0x1800, 55, 0x2000,
+    1, 0x2800, 1, 0x3000, 94, 0x3800, 1, 0x3000, 1, 0x2800, 55, 0x2000,
+    1, 0x1800, 1, 0x0800, 270, 0x0000, 1, 0x1800, 56, 0x2000, 1, 0x2800,
+    1, 0x3000, 90, 0x3800, 1, 0x3000, 1, 0x2800, 56, 0x2000, 1, 0x1800,
+    273, 0x0000, 1, 0x1800, 58, 0x2000, 1, 0x2800, 1, 0x3000, 84, 0x3800,
+    1, 0x3000, 1, 0x2800, 58, 0x2000, 1, 0x1800, 275, 0x0000, 1, 0x1000,
+    60, 0x2000, 1, 0x2800, 1, 0x3000, 78, 0x3800, 1, 0x3000, 1, 0x2800,
+    60, 0x2000, 1, 0x1000, 277, 0x0000, 1, 0x1000, 62, 0x2000, 1, 0x2800,
+    1, 0x3000, 72, 0x3800, 1, 0x3000, 1, 0x2800, 62, 0x2000, 1, 0x1000,
+    279, 0x0000, 1, 0x0800, 1, 0x1800, 64, 0x2000, 1, 0x2800, 1, 0x3000,
+    64, 0x3800, 1, 0x3000, 1, 0x2800, 64, 0x2000, 1, 0x1800, 1, 0x0800,
+    282, 0x0000, 1, 0x1800, 66, 0x2000, 2, 0x2800, 1, 0x3000, 56, 0x3800,
+    1, 0x3000, 2, 0x2800, 66, 0x2000, 1, 0x1800, 285, 0x0000, 1, 0x1000,
+    70, 0x2000, 1, 0x2800, 2, 0x3000, 46, 0x3800, 2, 0x3000, 1, 0x2800,
+    70, 0x2000, 1, 0x1000, 287, 0x0000, 1, 0x0800, 1, 0x1800, 73, 0x2000,
+    2, 0x2800, 2, 0x3000, 34, 0x3800, 2, 0x3000, 2, 0x2800, 73, 0x2000,
+    1, 0x1800, 1, 0x0800, 290, 0x0000, 1, 0x1800, 80, 0x2000, 3, 0x2800,
+    5, 0x3000, 10, 0x3800, 5, 0x3000, 3, 0x2800, 80, 0x2000, 1, 0x1800,
+    293, 0x0000, 1, 0x1000, 184, 0x2000, 1, 0x1000, 295, 0x0000, 1, 0x0800,
+    1, 0x1800, 180, 0x2000, 1, 0x1800, 1, 0x0800, 298, 0x0000, 1, 0x1000,
+    178, 0x2000, 1, 0x1000, 301, 0x0000, 1, 0x0800, 1, 0x1800, 174, 0x2000,
+    1, 0x1800, 1, 0x0800, 304, 0x0000, 1, 0x1000, 172, 0x2000, 1, 0x1000,
+    307, 0x0000, 1, 0x0800, 1, 0x1800, 168, 0x2000, 1, 0x1800, 1, 0x0800,
+    310, 0x0000, 1, 0x1000, 1, 0x1800, 164, 0x2000, 1, 0x1800, 1, 0x1000,
+    314, 0x0000, 1, 0x1000, 162, 0x2000, 1, 0x1000, 317, 0x0000, 1, 0x0800,
+    1, 0x1800, 158, 0x2000, 1, 0x1800, 1, 0x0800, 320, 0x0000, 1, 0x0800,
+    1, 0x1800, 154, 0x2000, 1, 0x1800, 1, 0x0800, 324, 0x0000, 1, 0x1000,
+    1, 0x1800, 150, 0x2000, 1, 0x1800, 1, 0x1000, 328, 0x0000, 1, 0x1000,
+    148, 0x2000, 1, 0x1000, 332, 0x0000, 1, 0x1000, 144, 0x2000, 1, 0x1000,
+    336, 0x0000, 1, 0x1000, 140, 0x2000, 1, 0x1000, 340, 0x0000, 1, 0x1000,
+    136, 0x2000, 1, 0x1000, 344, 0x0000, 1, 0x1000, 1, 0x1800, 130, 0x2000,
+    1, 0x1800, 1, 0x1000, 348, 0x0000, 1, 0x0800, 1, 0x1800, 126, 0x2000,
+    1, 0x1800, 1, 0x0800, 352, 0x0000, 1, 0x0800, 1, 0x1000, 122, 0x2000,
+    1, 0x1000, 1, 0x0800, 357, 0x0000, 1, 0x1000, 1, 0x1800, 116, 0x2000,
+    1, 0x1800, 1, 0x1000, 362, 0x0000, 1, 0x0800, 1, 0x1000, 112, 0x2000,
+    1, 0x1000, 1, 0x0800, 367, 0x0000, 1, 0x0800, 1, 0x1800, 106, 0x2000,
+    1, 0x1800, 1, 0x0800, 373, 0x0000, 1, 0x0800, 1, 0x1800, 100, 0x2000,
+    1, 0x1800, 1, 0x0800, 379, 0x0000, 1, 0x0800, 1, 0x1800, 94, 0x2000,
+    1, 0x1800, 1, 0x0800, 385, 0x0000, 1, 0x0800, 1, 0x1000, 1, 0x1800,
+    86, 0x2000, 1, 0x1800, 1, 0x1000, 1, 0x0800, 391, 0x0000, 1, 0x0800,
+    1, 0x1000, 1, 0x1800, 80, 0x2000, 1, 0x1800, 1, 0x1000, 1, 0x0800,
+    398, 0x0000, 1, 0x0800, 1, 0x1000, 1, 0x1800, 72, 0x2000, 1, 0x1800,
+    1, 0x1000, 1, 0x0800, 406, 0x0000, 2, 0x0800, 1, 0x1000, 1, 0x1800,
+    62, 0x2000, 1, 0x1800, 1, 0x1000, 2, 0x0800, 415, 0x0000, 2, 0x0800,
+    1, 0x1000, 1, 0x1800, 52, 0x2000, 1, 0x1800, 1, 0x1000, 2, 0x0800,
+    426, 0x0000, 2, 0x0800, 1, 0x1000, 2, 0x1800, 38, 0x2000, 2, 0x1800,
+    1, 0x1000, 2, 0x0800, 440, 0x0000, 2, 0x0800, 3, 0x1000, 5, 0x1800,
+    12, 0x2000, 5, 0x1800, 3, 0x1000, 2, 0x0800, 38624, 0x0000,
+};
+
+#endif // SPLASH_FRAME_H
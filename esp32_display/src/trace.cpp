@@ -0,0 +1,163 @@
+/**
+ * Chrome-trace event recorder - see trace.h
+ */
+
+#include "trace.h"
+
+#if TRACE_ENABLED
+
+#include <esp_heap_caps.h>
+#include "log_sink.h"
+
+#define TRACE_MAX_THREADS   16      // Distinct (core, task) pairs named in a dump
+
+static_assert((TRACE_CAPACITY & (TRACE_CAPACITY - 1)) == 0, "TRACE_CAPACITY must be a power of two");
+
+typedef struct {
+    uint32_t start_us;      // Low 32 bits of esp_timer_get_time(), wraps every 71 minutes
+    uint32_t dur_us;
+    const char *name;
+    TaskHandle_t task;
+    int32_t arg;
+    uint8_t core;
+    uint8_t instant;
+    uint16_t reserved;
+} TraceEvent;
+
+static_assert(sizeof(TraceEvent) == 24, "Keep trace records small");
+
+static TraceEvent *ring = NULL;
+static uint32_t ring_head = 0;          // Total events ever claimed; slot = head % TRACE_CAPACITY
+static volatile bool recording = false;
+
+bool trace_init(void)
+{
+    if (ring != NULL) {
+        return true;
+    }
+    ring = (TraceEvent *)heap_caps_calloc(TRACE_CAPACITY, sizeof(TraceEvent), MALLOC_CAP_SPIRAM);
+    if (ring == NULL) {
+        LOG("ERROR: Failed to allocate trace buffer in PSRAM!");
+        return false;
+    }
+    recording = true;
+    return true;
+}
+
+static void record(const char *name, uint32_t start_us, uint32_t dur_us, int32_t arg, bool instant)
+{
+    if (!recording) {
+        return;
+    }
+    uint32_t slot = __atomic_fetch_add(&ring_head, 1, __ATOMIC_RELAXED) & (TRACE_CAPACITY - 1);
+    TraceEvent *e = &ring[slot];
+    e->start_us = start_us;
+    e->dur_us = dur_us;
+    e->name = name;
+    e->task = xTaskGetCurrentTaskHandle();
+    e->arg = arg;
+    e->core = (uint8_t)xPortGetCoreID();
+    e->instant = instant;
+}
+
+void trace_span(const char *name, int64_t start_us, int32_t arg)
+{
+    int64_t now_us = esp_timer_get_time();
+    record(name, (uint32_t)start_us, (uint32_t)(now_us - start_us), arg, false);
+}
+
+void trace_instant(const char *name, int32_t arg)
+{
+    record(name, (uint32_t)esp_timer_get_time(), 0, arg, true);
+}
+
+/* JSON dump */
+
+typedef struct {
+    uint8_t core;
+    TaskHandle_t task;
+} TraceThread;
+
+static int thread_id(TraceThread *threads, int *thread_count, uint8_t core, TaskHandle_t task)
+{
+    for (int i = 0; i < *thread_count; i++) {
+        if (threads[i].core == core && threads[i].task == task) {
+            return i + 1;
+        }
+    }
+    if (*thread_count == TRACE_MAX_THREADS) {
+        return 0;
+    }
+    threads[*thread_count].core = core;
+    threads[*thread_count].task = task;
+    return ++(*thread_count);
+}
+
+size_t trace_write_json(Print &out)
+{
+    if (ring == NULL) {
+        return out.print("{\"traceEvents\":[]}\n");
+    }
+
+    // Stop new events and let writers that already claimed a slot finish
+    recording = false;
+    delay(2);
+
+    uint32_t head = __atomic_load_n(&ring_head, __ATOMIC_RELAXED);
+    uint32_t count = (head < TRACE_CAPACITY) ? head : TRACE_CAPACITY;
+    uint32_t first = head - count;
+
+    // Events are stored in end order, so the earliest start may not be the oldest slot.
+    // The same pass collects the (core, task) lanes to name
+    static TraceThread threads[TRACE_MAX_THREADS];
+    int thread_count = 0;
+    int32_t earliest = 0;
+    uint32_t base = ring[first & (TRACE_CAPACITY - 1)].start_us;
+    for (uint32_t i = 0; i < count; i++) {
+        const TraceEvent *e = &ring[(first + i) & (TRACE_CAPACITY - 1)];
+        int32_t rel = (int32_t)(e->start_us - base);
+        if (rel < earliest) {
+            earliest = rel;
+        }
+        thread_id(threads, &thread_count, e->core, e->task);
+    }
+
+    // Name the lanes: one process per core, one thread per task
+    char line[160];
+    size_t written = out.print("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    for (int core = 0; core < portNUM_PROCESSORS; core++) {
+        snprintf(line, sizeof(line), "%s{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"name\":\"core %d\"}}",
+                 core ? ",\n" : "", core, core);
+        written += out.print(line);
+    }
+    for (int i = 0; i < thread_count; i++) {
+        snprintf(line, sizeof(line), ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                 threads[i].core, i + 1, pcTaskGetName(threads[i].task));
+        written += out.print(line);
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        const TraceEvent *e = &ring[(first + i) & (TRACE_CAPACITY - 1)];
+        uint32_t ts = (uint32_t)((int32_t)(e->start_us - base) - earliest);
+        int tid = thread_id(threads, &thread_count, e->core, e->task);
+        int len;
+        if (e->instant) {
+            len = snprintf(line, sizeof(line), ",\n{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%u,\"pid\":%u,\"tid\":%d",
+                           e->name, (unsigned)ts, e->core, tid);
+        } else {
+            len = snprintf(line, sizeof(line), ",\n{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%u,\"dur\":%u,\"pid\":%u,\"tid\":%d",
+                           e->name, (unsigned)ts, (unsigned)e->dur_us, e->core, tid);
+        }
+        if (e->arg != 0 && len > 0 && len < (int)sizeof(line)) {
+            snprintf(line + len, sizeof(line) - len, ",\"args\":{\"arg\":%d}", (int)e->arg);
+        }
+        written += out.print(line);
+        written += out.print("}");
+    }
+    written += out.print("\n]}\n");
+
+    recording = true;
+    return written;
+}
+
+#endif // TRACE_ENABLED
@@ -0,0 +1,76 @@
+/**
+ * Chrome-trace event recorder
+ *
+ * Spans are written into a fixed ring in PSRAM: one 24-byte record per span,
+ * claimed with a single atomic increment, so recording never blocks, never
+ * allocates and costs about a microsecond on either core. Once full the
+ * ring overwrites its oldest events. trace_write_json() dumps it as Chrome
+ * trace JSON with one process per core and one thread per FreeRTOS task,
+ * ready for chrome://tracing or ui.perfetto.dev.
+ *
+ * Send 't' on the serial console to dump the ring.
+ *
+ * Build with -DTRACE_ENABLED=0 to compile every trace point out.
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+
+#ifndef TRACE_ENABLED
+#define TRACE_ENABLED       1
+#endif
+
+#define TRACE_CAPACITY      16384   // Events, a power of two (384 KB of PSRAM)
+
+#if TRACE_ENABLED
+
+#include <Arduino.h>
+#include <esp_timer.h>
+
+// Allocate the ring in PSRAM and start recording; spans before this are dropped
+bool trace_init(void);
+
+// Record a complete span that started at start_us (esp_timer_get_time()) and ends now.
+// name must be a string literal or otherwise live forever; arg is shown in the viewer when non-zero
+void trace_span(const char *name, int64_t start_us, int32_t arg = 0);
+
+// Record a zero-length marker
+void trace_instant(const char *name, int32_t arg = 0);
+
+// Write the ring, oldest first, as Chrome trace JSON. Recording pauses while it runs
+size_t trace_write_json(Print &out);
+
+// Records a span covering the rest of the enclosing scope
+class TraceScope {
+public:
+    explicit TraceScope(const char *name, int32_t arg = 0) : name(name), arg(arg), start_us(esp_timer_get_time()) {}
+    ~TraceScope() { trace_span(name, start_us, arg); }
+    void set_arg(int32_t value) { arg = value; }
+
+private:
+    const char *name;
+    int32_t arg;
+    int64_t start_us;
+};
+
+#define TRACE_CONCAT_(a, b)         a##b
+#define TRACE_CONCAT(a, b)          TRACE_CONCAT_(a, b)
+#define TRACE_SCOPE(name)           TraceScope TRACE_CONCAT(trace_scope_, __LINE__)(name)
+#define TRACE_SCOPE_ARG(name, arg)  TraceScope TRACE_CONCAT(trace_scope_, __LINE__)(name, arg)
+#define TRACE_BEGIN(var)            int64_t var = esp_timer_get_time()
+#define TRACE_END(name, var, ...)   trace_span(name, var, ##__VA_ARGS__)
+#define TRACE_INSTANT(name, ...)    trace_instant(name, ##__VA_ARGS__)
+
+#else
+
+#define TRACE_SCOPE(name)
+#define TRACE_SCOPE_ARG(name, arg)
+#define TRACE_BEGIN(var)
+#define TRACE_END(name, var, ...)
+#define TRACE_INSTANT(name, ...)
+
+#endif // TRACE_ENABLED
+
+#endif // TRACE_H
@@ -0,0 +1,227 @@
+/**
+ * WiFi connection manager - see wifi_manager.h
+ */
+
+#include <WiFi.h>
+#include <Preferences.h>
+#include "wifi_manager.h"
+#include "log_sink.h"
+#include "metrics.h"
+
+#define WIFI_CACHE_NAMESPACE    "wifi"
+
+enum WifiState {
+    WIFI_STATE_IDLE,
+    WIFI_STATE_CONNECTING,
+    WIFI_STATE_CONNECTED,
+    WIFI_STATE_BACKOFF
+};
+
+// Last good connection, as stored in NVS
+typedef struct {
+    bool valid;
+    uint8_t bssid[6];
+    uint8_t channel;
+} WifiCache;
+
+static const char *wifi_ssid = NULL;
+static const char *wifi_password = NULL;
+static WifiCache cache;
+
+static WifiState state = WIFI_STATE_IDLE;
+static bool attempt_fast = false;       // Current attempt uses the cache
+static bool fast_failed = false;        // The cache has already failed during this outage
+static uint32_t attempt_start_ms = 0;
+static uint32_t outage_start_ms = 0;    // First attempt since the link was last up
+static uint32_t backoff_ms = WIFI_BACKOFF_MIN_MS;
+static uint32_t retry_at_ms = 0;
+
+// Counters since boot
+static uint32_t connects = 0;
+static uint32_t disconnects = 0;
+static uint32_t fast_hits = 0;
+static uint32_t fast_misses = 0;
+static uint32_t failed_attempts = 0;
+static uint32_t last_connect_ms = 0;
+static volatile uint8_t last_disconnect_reason = 0;    // Written by the WiFi event task
+
+static void cache_load(void)
+{
+    Preferences prefs;
+    cache.valid = false;
+    if (!prefs.begin(WIFI_CACHE_NAMESPACE, true)) {
+        return;
+    }
+    // Only trust a cache written for the SSID we are configured with
+    String ssid = prefs.getString("ssid", "");
+    cache.valid = (ssid == wifi_ssid) &&
+                  (prefs.getBytes("bssid", cache.bssid, sizeof(cache.bssid)) == sizeof(cache.bssid));
+    cache.channel = prefs.getUChar("channel", 0);
+    cache.valid = cache.valid && cache.channel != 0;
+    prefs.end();
+}
+
+// Remember the access point just joined; NVS is only written when it changed
+static void cache_store(void)
+{
+    WifiCache now;
+    memcpy(now.bssid, WiFi.BSSID(), sizeof(now.bssid));
+    now.channel = (uint8_t)WiFi.channel();
+    now.valid = true;
+
+    if (cache.valid && memcmp(now.bssid, cache.bssid, sizeof(now.bssid)) == 0 && now.channel == cache.channel) {
+        return;
+    }
+
+    Preferences prefs;
+    if (!prefs.begin(WIFI_CACHE_NAMESPACE, false)) {
+        return;
+    }
+    prefs.putString("ssid", wifi_ssid);
+    prefs.putBytes("bssid", now.bssid, sizeof(now.bssid));
+    prefs.putUChar("channel", now.channel);
+    // Leases were cached by earlier firmware; they must not outlive it
+    prefs.remove("ip");
+    prefs.remove("gateway");
+    prefs.remove("subnet");
+    prefs.remove("dns");
+    prefs.remove("uses");
+    prefs.end();
+    cache = now;
+}
+
+static void on_disconnected(arduino_event_id_t event, arduino_event_info_t info)
+{
+    last_disconnect_reason = info.wifi_sta_disconnected.reason;
+}
+
+static void start_attempt(uint32_t now)
+{
+    attempt_fast = cache.valid && !fast_failed;
+    // DHCP either way, so the lease is always current
+    WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+    if (attempt_fast) {
+        // Directed join: no scan
+        WiFi.begin(wifi_ssid, wifi_password, cache.channel, cache.bssid);
+    } else {
+        WiFi.begin(wifi_ssid, wifi_password);
+    }
+    attempt_start_ms = now;
+    state = WIFI_STATE_CONNECTING;
+}
+
+static void on_connected(uint32_t now)
+{
+    last_connect_ms = now - outage_start_ms;
+    metrics_record(METRIC_WIFI_CONNECT_MS, last_connect_ms);
+    connects++;
+    if (attempt_fast) {
+        fast_hits++;
+    }
+    cache_store();
+
+    LOG("WiFi connected in %lu ms (%s), BSSID %s channel %d",
+        (unsigned long)last_connect_ms, attempt_fast ? "cached AP" : "scan",
+        WiFi.BSSIDstr().c_str(), WiFi.channel());
+
+    backoff_ms = WIFI_BACKOFF_MIN_MS;
+    fast_failed = false;
+    state = WIFI_STATE_CONNECTED;
+}
+
+static void on_attempt_failed(uint32_t now)
+{
+    WiFi.disconnect();
+    failed_attempts++;
+
+    // A stale cache (AP moved channel or went away) falls straight through to a full connect
+    if (attempt_fast) {
+        fast_misses++;
+        fast_failed = true;
+        LOG("WiFi cached connect failed (reason %d), scanning", last_disconnect_reason);
+        start_attempt(now);
+        return;
+    }
+
+    LOG_EVERY_MS(WIFI_BACKOFF_MAX_MS, "WiFi connect failed (reason %d), retrying in %lu ms",
+                 last_disconnect_reason, (unsigned long)backoff_ms);
+    retry_at_ms = now + backoff_ms;
+    backoff_ms = (backoff_ms * 2 > WIFI_BACKOFF_MAX_MS) ? WIFI_BACKOFF_MAX_MS : backoff_ms * 2;
+    state = WIFI_STATE_BACKOFF;
+}
+
+void wifi_manager_begin(const char *ssid, const char *password)
+{
+    wifi_ssid = ssid;
+    wifi_password = password;
+
+    // The manager owns retries, and the cache replaces the core's own credential storage
+    WiFi.persistent(false);
+    WiFi.setAutoReconnect(false);
+    WiFi.mode(WIFI_STA);
+    WiFi.onEvent(on_disconnected, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+
+    cache_load();
+    outage_start_ms = millis();
+    start_attempt(outage_start_ms);
+}
+
+bool wifi_manager_poll(void)
+{
+    uint32_t now = millis();
+    wl_status_t status = WiFi.status();
+
+    switch (state) {
+    case WIFI_STATE_IDLE:
+        break;
+
+    case WIFI_STATE_CONNECTING: {
+        uint32_t timeout = attempt_fast ? WIFI_FAST_CONNECT_TIMEOUT_MS : WIFI_CONNECT_TIMEOUT_MS;
+        if (status == WL_CONNECTED) {
+            on_connected(now);
+        } else if (status == WL_CONNECT_FAILED || status == WL_NO_SSID_AVAIL || now - attempt_start_ms >= timeout) {
+            on_attempt_failed(now);
+        }
+        break;
+    }
+
+    case WIFI_STATE_CONNECTED:
+        if (status != WL_CONNECTED) {
+            disconnects++;
+            LOG("WiFi link lost (reason %d), reconnecting", last_disconnect_reason);
+            outage_start_ms = now;
+            start_attempt(now);
+        }
+        break;
+
+    case WIFI_STATE_BACKOFF:
+        if ((int32_t)(now - retry_at_ms) >= 0) {
+            start_attempt(now);
+        }
+        break;
+    }
+
+    return state == WIFI_STATE_CONNECTED;
+}
+
+void wifi_manager_report(JsonDocument &doc)
+{
+    JsonObject wifi = doc["wifi"].to<JsonObject>();
+    wifi["connects"] = connects;
+    wifi["disconnects"] = disconnects;
+    wifi["fast_hits"] = fast_hits;
+    wifi["fast_misses"] = fast_misses;
+    wifi["failed_attempts"] = failed_attempts;
+    wifi["last_connect_ms"] = last_connect_ms;
+    wifi["last_disconnect_reason"] = last_disconnect_reason;
+}
+
+void wifi_manager_write_text(Print &out)
+{
+    out.printf("hal_wifi_connects %lu\n", (unsigned long)connects);
+    out.printf("hal_wifi_disconnects %lu\n", (unsigned long)disconnects);
+    out.printf("hal_wifi_fast_hits %lu\n", (unsigned long)fast_hits);
+    out.printf("hal_wifi_fast_misses %lu\n", (unsigned long)fast_misses);
+    out.printf("hal_wifi_failed_attempts %lu\n", (unsigned long)failed_attempts);
+    out.printf("hal_wifi_last_connect_ms %lu\n", (unsigned long)last_connect_ms);
+}
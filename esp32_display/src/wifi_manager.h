@@ -0,0 +1,43 @@
+/**
+ * WiFi connection manager
+ *
+ * Keeps the station connected without ever blocking the loop:
+ *  - The last good BSSID and channel are cached in NVS. Connecting first
+ *    tries a directed join to that BSSID on that channel, which skips the
+ *    scan (the bulk of a cold connect). The address always comes from DHCP:
+ *    reusing a cached lease as a static address would outlive the lease,
+ *    and nothing would notice the router handing it to another host. If
+ *    the directed join has not connected within
+ *    WIFI_FAST_CONNECT_TIMEOUT_MS the cache is ignored and a normal scan
+ *    connect follows.
+ *  - When the link drops, or an attempt fails, it retries in the
+ *    background with exponential backoff.
+ *  - Every successful (re)connect records how long the outage lasted in the
+ *    wifi_connect_ms histogram; counters go into the metrics report.
+ */
+
+#ifndef WIFI_MANAGER_H
+#define WIFI_MANAGER_H
+
+#include <stdint.h>
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#define WIFI_FAST_CONNECT_TIMEOUT_MS    5000    // Directed join + DHCP
+#define WIFI_CONNECT_TIMEOUT_MS         15000   // Per scan + DHCP attempt
+#define WIFI_BACKOFF_MIN_MS             500
+#define WIFI_BACKOFF_MAX_MS             30000
+
+// Load the NVS cache and start connecting; returns immediately
+void wifi_manager_begin(const char *ssid, const char *password);
+
+// Drive the state machine; call often from the loop task. Returns true while connected
+bool wifi_manager_poll(void);
+
+// Add {"wifi": {...}} counters to doc
+void wifi_manager_report(JsonDocument &doc);
+
+// Write hal_wifi_* counters for /metrics
+void wifi_manager_write_text(Print &out);
+
+#endif // WIFI_MANAGER_H
@@ -0,0 +1,251 @@
+#!/usr/bin/env python3
+"""
+Generate the reference JPEGs for the golden-image tests.
+
+Writes small synthetic face frames as baseline JPEGs with 4:2:0 chroma,
+the same layout cv2.imencode produces for the backend's /api/hal/face_frame,
+so TJpgDec walks the 16x16 MCU path the device uses. Pure Python on purpose:
+the encoder is deterministic, so regenerating gives byte-identical files.
+
+    python3 make_reference_jpegs.py [out_dir]
+"""
+
+import math
+import os
+import sys
+
+# Annex K tables
+LUMA_QUANT = [
+    16, 11, 10, 16, 24, 40, 51, 61, 12, 12, 14, 19, 26, 58, 60, 55,
+    14, 13, 16, 24, 40, 57, 69, 56, 14, 17, 22, 29, 51, 87, 80, 62,
+    18, 22, 37, 56, 68, 109, 103, 77, 24, 35, 55, 64, 81, 104, 113, 92,
+    49, 64, 78, 87, 103, 121, 120, 101, 72, 92, 95, 98, 112, 100, 103, 99,
+]
+CHROMA_QUANT = [
+    17, 18, 24, 47, 99, 99, 99, 99, 18, 21, 26, 66, 99, 99, 99, 99,
+    24, 26, 56, 99, 99, 99, 99, 99, 47, 66, 99, 99, 99, 99, 99, 99,
+] + [99] * 32
+
+DC_LUMA_BITS = [0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0]
+DC_LUMA_VALS = list(range(12))
+DC_CHROMA_BITS = [0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0]
+DC_CHROMA_VALS = list(range(12))
+AC_LUMA_BITS = [0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7D]
+AC_LUMA_VALS = bytes.fromhex(
+    "01020300041105122131410613516107227114328191a1082342b1c11552d1f0"
+    "2433627282090a161718191a25262728292a3435363738393a43444546474849"
+    "4a535455565758595a636465666768696a737475767778797a83848586878889"
+    "8a92939495969798999aa2a3a4a5a6a7a8a9aab2b3b4b5b6b7b8b9bac2c3c4c5"
+    "c6c7c8c9cad2d3d4d5d6d7d8d9dae1e2e3e4e5e6e7e8e9eaf1f2f3f4f5f6f7f8"
+    "f9fa")
+AC_CHROMA_BITS = [0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77]
+AC_CHROMA_VALS = bytes.fromhex(
+    "000102031104052131061241510761711322328108144291a1b1c109233352f0"
+    "156272d10a162434e125f11718191a262728292a35363738393a434445464748"
+    "494a535455565758595a636465666768696a737475767778797a828384858687"
+    "88898a92939495969798999aa2a3a4a5a6a7a8a9aab2b3b4b5b6b7b8b9bac2c3"
+    "c4c5c6c7c8c9cad2d3d4d5d6d7d8d9dae2e3e4e5e6e7e8e9eaf2f3f4f5f6f7f8"
+    "f9fa")
+
+ZIGZAG = [
+    0, 1, 8, 16, 9, 2, 3, 10, 17, 24, 32, 25, 18, 11, 4, 5,
+    12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13, 6, 7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+]
+
+DCT_COS = [[(math.sqrt(0.5) if u == 0 else 1.0) * 0.5 * math.cos((2 * x + 1) * u * math.pi / 16)
+            for x in range(8)] for u in range(8)]
+
+
+def scale_quant(table, quality):
+    scale = 5000 // quality if quality < 50 else 200 - quality * 2
+    return [min(255, max(1, (q * scale + 50) // 100)) for q in table]
+
+
+def huffman_codes(bits, vals):
+    codes = {}
+    code = 0
+    k = 0
+    for length in range(1, 17):
+        for _ in range(bits[length - 1]):
+            codes[vals[k]] = (code, length)
+            code += 1
+            k += 1
+        code <<= 1
+    return codes
+
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.acc = 0
+        self.n = 0
+
+    def write(self, code, length):
+        self.acc = (self.acc << length) | code
+        self.n += length
+        while self.n >= 8:
+            self.n -= 8
+            byte = (self.acc >> self.n) & 0xFF
+            self.out.append(byte)
+            if byte == 0xFF:
+                self.out.append(0x00)
+        self.acc &= (1 << self.n) - 1
+
+    def flush(self):
+        if self.n:
+            self.write((1 << (8 - self.n)) - 1, 8 - self.n)
+
+
+def fdct(block):
+    tmp = [[sum(DCT_COS[u][x] * block[y * 8 + x] for x in range(8)) for u in range(8)] for y in range(8)]
+    return [sum(DCT_COS[v][y] * tmp[y][u] for y in range(8)) for v in range(8) for u in range(8)]
+
+
+def magnitude(value):
+    size = abs(value).bit_length()
+    bits = value if value >= 0 else value + (1 << size) - 1
+    return size, bits
+
+
+def encode_block(writer, block, quant, dc_codes, ac_codes, prev_dc):
+    coeffs = fdct(block)
+    q = [int(round(coeffs[ZIGZAG[i]] / quant[ZIGZAG[i]])) for i in range(64)]
+
+    size, bits = magnitude(q[0] - prev_dc)
+    writer.write(*dc_codes[size])
+    if size:
+        writer.write(bits, size)
+
+    run = 0
+    for i in range(1, 64):
+        if q[i] == 0:
+            run += 1
+            continue
+        while run > 15:
+            writer.write(*ac_codes[0xF0])
+            run -= 16
+        size, bits = magnitude(q[i])
+        writer.write(*ac_codes[(run << 4) | size])
+        writer.write(bits, size)
+        run = 0
+    if run:
+        writer.write(*ac_codes[0x00])
+    return q[0]
+
+
+def encode_jpeg(width, height, pixel, quality=85):
+    """pixel(x, y) -> (r, g, b); returns the JPEG file as bytes."""
+    luma_q = scale_quant(LUMA_QUANT, quality)
+    chroma_q = scale_quant(CHROMA_QUANT, quality)
+    dc_luma = huffman_codes(DC_LUMA_BITS, DC_LUMA_VALS)
+    ac_luma = huffman_codes(AC_LUMA_BITS, AC_LUMA_VALS)
+    dc_chroma = huffman_codes(DC_CHROMA_BITS, DC_CHROMA_VALS)
+    ac_chroma = huffman_codes(AC_CHROMA_BITS, AC_CHROMA_VALS)
+
+    # Planes padded to whole 16x16 MCUs by repeating the edge pixels
+    pw = (width + 15) // 16 * 16
+    ph = (height + 15) // 16 * 16
+    Y = [0.0] * (pw * ph)
+    Cb = [0.0] * (pw * ph)
+    Cr = [0.0] * (pw * ph)
+    for y in range(ph):
+        for x in range(pw):
+            r, g, b = pixel(min(x, width - 1), min(y, height - 1))
+            i = y * pw + x
+            Y[i] = 0.299 * r + 0.587 * g + 0.114 * b - 128
+            Cb[i] = -0.168736 * r - 0.331264 * g + 0.5 * b
+            Cr[i] = 0.5 * r - 0.418688 * g - 0.081312 * b
+
+    writer = BitWriter()
+    prev = [0, 0, 0]
+    for my in range(0, ph, 16):
+        for mx in range(0, pw, 16):
+            for by, bx in ((0, 0), (0, 8), (8, 0), (8, 8)):
+                block = [Y[(my + by + y) * pw + mx + bx + x] for y in range(8) for x in range(8)]
+                prev[0] = encode_block(writer, block, luma_q, dc_luma, ac_luma, prev[0])
+            for c, plane in ((1, Cb), (2, Cr)):
+                # 2x2 box-filtered chroma
+                block = []
+                for y in range(8):
+                    row = (my + y * 2) * pw + mx
+                    for x in range(8):
+                        i = row + x * 2
+                        block.append((plane[i] + plane[i + 1] + plane[i + pw] + plane[i + pw + 1]) / 4)
+                prev[c] = encode_block(writer, block, chroma_q, dc_chroma, ac_chroma, prev[c])
+    writer.flush()
+
+    def segment(marker, payload):
+        return bytes([0xFF, marker]) + (len(payload) + 2).to_bytes(2, "big") + payload
+
+    out = bytearray(b"\xFF\xD8")
+    out += segment(0xE0, b"JFIF\x00\x01\x01\x00\x00\x01\x00\x01\x00\x00")
+    for table_id, table in ((0, luma_q), (1, chroma_q)):
+        out += segment(0xDB, bytes([table_id]) + bytes(table[ZIGZAG[i]] for i in range(64)))
+    out += segment(0xC0, bytes([8]) + height.to_bytes(2, "big") + width.to_bytes(2, "big")
+                   + bytes([3, 1, 0x22, 0, 2, 0x11, 1, 3, 0x11, 1]))
+    for cls_id, bits, vals in ((0x00, DC_LUMA_BITS, DC_LUMA_VALS), (0x10, AC_LUMA_BITS, AC_LUMA_VALS),
+                               (0x01, DC_CHROMA_BITS, DC_CHROMA_VALS), (0x11, AC_CHROMA_BITS, AC_CHROMA_VALS)):
+        out += segment(0xC4, bytes([cls_id]) + bytes(bits) + bytes(vals))
+    out += segment(0xDA, bytes([3, 1, 0x00, 2, 0x11, 3, 0x11, 0, 63, 0]))
+    out += writer.out
+    out += b"\xFF\xD9"
+    return bytes(out)
+
+
+def cartoon_face(width, height):
+    """Flat-shaded, red-tinted face on black, like the backend's red filter output."""
+    cx, cy = width / 2, height / 2
+
+    def inside(x, y, ex, ey, rx, ry):
+        return ((x - ex) / rx) ** 2 + ((y - ey) / ry) ** 2 <= 1.0
+
+    def pixel(x, y):
+        if not inside(x, y, cx, cy, width * 0.36, height * 0.44):
+            return (0, 0, 0)
+        for ex in (cx - width * 0.14, cx + width * 0.14):
+            if inside(x, y, ex, cy - height * 0.1, width * 0.06, height * 0.04):
+                return (40, 0, 0)
+        if inside(x, y, cx, cy + height * 0.2, width * 0.16, height * 0.05):
+            return (110, 10, 10)
+        # Gentle vertical shading so the decoder sees some AC energy
+        return (200 - int(60 * (y / height)), 30, 30)
+
+    return pixel
+
+
+def colour_bars(width, height):
+    """Saturated bars plus a fine checker strip: chroma edges and high-frequency detail."""
+    bars = [(255, 255, 255), (255, 255, 0), (0, 255, 255), (0, 255, 0),
+            (255, 0, 255), (255, 0, 0), (0, 0, 255), (0, 0, 0)]
+
+    def pixel(x, y):
+        if y >= height * 3 // 4:
+            return (255, 255, 255) if ((x >> 2) + (y >> 2)) & 1 else (0, 0, 0)
+        return bars[x * len(bars) // width]
+
+    return pixel
+
+
+# (file, width, height, pattern, quality)
+REFERENCES = [
+    ("face_480.jpg", 480, 480, cartoon_face, 80),
+    ("bars_480.jpg", 480, 480, colour_bars, 90),
+    # Wider than the canvas: tft_output must clip the right-hand MCUs
+    ("face_496x464.jpg", 496, 464, cartoon_face, 80),
+]
+
+
+def main():
+    out_dir = sys.argv[1] if len(sys.argv) > 1 else os.path.dirname(os.path.abspath(__file__))
+    for name, width, height, pattern, quality in REFERENCES:
+        data = encode_jpeg(width, height, pattern(width, height), quality)
+        path = os.path.join(out_dir, name)
+        with open(path, "wb") as f:
+            f.write(data)
+        print(f"{path}: {width}x{height}, {len(data)} bytes")
+
+
+if __name__ == "__main__":
+    main()
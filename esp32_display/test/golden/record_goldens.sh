@@ -0,0 +1,43 @@
+#!/bin/sh
+# Record the golden images with the renderer of an earlier commit
+#
+# Checks ref out into a temporary worktree and runs its golden tests there
+# with GOLDEN_UPDATE=1, writing the goldens into this tree's test/golden/,
+# so a rework of the rendering code is checked against what the code did
+# before it. ref has to contain the golden tests; the commit that added them
+# is
+#
+#   git log --diff-filter=A --format=%h -- esp32_display/test/test_golden/test_golden.cpp
+#
+# Goldens for tests added since ref are then recorded from this tree
+# (GOLDEN_UPDATE=missing); the script lists which came from where. Needs
+# PlatformIO; review the .rle565 files before committing them.
+#
+#   test/golden/record_goldens.sh <ref>
+
+set -e
+
+if [ $# -ne 1 ]; then
+    echo "usage: $0 <ref>" >&2
+    exit 2
+fi
+
+here="$(cd "$(dirname "$0")" && pwd)"
+root="$(git -C "$here" rev-parse --show-toplevel)"
+ref="$(git -C "$root" rev-parse --verify "$1^{commit}")"
+tree="$(mktemp -d)"
+
+git -C "$root" worktree add --detach "$tree" "$ref"
+trap 'git -C "$root" worktree remove --force "$tree"' EXIT
+
+# Start clean so goldens of removed tests do not linger; git has the old ones
+rm -f "$here"/*.rle565
+
+# Every test is reported ignored while recording
+(cd "$tree/esp32_display" && GOLDEN_UPDATE=1 GOLDEN_DIR="$here" pio test -e native) || true
+echo "Recorded with $ref:"
+ls "$here"/*.rle565 | tee "$tree/from_ref"
+
+(cd "$here/../.." && GOLDEN_UPDATE=missing pio test -e native) || true
+echo "Recorded with this tree (no test for them at $ref):"
+ls "$here"/*.rle565 | grep -vxF -f "$tree/from_ref" || echo "  none"
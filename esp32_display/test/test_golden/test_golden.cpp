@@ -0,0 +1,586 @@
+/**
+ * Golden-image regression tests for eye and face rendering
+ *
+ * Renders the eye at fixed pulse phases for every state, the backend's
+ * default keyframe scripts (native/default_eye_scripts.h) at fixed elapsed
+ * times, a scripted and a speech-envelope frame, and decodes the reference
+ * JPEGs through
+ * tft_output(), all on the headless display. Each frame buffer is compared
+ * with a stored golden image in test/golden/ within a small tolerance.
+ * Interpolated face frames are checked against the decoded-JPEG goldens:
+ * both ends of a blend must match them, and the middle must match their
+ * blend.
+ *
+ *   pio test -e native
+ *   GOLDEN_UPDATE=1 pio test -e native     (re-record after an intended change)
+ *   GOLDEN_UPDATE=missing pio test -e native   (record only goldens not there yet)
+ *   test/golden/record_goldens.sh <ref>    (record from an earlier commit's renderer)
+ *
+ * A missing golden fails its test unless GOLDEN_UPDATE is set, when it is
+ * recorded and the test reported as ignored. On a mismatch the rendered
+ * frame is written next to the golden as <name>.actual.ppm.
+ *
+ * Goldens are RGB565 run-length encoded (.rle565): "RLE565\n<w> <h>\n" then
+ * little-endian (uint16 run, uint16 colour) pairs in row-major order.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unity.h>
+#include <Arduino.h>
+#include <TJpg_Decoder.h>
+#include "headless_display.h"
+#include "hal_eye.h"
+#include "face_view.h"
+#include "default_eye_scripts.h"
+#include "pixel_blend.h"
+
+#define GOLDEN_DEFAULT_DIR          "test/golden"
+#define GOLDEN_CHANNEL_TOLERANCE    2       // Per channel, in 5/6/5-bit steps
+#define GOLDEN_MAX_BAD_PER_MILLE    1       // Pixels allowed beyond the channel tolerance
+#define GOLDEN_PINNED_MS            100000  // LVGL tick during the tests
+#define GOLDEN_FRAME_GAP_US         200000  // Face frame interval in the interpolation test
+
+#define GOLDEN_PIXELS   (HEADLESS_WIDTH * HEADLESS_HEIGHT)
+
+enum GoldenUpdate {
+    GOLDEN_UPDATE_NONE,
+    GOLDEN_UPDATE_ALL,                      // GOLDEN_UPDATE=1
+    GOLDEN_UPDATE_MISSING,                  // GOLDEN_UPDATE=missing: record only goldens that do not exist yet
+};
+
+enum GoldenResult {
+    GOLDEN_MATCH,
+    GOLDEN_MISMATCH,
+    GOLDEN_RECORDED,
+    GOLDEN_ERROR,
+};
+
+static const char *const STATE_NAMES[EYE_STATE_COUNT] = { "idle", "listening", "speaking" };
+static const uint32_t STATE_PERIODS[EYE_STATE_COUNT] = {
+    PULSE_PERIOD_IDLE_MS, PULSE_PERIOD_LISTENING_MS, PULSE_PERIOD_SPEAKING_MS
+};
+
+static const char *golden_dir = GOLDEN_DEFAULT_DIR;
+static GoldenUpdate golden_update = GOLDEN_UPDATE_NONE;
+static uint16_t golden_pixels[GOLDEN_PIXELS];
+static char golden_message[256];
+
+/* Golden files */
+
+static void golden_path(char *path, size_t size, const char *name, const char *ext)
+{
+    snprintf(path, size, "%s/%s%s", golden_dir, name, ext);
+}
+
+static bool golden_write(const char *path, const uint16_t *pixels)
+{
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) {
+        return false;
+    }
+
+    fprintf(f, "RLE565\n%d %d\n", HEADLESS_WIDTH, HEADLESS_HEIGHT);
+    int i = 0;
+    while (i < GOLDEN_PIXELS) {
+        uint16_t colour = pixels[i];
+        int run = 1;
+        while (i + run < GOLDEN_PIXELS && run < 0xFFFF && pixels[i + run] == colour) {
+            run++;
+        }
+        uint8_t pair[4] = { (uint8_t)run, (uint8_t)(run >> 8), (uint8_t)colour, (uint8_t)(colour >> 8) };
+        fwrite(pair, 1, sizeof(pair), f);
+        i += run;
+    }
+
+    return fclose(f) == 0;
+}
+
+// Returns false if the file is missing, malformed or a different size
+static bool golden_read(const char *path, uint16_t *pixels)
+{
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        return false;
+    }
+
+    int w = 0, h = 0;
+    bool ok = (fscanf(f, "RLE565 %d %d", &w, &h) == 2) && (fgetc(f) == '\n') &&
+              (w == HEADLESS_WIDTH) && (h == HEADLESS_HEIGHT);
+    int i = 0;
+    uint8_t pair[4];
+    while (ok && i < GOLDEN_PIXELS && fread(pair, 1, sizeof(pair), f) == sizeof(pair)) {
+        int run = pair[0] | (pair[1] << 8);
+        uint16_t colour = pair[2] | (pair[3] << 8);
+        if (run == 0 || i + run > GOLDEN_PIXELS) {
+            ok = false;
+            break;
+        }
+        for (int k = 0; k < run; k++) {
+            pixels[i++] = colour;
+        }
+    }
+    fclose(f);
+
+    return ok && i == GOLDEN_PIXELS;
+}
+
+/* Comparison */
+
+static int channel_diff(uint16_t a, uint16_t b, int shift, uint16_t mask)
+{
+    return abs((int)((a >> shift) & mask) - (int)((b >> shift) & mask));
+}
+
+// Load the golden called name into pixels; false (with the message set) if it is missing or malformed
+static bool golden_load(const char *name, uint16_t *pixels)
+{
+    char path[512];
+    golden_path(path, sizeof(path), name, ".rle565");
+    if (!golden_read(path, pixels)) {
+        snprintf(golden_message, sizeof(golden_message),
+                 "missing or malformed %s (record with GOLDEN_UPDATE=1 or test/golden/record_goldens.sh)", path);
+        return false;
+    }
+    return true;
+}
+
+// Compare the headless frame buffer with expected; on a mismatch write it out as <name>.actual.ppm
+static GoldenResult frame_check(const char *name, const uint16_t *expected)
+{
+    char path[512];
+    const uint16_t *frame = headless_display_framebuffer();
+
+    int bad = 0, worst = 0, first_bad = -1;
+    for (int i = 0; i < GOLDEN_PIXELS; i++) {
+        uint16_t a = frame[i];
+        uint16_t b = expected[i];
+        if (a == b) {
+            continue;
+        }
+        int diff = channel_diff(a, b, 11, 0x1F);
+        int g = channel_diff(a, b, 5, 0x3F);
+        int bl = channel_diff(a, b, 0, 0x1F);
+        if (g > diff) diff = g;
+        if (bl > diff) diff = bl;
+        if (diff > worst) worst = diff;
+        if (diff > GOLDEN_CHANNEL_TOLERANCE) {
+            if (first_bad < 0) first_bad = i;
+            bad++;
+        }
+    }
+
+    if (bad * 1000 <= GOLDEN_PIXELS * GOLDEN_MAX_BAD_PER_MILLE) {
+        return GOLDEN_MATCH;
+    }
+
+    golden_path(path, sizeof(path), name, ".actual.ppm");
+    headless_display_write_ppm(path);
+    snprintf(golden_message, sizeof(golden_message),
+             "%s: %d pixels beyond tolerance (worst channel diff %d, first at %d,%d), wrote %s",
+             name, bad, worst, first_bad % HEADLESS_WIDTH, first_bad / HEADLESS_WIDTH, path);
+    return GOLDEN_MISMATCH;
+}
+
+// Compare the headless frame buffer with the golden called name, recording it with GOLDEN_UPDATE
+static GoldenResult golden_check(const char *name)
+{
+    char path[512];
+    golden_path(path, sizeof(path), name, ".rle565");
+    bool exists = false;
+    if (golden_update == GOLDEN_UPDATE_MISSING) {
+        FILE *f = fopen(path, "rb");
+        exists = f != NULL;
+        if (f != NULL) {
+            fclose(f);
+        }
+    }
+    if (golden_update == GOLDEN_UPDATE_ALL || (golden_update == GOLDEN_UPDATE_MISSING && !exists)) {
+        if (!golden_write(path, headless_display_framebuffer())) {
+            snprintf(golden_message, sizeof(golden_message), "cannot write %s", path);
+            return GOLDEN_ERROR;
+        }
+        snprintf(golden_message, sizeof(golden_message), "recorded %s", path);
+        return GOLDEN_RECORDED;
+    }
+    if (!golden_load(name, golden_pixels)) {
+        return GOLDEN_ERROR;
+    }
+    return frame_check(name, golden_pixels);
+}
+
+// Fail on mismatches and errors, ignore (after every check has run) if anything was recorded
+static void report_results(int mismatches, int recorded)
+{
+    if (mismatches > 0) {
+        TEST_FAIL_MESSAGE(golden_message);
+    }
+    if (recorded > 0) {
+        TEST_IGNORE_MESSAGE(golden_message);
+    }
+}
+
+static void tally(GoldenResult result, int *mismatches, int *recorded)
+{
+    if (result == GOLDEN_MISMATCH || result == GOLDEN_ERROR) {
+        printf("  %s\n", golden_message);
+        (*mismatches)++;
+    } else if (result == GOLDEN_RECORDED) {
+        printf("  %s\n", golden_message);
+        (*recorded)++;
+    }
+}
+
+/* Rendering */
+
+static void render_eye(const HalEyeInput *input)
+{
+    hal_eye_render(input);
+    headless_display_refresh();
+}
+
+static void render_eye_state(EyeTimelineState state, int64_t now_ms, int envelope_level)
+{
+    HalEyeInput input;
+    input.state = state;
+    input.now_ms = now_ms;
+    input.script = NULL;
+    input.script_elapsed_ms = 0;
+    input.envelope_level = envelope_level;
+    render_eye(&input);
+}
+
+// Black out the whole face canvas through the same path the decoder uses
+static void clear_face_canvas(void)
+{
+    static uint16_t black[16 * 16];
+    for (int y = 0; y < FACE_VIEW_HEIGHT; y += 16) {
+        for (int x = 0; x < FACE_VIEW_WIDTH; x += 16) {
+            tft_output(x, y, 16, 16, black);
+        }
+    }
+}
+
+// Read a reference JPEG from the golden directory; NULL (with the message set) if it cannot be read
+static uint8_t *load_jpeg(const char *file, long *len)
+{
+    char path[512];
+    golden_path(path, sizeof(path), file, "");
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        snprintf(golden_message, sizeof(golden_message),
+                 "missing %s (run test/golden/make_reference_jpegs.py)", path);
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    *len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *jpeg = (uint8_t *)malloc(*len);
+    if (jpeg != NULL && fread(jpeg, 1, *len, f) != (size_t)*len) {
+        free(jpeg);
+        jpeg = NULL;
+    }
+    fclose(f);
+
+    if (jpeg == NULL) {
+        snprintf(golden_message, sizeof(golden_message), "cannot read %s", path);
+    }
+    return jpeg;
+}
+
+static GoldenResult render_jpeg_and_check(const char *file, const char *name)
+{
+    long len = 0;
+    uint8_t *jpeg = load_jpeg(file, &len);
+    if (jpeg == NULL) {
+        return GOLDEN_ERROR;
+    }
+
+    // Same decoder setup and view switch as the firmware's face mode
+    hal_eye_set_visible(false);
+    face_view_set_visible(true);
+    clear_face_canvas();
+    bool ok = (TJpgDec.drawJpg(0, 0, jpeg, len) == 1);
+    face_view_invalidate();
+    headless_display_refresh();
+    free(jpeg);
+
+    if (!ok) {
+        snprintf(golden_message, sizeof(golden_message), "cannot decode %s", file);
+        return GOLDEN_ERROR;
+    }
+    return golden_check(name);
+}
+
+// Decode a reference JPEG the way fetch_face_frame() does with interpolation on, arriving at now_us
+static bool decode_interpolated(const char *file, int64_t now_us)
+{
+    long len = 0;
+    uint8_t *jpeg = load_jpeg(file, &len);
+    if (jpeg == NULL) {
+        return false;
+    }
+
+    face_view_frame_begin();
+    bool ok = (TJpgDec.drawJpg(0, 0, jpeg, len) == 1);
+    face_view_frame_end(ok, now_us);
+    free(jpeg);
+
+    if (!ok) {
+        snprintf(golden_message, sizeof(golden_message), "cannot decode %s", file);
+    }
+    return ok;
+}
+
+static void show_interpolated(int64_t now_us)
+{
+    face_view_interpolate(now_us);
+    headless_display_refresh();
+}
+
+// What the interpolated canvas should hold: a and b blended per channel at alpha inside the disc, and
+// outside it the black the canvas was cleared to (interpolation never touches the corners)
+static void expected_blend(uint16_t *dst, const uint16_t *a, const uint16_t *b, uint32_t alpha)
+{
+    static PixelSpan spans[HEADLESS_HEIGHT];
+    pixel_disc_spans(spans, HEADLESS_WIDTH, HEADLESS_HEIGHT);
+
+    memset(dst, 0, GOLDEN_PIXELS * sizeof(uint16_t));
+    for (int y = 0; y < HEADLESS_HEIGHT; y++) {
+        for (int x = spans[y].x0; x < spans[y].x1; x++) {
+            int i = y * HEADLESS_WIDTH + x;
+            uint16_t out = 0;
+            for (int c = 0; c < 3; c++) {
+                static const int SHIFTS[3] = { 11, 5, 0 };
+                static const uint16_t MASKS[3] = { 0x1F, 0x3F, 0x1F };
+                uint32_t ca = (a[i] >> SHIFTS[c]) & MASKS[c];
+                uint32_t cb = (b[i] >> SHIFTS[c]) & MASKS[c];
+                uint32_t v = (ca * (PIXEL_BLEND_ALPHA_MAX - alpha) + cb * alpha) / PIXEL_BLEND_ALPHA_MAX;
+                out |= (uint16_t)(v << SHIFTS[c]);
+            }
+            dst[i] = out;
+        }
+    }
+}
+
+/* Tests */
+
+void setUp(void)
+{
+    face_view_set_visible(false);
+    hal_eye_set_visible(true);
+}
+
+void tearDown(void)
+{
+}
+
+static void check_state_phases(EyeTimelineState state)
+{
+    int mismatches = 0, recorded = 0;
+    char name[64];
+
+    for (int quarter = 0; quarter < 4; quarter++) {
+        render_eye_state(state, STATE_PERIODS[state] * quarter / 4, -1);
+        snprintf(name, sizeof(name), "eye_%s_%d", STATE_NAMES[state], quarter * 25);
+        tally(golden_check(name), &mismatches, &recorded);
+    }
+    report_results(mismatches, recorded);
+}
+
+static void test_eye_idle(void)
+{
+    check_state_phases(EYE_STATE_IDLE);
+}
+
+static void test_eye_listening(void)
+{
+    check_state_phases(EYE_STATE_LISTENING);
+}
+
+static void test_eye_speaking(void)
+{
+    check_state_phases(EYE_STATE_SPEAKING);
+}
+
+static void test_eye_speaking_envelope(void)
+{
+    int mismatches = 0, recorded = 0;
+
+    render_eye_state(EYE_STATE_SPEAKING, 0, 0);
+    tally(golden_check("eye_envelope_0"), &mismatches, &recorded);
+    render_eye_state(EYE_STATE_SPEAKING, 0, 200);
+    tally(golden_check("eye_envelope_200"), &mismatches, &recorded);
+    report_results(mismatches, recorded);
+}
+
+static void test_eye_script(void)
+{
+    // Red to amber with a growing glow, sampled halfway through the eased segment
+    static const EyeTimeline script = {
+        2, 0, 1000,
+        {
+            { 0, 255, 0, 0, 0, 255, EYE_EASE_IN_OUT },
+            { 1000, 255, 160, 0, 20, 180, EYE_EASE_LINEAR },
+        },
+    };
+    int mismatches = 0, recorded = 0;
+
+    HalEyeInput input;
+    input.state = EYE_STATE_LISTENING;
+    input.now_ms = 0;
+    input.script = &script;
+    input.script_elapsed_ms = 500;
+    input.envelope_level = -1;
+    render_eye(&input);
+    tally(golden_check("eye_script_500"), &mismatches, &recorded);
+    report_results(mismatches, recorded);
+}
+
+// What displays draw in production: each state's default script at four points of its loop, and once more
+// a loop later, which must wrap back to the same frame
+static void test_eye_default_scripts(void)
+{
+    static uint16_t first_loop[GOLDEN_PIXELS];
+    int mismatches = 0, recorded = 0;
+    char name[64];
+
+    for (int state = 0; state < EYE_STATE_COUNT; state++) {
+        const EyeTimeline *script = &DEFAULT_EYE_SCRIPTS[state];
+        uint32_t loop_ms = script->loop_end_ms - script->loop_start_ms;
+        HalEyeInput input;
+        input.state = (EyeTimelineState)state;
+        input.now_ms = 0;
+        input.script = script;
+        input.envelope_level = -1;
+
+        for (int quarter = 0; quarter < 4; quarter++) {
+            input.script_elapsed_ms = loop_ms * quarter / 4;
+            render_eye(&input);
+            snprintf(name, sizeof(name), "eye_script_%s_%d", STATE_NAMES[state], quarter * 25);
+            tally(golden_check(name), &mismatches, &recorded);
+            if (quarter == 1) {
+                memcpy(first_loop, headless_display_framebuffer(), sizeof(first_loop));
+            }
+        }
+
+        input.script_elapsed_ms = script->loop_end_ms + loop_ms / 4;
+        render_eye(&input);
+        snprintf(name, sizeof(name), "eye_script_%s_wrap", STATE_NAMES[state]);
+        tally(frame_check(name, first_loop), &mismatches, &recorded);
+    }
+    report_results(mismatches, recorded);
+}
+
+static void test_face_jpeg(void)
+{
+    int mismatches = 0, recorded = 0;
+
+    tally(render_jpeg_and_check("face_480.jpg", "face_480"), &mismatches, &recorded);
+    tally(render_jpeg_and_check("bars_480.jpg", "bars_480"), &mismatches, &recorded);
+    report_results(mismatches, recorded);
+}
+
+static void test_face_jpeg_clipped(void)
+{
+    int mismatches = 0, recorded = 0;
+
+    // 496x464: the right-hand MCUs must be clipped, the bottom rows left black
+    tally(render_jpeg_and_check("face_496x464.jpg", "face_496x464"), &mismatches, &recorded);
+    report_results(mismatches, recorded);
+}
+
+static void test_face_interpolation(void)
+{
+    const int64_t t0 = 1000000;
+    int mismatches = 0, recorded = 0;
+
+    static uint16_t bars[GOLDEN_PIXELS];
+    static uint16_t face[GOLDEN_PIXELS];
+    static uint16_t expected[GOLDEN_PIXELS];
+
+    // Both ends come from the straight-decode goldens, so they must exist first
+    if (!golden_load("bars_480", bars) || !golden_load("face_480", face)) {
+        TEST_FAIL_MESSAGE(golden_message);
+    }
+
+    hal_eye_set_visible(false);
+    face_view_set_visible(true);
+    clear_face_canvas();
+    if (!face_view_enable_interpolation()) {
+        TEST_FAIL_MESSAGE("no pool buffers for interpolation");
+    }
+
+    // The first frame has nothing to blend from and is shown whole
+    if (!decode_interpolated("bars_480.jpg", t0)) {
+        TEST_FAIL_MESSAGE(golden_message);
+    }
+    show_interpolated(t0);
+    expected_blend(expected, bars, bars, PIXEL_BLEND_ALPHA_MAX);
+    tally(frame_check("interp_first", expected), &mismatches, &recorded);
+
+    // Halfway through the next frame's interval the canvas is the even blend of the two
+    if (!decode_interpolated("face_480.jpg", t0 + GOLDEN_FRAME_GAP_US)) {
+        TEST_FAIL_MESSAGE(golden_message);
+    }
+    show_interpolated(t0 + GOLDEN_FRAME_GAP_US + GOLDEN_FRAME_GAP_US / 2);
+    expected_blend(expected, bars, face, PIXEL_BLEND_ALPHA_MAX / 2);
+    tally(frame_check("interp_half", expected), &mismatches, &recorded);
+
+    // A decode that fails part way must not disturb the blend in progress
+    static uint16_t white[16 * 16];
+    memset(white, 0xFF, sizeof(white));
+    face_view_frame_begin();
+    tft_output(FACE_VIEW_WIDTH / 2, FACE_VIEW_HEIGHT / 2, 16, 16, white);
+    face_view_frame_end(false, t0 + GOLDEN_FRAME_GAP_US + GOLDEN_FRAME_GAP_US * 3 / 4);
+
+    // And the new frame once the interval has passed
+    show_interpolated(t0 + 2 * GOLDEN_FRAME_GAP_US);
+    expected_blend(expected, bars, face, PIXEL_BLEND_ALPHA_MAX);
+    tally(frame_check("interp_end", expected), &mismatches, &recorded);
+
+    // Back to decoding straight into a fresh canvas, as after leaving face mode
+    face_view_destroy();
+    if (!face_view_create(lv_scr_act())) {
+        TEST_FAIL_MESSAGE("face view not recreated from the pool");
+    }
+    report_results(mismatches, recorded);
+}
+
+int main(void)
+{
+    const char *dir = getenv("GOLDEN_DIR");
+    const char *update = getenv("GOLDEN_UPDATE");
+    if (dir != NULL && dir[0] != '\0') {
+        golden_dir = dir;
+    }
+    if (update != NULL && strcmp(update, "1") == 0) {
+        golden_update = GOLDEN_UPDATE_ALL;
+    } else if (update != NULL && strcmp(update, "missing") == 0) {
+        golden_update = GOLDEN_UPDATE_MISSING;
+    }
+
+    // A fixed tick so nothing time based in LVGL differs between runs
+    native_set_millis(GOLDEN_PINNED_MS);
+    headless_display_init();
+    lv_obj_set_style_bg_color(lv_scr_act(), lv_color_black(), 0);
+    hal_eye_create(lv_scr_act());
+    face_view_create(lv_scr_act());
+
+    TJpgDec.setJpgScale(1);
+    TJpgDec.setSwapBytes(true);
+    TJpgDec.setCallback(tft_output);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_eye_idle);
+    RUN_TEST(test_eye_listening);
+    RUN_TEST(test_eye_speaking);
+    RUN_TEST(test_eye_speaking_envelope);
+    RUN_TEST(test_eye_script);
+    RUN_TEST(test_eye_default_scripts);
+    RUN_TEST(test_face_jpeg);
+    RUN_TEST(test_face_jpeg_clipped);
+    RUN_TEST(test_face_interpolation);
+    return UNITY_END();
+}
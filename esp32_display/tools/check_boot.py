@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+"""
+Boot-time regression check against a display on the bench.
+
+Reset the board (RST button or `pio run -t upload`), then run this. It
+polls the device's /metrics until the "online" boot phase appears and
+fails when a budgeted phase is missing or over its budget
+(hal_boot_budget_ms, from boot_timing.h), so it can gate a firmware
+change in CI.
+
+    python3 tools/check_boot.py 192.168.1.50 [--timeout 30]
+"""
+
+import argparse
+import re
+import sys
+import time
+import urllib.request
+
+LINE = re.compile(r'^hal_boot_(ms|budget_ms)\{phase="(\w+)"\} (-?\d+)$')
+
+
+def scrape(host):
+    with urllib.request.urlopen("http://%s/metrics" % host, timeout=3) as response:
+        text = response.read().decode()
+    phases, budgets = {}, {}
+    for line in text.splitlines():
+        match = LINE.match(line)
+        if match:
+            kind, phase, value = match.groups()
+            (phases if kind == "ms" else budgets)[phase] = int(value)
+    return phases, budgets
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Check display boot phases against their budgets")
+    parser.add_argument("host", help="display IP or hostname")
+    parser.add_argument("--timeout", type=float, default=30, help="seconds to wait for the display to come online")
+    args = parser.parse_args()
+
+    deadline = time.monotonic() + args.timeout
+    phases, budgets = {}, {}
+    while time.monotonic() < deadline:
+        try:
+            phases, budgets = scrape(args.host)
+        except OSError:
+            pass
+        if "online" in phases:
+            break
+        time.sleep(0.5)
+
+    if not phases:
+        print("No boot phases from %s/metrics" % args.host)
+        return 1
+
+    failed = False
+    for phase, ms in sorted(phases.items(), key=lambda item: item[1]):
+        budget = budgets.get(phase)
+        late = budget is not None and ms > budget
+        failed |= late
+        print("%-16s %6d ms%s" % (phase, ms, "  OVER BUDGET (%d ms)" % budget if late else ""))
+    for phase in budgets:
+        if phase not in phases:
+            print("%-16s never reached" % phase)
+            failed = True
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
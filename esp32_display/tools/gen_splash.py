@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+"""
+Generate src/splash_frame.h, the boot splash blitted before LVGL starts.
+
+By default draws the idle eye at the start of its pulse from the same ring
+radii (read from hal_eye.h) and colour formulas (mirroring eye_math.h) the
+renderer uses, so the first LVGL frame lands on an almost identical image.
+Alternatively converts a captured frame, e.g. a golden or the output of the
+device's /snapshot?format=rle565 endpoint, into the header as-is.
+
+The frame is stored as RGB565 (run, colour) pairs in a const array, which
+the linker keeps in flash; a black 480x480 frame with the eye is ~30 KB.
+
+    python3 tools/gen_splash.py                       # synthetic idle eye
+    python3 tools/gen_splash.py --from frame.rle565   # captured frame
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+HAL_EYE_H = os.path.join(ROOT, "src", "hal_eye.h")
+OUTPUT = os.path.join(ROOT, "src", "splash_frame.h")
+
+WIDTH = 480
+HEIGHT = 480
+SUPERSAMPLE = 4         # Per axis, for anti-aliased ring edges
+
+# Idle palette base and per-ring scale (eye_math.h: EYE_PALETTE_BASE, EYE_RING_SCALE_Q8)
+IDLE_BASE = (204, 0, 0)
+RING_SCALE_Q8 = (90, 128, 179, 218, 256)
+LEVELS = 64
+
+
+def rgb565(r, g, b):
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def unpack565(c):
+    return ((c >> 11) & 0x1F) << 3, ((c >> 5) & 0x3F) << 2, (c & 0x1F) << 3
+
+
+def eye_radii():
+    with open(HAL_EYE_H) as f:
+        text = f.read()
+    radii = {}
+    for name, value in re.findall(r"#define\s+EYE_(\w+)_RADIUS\s+(\d+)", text):
+        radii[name] = int(value)
+    return radii
+
+
+def idle_layers():
+    """Eye layers outer to inner as (radius, border_width, fill, border, offset, opacity), frame at phase 0."""
+    radii = eye_radii()
+    pulse = 128                                             # EYE_SINE_PULSE[0]
+    brightness = int((0.7 + 0.3 * pulse / 255.0) * 255 + 0.5)
+    level = brightness >> 2
+    level_brightness = (level * 255 + (LEVELS - 1) // 2) // (LEVELS - 1)
+
+    def ring(i):
+        return rgb565(*(c * RING_SCALE_Q8[i] * level_brightness // (256 * 255) for c in IDLE_BASE))
+
+    glow = rgb565(40 * level // (LEVELS - 1), 0, 0)
+    border = rgb565(255, 50 + 30 * (pulse >> 2) // (LEVELS - 1), 0)
+    center = rgb565(255, 180 + 40 * (pulse >> 2) // (LEVELS - 1), 0)
+    glow_radius = (radii["OUTER"] * 2 + 30 + ((pulse * 20) >> 8)) // 2
+
+    return [
+        (glow_radius, 0, glow, None, (0, 0), 255),
+        (radii["RING_1"], 0, ring(0), None, (0, 0), 255),
+        (radii["RING_2"], 0, ring(1), None, (0, 0), 255),
+        (radii["RING_3"], 0, ring(2), None, (0, 0), 255),
+        (radii["RING_4"], 0, ring(3), None, (0, 0), 255),
+        (radii["INNER"], 2, ring(4), border, (0, 0), 255),
+        (radii["CENTER"], 0, center, None, (0, 0), 255),
+        (radii["HIGHLIGHT"], 0, rgb565(255, 255, 255), None, (-4, -4), 204),
+    ]
+
+
+def draw_eye():
+    layers = idle_layers()
+    cx = cy = WIDTH / 2.0
+    offsets = [(i + 0.5) / SUPERSAMPLE for i in range(SUPERSAMPLE)]
+    samples = SUPERSAMPLE * SUPERSAMPLE
+    outer = layers[0][0] + 1
+    pixels = [0] * (WIDTH * HEIGHT)
+
+    for y in range(HEIGHT):
+        if abs(y + 0.5 - cy) > outer:
+            continue
+        for x in range(WIDTH):
+            if abs(x + 0.5 - cx) > outer:
+                continue
+            acc = [0, 0, 0]
+            for sy in offsets:
+                for sx in offsets:
+                    colour = (0, 0, 0)
+                    for radius, border_width, fill, border, (ox, oy), opa in layers:
+                        dx = x + sx - (cx + ox)
+                        dy = y + sy - (cy + oy)
+                        d2 = dx * dx + dy * dy
+                        if d2 >= radius * radius:
+                            continue
+                        inner = radius - border_width
+                        top = unpack565(border if border is not None and d2 >= inner * inner else fill)
+                        colour = tuple((t * opa + c * (255 - opa)) // 255 for t, c in zip(top, colour))
+                    acc = [a + c for a, c in zip(acc, colour)]
+            pixels[y * WIDTH + x] = rgb565(*(a // samples for a in acc))
+    return WIDTH, HEIGHT, pixels
+
+
+def read_rle565(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    magic, size, body = data.split(b"\n", 2)
+    if magic != b"RLE565":
+        sys.exit("%s: not an RLE565 file" % path)
+    width, height = (int(v) for v in size.split())
+    pixels = []
+    for run, colour in struct.iter_unpack("<HH", body):
+        pixels.extend([colour] * run)
+    if len(pixels) != width * height:
+        sys.exit("%s: %d pixels, expected %d" % (path, len(pixels), width * height))
+    return width, height, pixels
+
+
+def encode_runs(pixels):
+    runs = []
+    i = 0
+    while i < len(pixels):
+        j = i + 1
+        while j < len(pixels) and j - i < 0xFFFF and pixels[j] == pixels[i]:
+            j += 1
+        runs.append((j - i, pixels[i]))
+        i = j
+    return runs
+
+
+def write_header(path, width, height, runs, source):
+    lines = [
+        "/**",
+        " * Boot splash frame - generated by tools/gen_splash.py, do not edit",
+        " *",
+        " * Source: %s" % source,
+        " * %dx%d RGB565 as %d (run, colour) pairs, %d bytes of flash" % (width, height, len(runs), len(runs) * 4),
+        " */",
+        "",
+        "#ifndef SPLASH_FRAME_H",
+        "#define SPLASH_FRAME_H",
+        "",
+        "#include <stdint.h>",
+        "",
+        "#define SPLASH_WIDTH        %d" % width,
+        "#define SPLASH_HEIGHT       %d" % height,
+        "#define SPLASH_RUN_COUNT    %d" % len(runs),
+        "",
+        "static const uint16_t SPLASH_RUNS[SPLASH_RUN_COUNT * 2] = {",
+    ]
+    per_line = 6
+    for i in range(0, len(runs), per_line):
+        chunk = runs[i:i + per_line]
+        lines.append("    " + " ".join("%d, 0x%04X," % run for run in chunk))
+    lines += [
+        "};",
+        "",
+        "#endif // SPLASH_FRAME_H",
+        "",
+    ]
+    with open(path, "w") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--from", dest="source", help="RLE565 frame to embed instead of the synthetic eye")
+    parser.add_argument("--out", default=OUTPUT, help="header to write (default: src/splash_frame.h)")
+    args = parser.parse_args()
+
+    if args.source:
+        width, height, pixels = read_rle565(args.source)
+        source = os.path.basename(args.source)
+    else:
+        width, height, pixels = draw_eye()
+        source = "synthetic idle eye at pulse phase 0"
+
+    runs = encode_runs(pixels)
+    write_header(args.out, width, height, runs, source)
+    print("%s: %d runs, %d bytes" % (args.out, len(runs), len(runs) * 4))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+"""
+Stand-in HAL backends for testing display discovery on a desk.
+
+Starts one tiny HTTP server per --latency value, each answering the
+endpoints a display needs (/api/hal/ping, /api/hal/display, and an empty
+/api/hal/metrics), delayed by that many milliseconds, and advertises each
+as _hal9000._tcp through backend/discovery.py. A display on the same LAN
+should pick the fastest; stopping that one (Ctrl+C and restart without it,
+or --kill-after) should make it fail over to the next.
+
+    pip install zeroconf
+    python3 tools/mdns_standin.py --latency 5 40 120
+    python3 tools/mdns_standin.py --latency 5 40 --kill-after 60
+
+Without zeroconf installed the servers still run, which is enough to test
+the probe and RTT ranking against the compiled-in or cached address.
+"""
+
+import argparse
+import json
+import os
+import sys
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "backend"))
+import discovery  # noqa: E402
+
+START = time.monotonic()
+
+
+def now_ms():
+    return int((time.monotonic() - START) * 1000)
+
+
+def make_handler(name, latency_ms):
+    class Handler(BaseHTTPRequestHandler):
+        def _reply(self, body):
+            time.sleep(latency_ms / 1000.0)
+            data = json.dumps(body).encode()
+            self.send_response(200)
+            self.send_header("Content-Type", "application/json")
+            self.send_header("Content-Length", str(len(data)))
+            self.end_headers()
+            self.wfile.write(data)
+
+        def do_GET(self):
+            path = self.path.split("?")[0]
+            if path == discovery.PING_PATH:
+                self._reply({"service": "hal9000", "server_tx_ms": now_ms()})
+            elif path == "/api/hal/display":
+                rx = now_ms()
+                self._reply({"mode": "eye", "state": "idle", "person": name,
+                             "server_rx_ms": rx, "server_tx_ms": now_ms()})
+            else:
+                self.send_error(404)
+
+        def do_POST(self):
+            self.rfile.read(int(self.headers.get("Content-Length", 0)))
+            self._reply({"success": True})
+
+        def log_message(self, fmt, *args):
+            print(f"[{name}] {self.client_address[0]} {fmt % args}", flush=True)
+
+    return Handler
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Advertise stand-in HAL backends over mDNS")
+    parser.add_argument("--latency", type=int, nargs="+", default=[5, 50], help="added delay per backend, ms")
+    parser.add_argument("--port", type=int, default=18080, help="first port; one per backend")
+    parser.add_argument("--ip", help="address to advertise (default: the LAN interface)")
+    parser.add_argument("--kill-after", type=float, help="stop the fastest backend after this many seconds")
+    args = parser.parse_args()
+
+    servers = []
+    for i, latency in enumerate(args.latency):
+        name = f"stand-in {i} ({latency} ms)"
+        server = ThreadingHTTPServer(("0.0.0.0", args.port + i), make_handler(name, latency))
+        threading.Thread(target=server.serve_forever, daemon=True).start()
+        discovery.start_advertising(args.port + i, name=name, ip=args.ip)
+        servers.append((latency, name, server))
+        print(f"{name} on port {args.port + i}", flush=True)
+
+    try:
+        if args.kill_after is not None:
+            time.sleep(args.kill_after)
+            latency, name, server = min(servers, key=lambda s: s[0])
+            server.shutdown()
+            server.server_close()
+            print(f"Stopped {name}; displays should fail over", flush=True)
+        while True:
+            time.sleep(1)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        discovery.stop_advertising()
+
+
+if __name__ == "__main__":
+    main()